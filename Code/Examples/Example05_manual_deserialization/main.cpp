@@ -56,7 +56,7 @@ int main()
     // Get the root json value
     Json::Value* root = jsonStructuredData.GetRootJsonValue();
 
-    // Cast it to a Json::ObjectValue, which is essentially a map.
+    // Cast it to a Json::ObjectValue, which holds the members of a JSON object.
     Json::ObjectValue* objectValue = root->AsJsonObjectValue();
     if ( !objectValue )
     {
@@ -27,6 +27,7 @@
 // "Licenses" subfolder of the source code repository.
 
 #include "C4Json.h"
+#include "TSSimd.h"
 #include "TSText.h"
 
 #if defined( WIN32 ) || defined( _WIN32 ) || defined( __WIN32__ ) || defined( __NT__ )
@@ -47,6 +48,22 @@
 
 #    pragma warning( disable : 4530 ) // C++ exception handler used, but unwind semantics are not enabled
 
+extern "C"
+{
+    unsigned char _BitScanForward( unsigned long*, unsigned long );
+#    pragma intrinsic( _BitScanForward )
+}
+
+#    if defined( _M_X64 )
+
+extern "C"
+{
+    unsigned __int64 _umul128( unsigned __int64, unsigned __int64, unsigned __int64* );
+#        pragma intrinsic( _umul128 )
+}
+
+#    endif
+
 #endif
 
 #ifndef TERATHON_NO_SYSTEM
@@ -71,7 +88,9 @@
 
 #elif defined( JSON4C4_LINUX )
 
+#    include <errno.h>
 #    include <fcntl.h>
+#    include <sys/mman.h>
 #    include <sys/stat.h>
 #    include <unistd.h>
 
@@ -80,7 +99,6 @@
 #ifdef JSON4C4_USE_SYSTEM_DOUBLE_STRING_CONVERSIONS
 
 #    include <cstdio>
-#    include <cstdlib>
 #    include <cstring>
 
 #endif
@@ -94,8 +112,6 @@
 
 #define JSON4C4VERSION STR( JSON4C4VERSIONMAJOR ) "." STR( JSON4C4VERSIONMINOR ) "." STR( JSON4C4VERSIONPATCH )
 
-#define MAX_FILE_SIZE 0xffff - 1
-
 namespace C4
 {
 
@@ -269,7 +285,7 @@ namespace C4
                 return kFileOkay;
             }
 
-            int fd = open( fileName, O_WRONLY | O_CREAT, 0644 );
+            int fd = open( fileName, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
 
             if ( fd == -1 )
             {
@@ -359,11 +375,6 @@ namespace C4
                 return kFileNotOpen;
             }
 
-            if ( size > MAX_FILE_SIZE )
-            {
-                return kFileReadError;
-            }
-
             const char* begin = buffer;
             const char* end   = begin + size;
             char*       p     = buffer;
@@ -372,9 +383,12 @@ namespace C4
             {
                 DWORD numberOfBytesRead = 0;
 
-                BOOL ok = ::ReadFile( fileHandle, p, end - p, &numberOfBytesRead, nullptr );
+                // ReadFile takes a 32-bit count, so large files are read in chunks.
+                DWORD chunkSize = DWORD( Terathon::Min64( end - p, 0x40000000 ) );
 
-                if ( !ok )
+                BOOL ok = ::ReadFile( fileHandle, p, chunkSize, &numberOfBytesRead, nullptr );
+
+                if ( !ok || numberOfBytesRead == 0 )
                 {
                     return kFileReadError;
                 }
@@ -389,20 +403,25 @@ namespace C4
                 return kFileNotOpen;
             }
 
-            if ( size > MAX_FILE_SIZE )
-            {
-                return kFileReadError;
-            }
-
             const char* begin = buffer;
             const char* end   = begin + size;
             char*       p     = buffer;
 
             while ( p != end )
             {
-                int numberOfBytesRead = read( this->fileDescriptor, buffer, end - p );
+                ssize_t numberOfBytesRead = read( this->fileDescriptor, p, size_t( end - p ) );
 
                 if ( numberOfBytesRead == -1 )
+                {
+                    if ( errno == EINTR )
+                    {
+                        continue;
+                    }
+
+                    return kFileReadError;
+                }
+
+                if ( numberOfBytesRead == 0 )
                 {
                     return kFileReadError;
                 }
@@ -460,10 +479,15 @@ namespace C4
 
             while ( p != end )
             {
-                int numberOfBytesWritten = write( this->fileDescriptor, p, end - p );
+                ssize_t numberOfBytesWritten = write( this->fileDescriptor, p, size_t( end - p ) );
 
                 if ( numberOfBytesWritten == -1 )
                 {
+                    if ( errno == EINTR )
+                    {
+                        continue;
+                    }
+
                     return kFileWriteError;
                 }
 
@@ -474,20 +498,6 @@ namespace C4
 
             return kFileOkay;
         }
-
-        File& operator<<( char c )
-        {
-            this->WriteFile( &c, 1 );
-
-            return ( *this );
-        }
-
-        File& operator<<( const char* c )
-        {
-            this->WriteFile( c, Terathon::Text::GetTextLength( c ) );
-
-            return ( *this );
-        }
     };
 
 #endif
@@ -502,6 +512,7 @@ namespace C4
         static const char* const StatusString[] = { "Ok",
                                                     "Could not open file",
                                                     "Could not read file",
+                                                    "File too large",
                                                     "Invalid JSON text",
                                                     "Unterminated text buffer",
                                                     "Expected opening curly braces",
@@ -524,594 +535,5797 @@ namespace C4
                                                     "An expected object value pair was not found",
                                                     "An exception was caught",
                                                     "JSON structured data contains invalid value type",
-                                                    "Could not find requested name of name/value pair" };
+                                                    "Could not find requested name of name/value pair",
+                                                    "Could not write file",
+                                                    "Number is out of the range of the requested type",
+                                                    "Parsing was stopped by the event handler",
+                                                    "Invalid JSON Pointer",
+                                                    "The JSON Pointer does not refer to a value" };
 
         TERATHON_API String<256> StatusToString( const Status& status ) noexcept
         {
             return StatusString[ (unsigned int)( status ) ];
         }
 
-        alignas( 64 ) const int8 hexadecimalCharValue[ 55 ] = { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  -1, -1, -1, -1, -1, -1, -1, 10, 11,
-                                                                12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
-                                                                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, 13, 14, 15 };
-#ifndef JSON4C4_USE_SYSTEM_DOUBLE_STRING_CONVERSIONS
-        alignas( 64 ) const double minusPower10[ 310 ] = {
-            0.0,    1e-308, 1e-307, 1e-306, 1e-305, 1e-304, 1e-303, 1e-302, 1e-301, 1e-300, 1e-299, 1e-298, 1e-297, 1e-296, 1e-295, 1e-294, 1e-293, 1e-292,
-            1e-291, 1e-290, 1e-289, 1e-288, 1e-287, 1e-286, 1e-285, 1e-284, 1e-283, 1e-282, 1e-281, 1e-280, 1e-279, 1e-278, 1e-277, 1e-276, 1e-275, 1e-274,
-            1e-273, 1e-272, 1e-271, 1e-270, 1e-269, 1e-268, 1e-267, 1e-266, 1e-265, 1e-264, 1e-263, 1e-262, 1e-261, 1e-260, 1e-259, 1e-258, 1e-257, 1e-256,
-            1e-255, 1e-254, 1e-253, 1e-252, 1e-251, 1e-250, 1e-249, 1e-248, 1e-247, 1e-246, 1e-245, 1e-244, 1e-243, 1e-242, 1e-241, 1e-240, 1e-239, 1e-238,
-            1e-237, 1e-236, 1e-235, 1e-234, 1e-233, 1e-232, 1e-231, 1e-230, 1e-229, 1e-228, 1e-227, 1e-226, 1e-225, 1e-224, 1e-223, 1e-222, 1e-221, 1e-220,
-            1e-219, 1e-218, 1e-217, 1e-216, 1e-215, 1e-214, 1e-213, 1e-212, 1e-211, 1e-210, 1e-209, 1e-208, 1e-207, 1e-206, 1e-205, 1e-204, 1e-203, 1e-202,
-            1e-201, 1e-200, 1e-199, 1e-198, 1e-197, 1e-196, 1e-195, 1e-194, 1e-193, 1e-192, 1e-191, 1e-190, 1e-189, 1e-188, 1e-187, 1e-186, 1e-185, 1e-184,
-            1e-183, 1e-182, 1e-181, 1e-180, 1e-179, 1e-178, 1e-177, 1e-176, 1e-175, 1e-174, 1e-173, 1e-172, 1e-171, 1e-170, 1e-169, 1e-168, 1e-167, 1e-166,
-            1e-165, 1e-164, 1e-163, 1e-162, 1e-161, 1e-160, 1e-159, 1e-158, 1e-157, 1e-156, 1e-155, 1e-154, 1e-153, 1e-152, 1e-151, 1e-150, 1e-149, 1e-148,
-            1e-147, 1e-146, 1e-145, 1e-144, 1e-143, 1e-142, 1e-141, 1e-140, 1e-139, 1e-138, 1e-137, 1e-136, 1e-135, 1e-134, 1e-133, 1e-132, 1e-131, 1e-130,
-            1e-129, 1e-128, 1e-127, 1e-126, 1e-125, 1e-124, 1e-123, 1e-122, 1e-121, 1e-120, 1e-119, 1e-118, 1e-117, 1e-116, 1e-115, 1e-114, 1e-113, 1e-112,
-            1e-111, 1e-110, 1e-109, 1e-108, 1e-107, 1e-106, 1e-105, 1e-104, 1e-103, 1e-102, 1e-101, 1e-100, 1e-99,  1e-98,  1e-97,  1e-96,  1e-95,  1e-94,
-            1e-93,  1e-92,  1e-91,  1e-90,  1e-89,  1e-88,  1e-87,  1e-86,  1e-85,  1e-84,  1e-83,  1e-82,  1e-81,  1e-80,  1e-79,  1e-78,  1e-77,  1e-76,
-            1e-75,  1e-74,  1e-73,  1e-72,  1e-71,  1e-70,  1e-69,  1e-68,  1e-67,  1e-66,  1e-65,  1e-64,  1e-63,  1e-62,  1e-61,  1e-60,  1e-59,  1e-58,
-            1e-57,  1e-56,  1e-55,  1e-54,  1e-53,  1e-52,  1e-51,  1e-50,  1e-49,  1e-48,  1e-47,  1e-46,  1e-45,  1e-44,  1e-43,  1e-42,  1e-41,  1e-40,
-            1e-39,  1e-38,  1e-37,  1e-36,  1e-35,  1e-34,  1e-33,  1e-32,  1e-31,  1e-30,  1e-29,  1e-28,  1e-27,  1e-26,  1e-25,  1e-24,  1e-23,  1e-22,
-            1e-21,  1e-20,  1e-19,  1e-18,  1e-17,  1e-16,  1e-15,  1e-14,  1e-13,  1e-12,  1e-11,  1e-10,  1e-9,   1e-8,   1e-7,   1e-6,   1e-5,   1e-4,
-            1e-3,   1e-2,   1e-1,   1.0 };
-
-        alignas( 64 ) const double plusPower10[ 310 ] = { 1.0,   1e1,   1e2,   1e3,   1e4,   1e5,   1e6,   1e7,   1e8,   1e9,
-                                                          1e10,  1e11,  1e12,  1e13,  1e14,  1e15,  1e16,  1e17,  1e18,  1e19,
-                                                          1e20,  1e21,  1e22,  1e23,  1e24,  1e25,  1e26,  1e27,  1e28,  1e29,
-                                                          1e30,  1e31,  1e32,  1e33,  1e34,  1e35,  1e36,  1e37,  1e38,  1e39,
-                                                          1e40,  1e41,  1e42,  1e43,  1e44,  1e45,  1e46,  1e47,  1e48,  1e49,
-                                                          1e50,  1e51,  1e52,  1e53,  1e54,  1e55,  1e56,  1e57,  1e58,  1e59,
-                                                          1e60,  1e61,  1e62,  1e63,  1e64,  1e65,  1e66,  1e67,  1e68,  1e69,
-                                                          1e70,  1e71,  1e72,  1e73,  1e74,  1e75,  1e76,  1e77,  1e78,  1e79,
-                                                          1e80,  1e81,  1e82,  1e83,  1e84,  1e85,  1e86,  1e87,  1e88,  1e89,
-                                                          1e90,  1e91,  1e92,  1e93,  1e94,  1e95,  1e96,  1e97,  1e98,  1e99,
-                                                          1e100, 1e101, 1e102, 1e103, 1e104, 1e105, 1e106, 1e107, 1e108, 1e109,
-                                                          1e110, 1e111, 1e112, 1e113, 1e114, 1e115, 1e116, 1e117, 1e118, 1e119,
-                                                          1e120, 1e121, 1e122, 1e123, 1e124, 1e125, 1e126, 1e127, 1e128, 1e129,
-                                                          1e130, 1e131, 1e132, 1e133, 1e134, 1e135, 1e136, 1e137, 1e138, 1e139,
-                                                          1e140, 1e141, 1e142, 1e143, 1e144, 1e145, 1e146, 1e147, 1e148, 1e149,
-                                                          1e150, 1e151, 1e152, 1e153, 1e154, 1e155, 1e156, 1e157, 1e158, 1e159,
-                                                          1e160, 1e161, 1e162, 1e163, 1e164, 1e165, 1e166, 1e167, 1e168, 1e169,
-                                                          1e170, 1e171, 1e172, 1e173, 1e174, 1e175, 1e176, 1e177, 1e178, 1e179,
-                                                          1e180, 1e181, 1e182, 1e183, 1e184, 1e185, 1e186, 1e187, 1e188, 1e189,
-                                                          1e190, 1e191, 1e192, 1e193, 1e194, 1e195, 1e196, 1e197, 1e198, 1e199,
-                                                          1e200, 1e201, 1e202, 1e203, 1e204, 1e205, 1e206, 1e207, 1e208, 1e209,
-                                                          1e210, 1e211, 1e212, 1e213, 1e214, 1e215, 1e216, 1e217, 1e218, 1e219,
-                                                          1e220, 1e221, 1e222, 1e223, 1e224, 1e225, 1e226, 1e227, 1e228, 1e229,
-                                                          1e230, 1e231, 1e232, 1e233, 1e234, 1e235, 1e236, 1e237, 1e238, 1e239,
-                                                          1e240, 1e241, 1e242, 1e243, 1e244, 1e245, 1e246, 1e247, 1e248, 1e249,
-                                                          1e250, 1e251, 1e252, 1e253, 1e254, 1e255, 1e256, 1e257, 1e258, 1e259,
-                                                          1e260, 1e261, 1e262, 1e263, 1e264, 1e265, 1e266, 1e267, 1e268, 1e269,
-                                                          1e270, 1e271, 1e272, 1e273, 1e274, 1e275, 1e276, 1e277, 1e278, 1e279,
-                                                          1e280, 1e281, 1e282, 1e283, 1e284, 1e285, 1e286, 1e287, 1e288, 1e289,
-                                                          1e290, 1e291, 1e292, 1e293, 1e294, 1e295, 1e296, 1e297, 1e298, 1e299,
-                                                          1e300, 1e301, 1e302, 1e303, 1e304, 1e305, 1e306, 1e307, 1e308, __builtin_huge_val() };
-
-#endif
+        OutputSink::~OutputSink()
+        {
+        }
 
-        constexpr uint8 space          = 0x20;
-        constexpr uint8 tab            = 0x09;
-        constexpr uint8 newLine        = 0x0A;
-        constexpr uint8 carriageReturn = 0x0D;
+        Status OutputSink::Flush()
+        {
+            return status;
+        }
 
-        class StringValue;
-        class NumberValue;
-        class BoolValue;
-        class NullValue;
-        class ArrayValue;
+        BufferedOutputSink::BufferedOutputSink( uint32 bufferSize ) noexcept : bufferSize( ( bufferSize != 0 ) ? bufferSize : kDefaultBufferSize )
+        {
+        }
 
-        void ExpandArray( Array<char>& array, const char c, const uint32 n )
+        Status BufferedOutputSink::WriteOverflow( const char* data, uint64 size )
         {
-            for ( uint32 a = 0; a != n; a++ )
+            if ( buffer.Empty() )
             {
-                array.AppendArrayElement( c );
+                buffer.SetArrayElementCount( int32( bufferSize ) );
+
+                cursor = buffer.begin();
+                limit  = buffer.end();
             }
-        }
+            else
+            {
+                Status consumeStatus = Consume( buffer.begin(), uint64( cursor - buffer.begin() ) );
+                cursor               = buffer.begin();
 
-        int32 ComputeWhitespaceLength( const char* text ) noexcept
-        {
-            const uint8* byte = reinterpret_cast<const uint8*>( text );
+                if ( consumeStatus != Status::kOk )
+                {
+                    return consumeStatus;
+                }
+            }
 
-            while ( byte[ 0 ] != 0 && ( byte[ 0 ] == space || byte[ 0 ] == tab || byte[ 0 ] == newLine || byte[ 0 ] == carriageReturn ) )
+            // Blocks that would not fit in an empty buffer are passed through without copying.
+            if ( size > uint64( bufferSize ) )
             {
-                byte++;
+                return Consume( data, size );
             }
 
-            return int32( reinterpret_cast<const char*>( byte ) - text );
+            memcpy( cursor, data, size_t( size ) );
+            cursor += size;
+
+            return Status::kOk;
         }
 
-        int32 ComputeFloatLiteralLength( const char* text ) noexcept
+        Status BufferedOutputSink::Flush()
         {
-            const uint8* byte = reinterpret_cast<const uint8*>( text );
-
-            while ( byte[ 0 ] != 0 && ( ( byte[ 0 ] >= '0' && byte[ 0 ] <= '9' ) || ( byte[ 0 ] == '.' ) || ( byte[ 0 ] == 'e' ) || ( byte[ 0 ] == 'E' ) ||
-                                        ( byte[ 0 ] == '+' ) || ( byte[ 0 ] == '-' ) ) )
+            if ( status == Status::kOk && cursor != buffer.begin() )
             {
-                byte++;
+                status = MayThrow( [ & ]() { return Consume( buffer.begin(), uint64( cursor - buffer.begin() ) ); } );
             }
 
-            return int32( reinterpret_cast<const char*>( byte ) - text );
+            cursor = buffer.begin();
+
+            return status;
         }
 
-        int32 ReadEscapeChar( const char* text, uint32* value ) noexcept
+        FileOutputSink::FileOutputSink( File& file, uint32 bufferSize ) noexcept : BufferedOutputSink( bufferSize ), file( file )
         {
-            const uint8* byte = reinterpret_cast<const uint8*>( text );
-            uint32       c    = byte[ 0 ];
+        }
 
-            if ( ( c == '\"' ) || ( c == '\\' ) || ( c == '/' ) )
-            {
-                *value = c;
-                return ( 1 );
-            }
-            else if ( c == 'b' )
-            {
-                *value = '\b';
-                return ( 1 );
-            }
-            else if ( c == 'f' )
-            {
-                *value = '\f';
-                return ( 1 );
-            }
-            else if ( c == 'n' )
+        Status FileOutputSink::Consume( const char* data, uint64 size )
+        {
+            return ( file.WriteFile( data, size ) == kFileOkay ) ? Status::kOk : Status::kFileWriteError;
+        }
+
+        CallbackOutputSink::CallbackOutputSink( OutputCallback* callback, void* cookie, uint32 bufferSize ) noexcept : BufferedOutputSink( bufferSize ),
+                                                                                                                       callback( callback ),
+                                                                                                                       cookie( cookie )
+        {
+        }
+
+        Status CallbackOutputSink::Consume( const char* data, uint64 size )
+        {
+            return callback( data, size, cookie );
+        }
+
+        ArrayOutputSink::ArrayOutputSink( Array<char>& array ) noexcept : array( array )
+        {
+        }
+
+        Status ArrayOutputSink::WriteOverflow( const char* data, uint64 size )
+        {
+            // The window is the tail of the array between the written characters and the element count. The whole
+            // reserved storage is used before the array is grown geometrically, so a caller that keeps the array
+            // between writes of similar size causes no allocation.
+            int32  writtenCount  = ( cursor != nullptr ) ? int32( cursor - array.begin() ) : array.GetArrayElementCount();
+            uint64 requiredCount = uint64( writtenCount ) + size;
+
+            if ( requiredCount > 0x7FFFFFFF )
             {
-                *value = '\n';
-                return ( 1 );
+                return Status::KFileTooLarge;
             }
-            else if ( c == 'r' )
+
+            uint64 newCount = uint64( array.GetArrayReservedCount() );
+            if ( newCount < requiredCount )
             {
-                *value = '\r';
-                return ( 1 );
+                newCount = ( newCount < 0x800 ) ? 0x1000 : newCount * 2;
+                newCount = ( newCount < requiredCount ) ? requiredCount : newCount;
+                newCount = ( newCount > 0x7FFFFFFF ) ? 0x7FFFFFFF : newCount;
             }
-            else if ( c == 't' )
+
+            array.SetArrayElementCount( int32( newCount ) );
+
+            cursor = array.begin() + writtenCount;
+            limit  = array.begin() + newCount;
+
+            memcpy( cursor, data, size_t( size ) );
+            cursor += size;
+
+            return Status::kOk;
+        }
+
+        Status ArrayOutputSink::Flush()
+        {
+            if ( cursor != nullptr )
             {
-                *value = '\t';
-                return ( 1 );
+                array.SetArrayElementCount( int32( cursor - array.begin() ) );
             }
 
-            return ( 0 );
+            cursor = nullptr;
+            limit  = nullptr;
+
+            return status;
         }
 
-        int32 ReadStringEscapeChar( const char* text, int32* stringLength, char* restrict string ) noexcept
+        Arena::Arena( void* initialBlock, uint64 initialBlockSize ) noexcept
+            : cursor( static_cast<char*>( initialBlock ) ), limit( static_cast<char*>( initialBlock ) + initialBlockSize ),
+              initialBlock( static_cast<char*>( initialBlock ) ), initialBlockSize( initialBlockSize )
         {
-            const uint8* byte = reinterpret_cast<const uint8*>( text );
-            uint32       c    = byte[ 0 ];
+        }
 
-            if ( c == 'u' )
-            {
-                uint32 code = 0;
+        Arena::~Arena() noexcept
+        {
+            Release();
+        }
 
-                for ( machine a = 1; a <= 4; a++ )
-                {
-                    c = byte[ a ] - '0';
-                    if ( c >= 55U )
-                    {
-                        return ( 0 );
-                    }
+        void* Arena::AllocateChunk( uint64 size, uint64 alignment )
+        {
+            // A request that would take more than a quarter of a regular chunk gets a chunk of its own, so the
+            // remainder of the current chunk stays available for the requests that follow.
+            uint64     requiredSize = sizeof( Chunk ) + size + alignment;
+            bool       large        = ( requiredSize > nextChunkSize / 4 );
+            ChunkList& list         = large ? largeChunkList : chunkList;
+
+            Chunk* chunk = list.current ? list.current->next : list.first;
+            if ( !chunk || chunk->size < requiredSize )
+            {
+                uint64 chunkSize = large ? requiredSize : nextChunkSize;
+                Chunk* newChunk  = reinterpret_cast<Chunk*>( new char[ size_t( chunkSize ) ] );
 
-                    int32 x = hexadecimalCharValue[ c ];
-                    if ( x < 0 )
-                    {
-                        return ( 0 );
-                    }
+                newChunk->next = chunk;
+                newChunk->size = chunkSize;
 
-                    code = ( code << 4 ) | x;
+                if ( list.current )
+                {
+                    list.current->next = newChunk;
                 }
-
-                if ( code != 0 )
+                else
                 {
-                    if ( string )
-                    {
-                        *stringLength = Text::WriteUnicodeChar( string, code );
-                    }
-                    else
-                    {
-                        *stringLength = 1 + ( code >= 0x000080 ) + ( code >= 0x000800 );
-                    }
+                    list.first = newChunk;
+                }
 
-                    return ( 5 );
+                if ( !large )
+                {
+                    nextChunkSize = ( nextChunkSize < kMaxChunkSize ) ? nextChunkSize * 2 : kMaxChunkSize;
                 }
+
+                chunk = newChunk;
             }
-            else
+
+            list.current = chunk;
+
+            machine_address address = ( machine_address( chunk + 1 ) + machine_address( alignment - 1 ) ) & ~machine_address( alignment - 1 );
+
+            if ( !large )
             {
-                uint32 value;
+                cursor = reinterpret_cast<char*>( address + size );
+                limit  = reinterpret_cast<char*>( chunk ) + chunk->size;
+            }
 
-                int32 textLength = ReadEscapeChar( text, &value );
-                if ( textLength != 0 )
-                {
-                    if ( string )
-                    {
-                        *string = char( value );
-                    }
+            return reinterpret_cast<void*>( address );
+        }
 
-                    *stringLength = 1;
-                    return ( textLength );
-                }
+        void Arena::FreeChunks( ChunkList& list ) noexcept
+        {
+            while ( list.first )
+            {
+                Chunk* next = list.first->next;
+                delete[] reinterpret_cast<char*>( list.first );
+                list.first = next;
             }
+        }
 
-            return ( 0 );
+        void Arena::Rewind() noexcept
+        {
+            chunkList.current      = nullptr;
+            largeChunkList.current = nullptr;
+
+            cursor   = initialBlock;
+            limit    = initialBlock + initialBlockSize;
+            modified = false;
         }
 
-        Status ReadStringLiteral( const char* text, int32* textLength, int32* stringLength, char* restrict string = nullptr ) noexcept( false )
+        void Arena::Release() noexcept
         {
-            const uint8* byte  = reinterpret_cast<const uint8*>( text );
-            int32        count = 0;
+            FreeChunks( chunkList );
+            FreeChunks( largeChunkList );
+            Rewind();
 
-            for ( ;; )
-            {
-                uint32 c = byte[ 0 ];
-                if ( c == 0 )
-                {
-                    return Status::kPrematureNullTerminator;
-                }
+            nextChunkSize = kMinChunkSize;
+        }
 
-                if ( c == '\"' )
-                {
-                    break;
-                }
+        constexpr int32 kMinKeyTableCapacity = 64;
 
-                if ( ( c < 32U ) || ( c == 127U ) )
-                {
-                    return ( Status::kStringIllegalChar );
-                }
+        // Both allocations happen before the table is modified, so a failure leaves it as it was.
+        void KeyTable::Grow()
+        {
+            int32      capacity = ( slots.GetArrayElementCount() != 0 ) ? slots.GetArrayElementCount() * 2 : kMinKeyTableCapacity;
+            Array<Key> previous;
 
-                if ( c != '\\' )
-                {
-                    int32 len = Text::ValidateUnicodeChar( reinterpret_cast<const char*>( byte ) );
-                    if ( len == 0 )
-                    {
-                        return ( Status::kStringIllegalChar );
-                    }
+            previous.SetArrayElementCount( slots.GetArrayElementCount() );
+            slots.ReserveArrayElementCount( capacity );
 
-                    if ( string )
-                    {
-                        for ( machine a = 0; a < len; a++ )
-                        {
-                            string[ a ] = char( byte[ a ] );
-                        }
+            for ( int32 a = 0; a != slots.GetArrayElementCount(); a++ )
+            {
+                previous[ a ] = slots[ a ];
+            }
 
-                        string += len;
-                    }
+            slots.SetArrayElementCount( capacity );
 
-                    byte += len;
-                    count += len;
-                }
-                else
-                {
-                    int32 stringLen;
+            for ( Key& slot : slots )
+            {
+                slot.name = nullptr;
+            }
 
-                    int32 textLen = ReadStringEscapeChar( reinterpret_cast<const char*>( ++byte ), &stringLen, string );
-                    if ( textLen == 0 )
-                    {
-                        return ( Status::kStringIllegalEscape );
-                    }
+            uint32 mask = uint32( capacity - 1 );
 
-                    if ( string )
+            for ( const Key& key : previous )
+            {
+                if ( key.name )
+                {
+                    uint32 slot = key.hash & mask;
+
+                    while ( slots[ int32( slot ) ].name )
                     {
-                        string += stringLen;
+                        slot = ( slot + 1 ) & mask;
                     }
 
-                    byte += textLen;
-                    count += stringLen;
+                    slots[ int32( slot ) ] = key;
                 }
             }
-
-            *textLength   = int32( reinterpret_cast<const char*>( byte ) - text );
-            *stringLength = count;
-
-            return ( Status::kOk );
         }
 
-        Status ReadDoubleLiteral( const char* text, int32* textLength, double* value )
+        Key KeyTable::Intern( const char* name, int32 length, Arena& arena )
         {
-#ifdef JSON4C4_USE_SYSTEM_DOUBLE_STRING_CONVERSIONS
-            *textLength = ComputeFloatLiteralLength( text );
+            uint32 hash = HashKey( name, length );
 
-            if ( *textLength == 0 )
+            if ( slots.GetArrayElementCount() != 0 )
             {
-                return ( Status::kFloatInvalid );
-            }
+                uint32 mask = uint32( slots.GetArrayElementCount() - 1 );
 
-            if ( text[ 0 ] == '0' )
-            {
-                if ( *textLength > 1 && text[ 1 ] != '.' )
+                for ( uint32 slot = hash & mask; slots[ int32( slot ) ].name; slot = ( slot + 1 ) & mask )
                 {
-                    return ( Status::kNumbersCannotHaveLeadingZeros );
+                    const Key& key = slots[ int32( slot ) ];
+                    if ( key.hash == hash && key.length == length && memcmp( key.name, name, size_t( length ) ) == 0 )
+                    {
+                        return key;
+                    }
                 }
             }
 
-            char* str = new char[ ( *textLength ) + 1 ];
-
-            Text::CopyText( text, str, *textLength );
+            // The table is kept at most half full.
+            if ( ( keyCount + 1 ) * 2 > slots.GetArrayElementCount() )
+            {
+                Grow();
+            }
 
-            str[ *textLength ] = 0;
+            char* storage = static_cast<char*>( arena.Allocate( uint64( length ) + 1, 1 ) );
+            memcpy( storage, name, size_t( length ) );
+            storage[ length ] = 0;
 
-            char*  end = nullptr;
-            double v   = strtod( str, &end );
+            uint32 mask = uint32( slots.GetArrayElementCount() - 1 );
+            uint32 slot = hash & mask;
 
-            if ( str == end )
+            while ( slots[ int32( slot ) ].name )
             {
-                delete[] str;
-                return ( Status::kFloatInvalid );
+                slot = ( slot + 1 ) & mask;
             }
 
-            delete[] str;
+            Key& key   = slots[ int32( slot ) ];
+            key.name   = storage;
+            key.length = length;
+            key.hash   = hash;
+            keyCount++;
+
+            return key;
+        }
+
+        const Key* KeyTable::Find( const Key& key ) const noexcept
+        {
+            if ( keyCount == 0 )
+            {
+                return nullptr;
+            }
+
+            uint32 mask = uint32( slots.GetArrayElementCount() - 1 );
+
+            for ( uint32 slot = key.hash & mask; slots[ int32( slot ) ].name; slot = ( slot + 1 ) & mask )
+            {
+                const Key& candidate = slots[ int32( slot ) ];
+                if ( candidate.hash == key.hash && candidate.length == key.length && memcmp( candidate.name, key.name, size_t( key.length ) ) == 0 )
+                {
+                    return &candidate;
+                }
+            }
+
+            return nullptr;
+        }
+
+        void KeyTable::Clear() noexcept
+        {
+            if ( keyCount != 0 )
+            {
+                for ( Key& slot : slots )
+                {
+                    slot.name = nullptr;
+                }
+
+                keyCount = 0;
+            }
+        }
+
+        void KeyTable::Purge() noexcept
+        {
+            slots.PurgeArray();
+            keyCount = 0;
+        }
+
+        alignas( 64 ) const int8 hexadecimalCharValue[ 55 ] = { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  -1, -1, -1, -1, -1, -1, -1, 10, 11,
+                                                                12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, 13, 14, 15 };
+        // Normalized 128-bit truncations of the powers of five from 5^-342 to 5^308, most significant word first, for
+        // the Eisel-Lemire conversion in ReadDoubleLiteral.
+        constexpr int32 kSmallestPowerOfTen = -342;
+        constexpr int32 kLargestPowerOfTen  = 308;
+
+        alignas( 64 ) const uint64 powerOfFive128[ 1302 ] = {
+            0xEEF453D6923BD65A, 0x113FAA2906A13B3F, 0x9558B4661B6565F8, 0x4AC7CA59A424C507,
+            0xBAAEE17FA23EBF76, 0x5D79BCF00D2DF649, 0xE95A99DF8ACE6F53, 0xF4D82C2C107973DC,
+            0x91D8A02BB6C10594, 0x79071B9B8A4BE869, 0xB64EC836A47146F9, 0x9748E2826CDEE284,
+            0xE3E27A444D8D98B7, 0xFD1B1B2308169B25, 0x8E6D8C6AB0787F72, 0xFE30F0F5E50E20F7,
+            0xB208EF855C969F4F, 0xBDBD2D335E51A935, 0xDE8B2B66B3BC4723, 0xAD2C788035E61382,
+            0x8B16FB203055AC76, 0x4C3BCB5021AFCC31, 0xADDCB9E83C6B1793, 0xDF4ABE242A1BBF3D,
+            0xD953E8624B85DD78, 0xD71D6DAD34A2AF0D, 0x87D4713D6F33AA6B, 0x8672648C40E5AD68,
+            0xA9C98D8CCB009506, 0x680EFDAF511F18C2, 0xD43BF0EFFDC0BA48, 0x0212BD1B2566DEF2,
+            0x84A57695FE98746D, 0x014BB630F7604B57, 0xA5CED43B7E3E9188, 0x419EA3BD35385E2D,
+            0xCF42894A5DCE35EA, 0x52064CAC828675B9, 0x818995CE7AA0E1B2, 0x7343EFEBD1940993,
+            0xA1EBFB4219491A1F, 0x1014EBE6C5F90BF8, 0xCA66FA129F9B60A6, 0xD41A26E077774EF6,
+            0xFD00B897478238D0, 0x8920B098955522B4, 0x9E20735E8CB16382, 0x55B46E5F5D5535B0,
+            0xC5A890362FDDBC62, 0xEB2189F734AA831D, 0xF712B443BBD52B7B, 0xA5E9EC7501D523E4,
+            0x9A6BB0AA55653B2D, 0x47B233C92125366E, 0xC1069CD4EABE89F8, 0x999EC0BB696E840A,
+            0xF148440A256E2C76, 0xC00670EA43CA250D, 0x96CD2A865764DBCA, 0x380406926A5E5728,
+            0xBC807527ED3E12BC, 0xC605083704F5ECF2, 0xEBA09271E88D976B, 0xF7864A44C633682E,
+            0x93445B8731587EA3, 0x7AB3EE6AFBE0211D, 0xB8157268FDAE9E4C, 0x5960EA05BAD82964,
+            0xE61ACF033D1A45DF, 0x6FB92487298E33BD, 0x8FD0C16206306BAB, 0xA5D3B6D479F8E056,
+            0xB3C4F1BA87BC8696, 0x8F48A4899877186C, 0xE0B62E2929ABA83C, 0x331ACDABFE94DE87,
+            0x8C71DCD9BA0B4925, 0x9FF0C08B7F1D0B14, 0xAF8E5410288E1B6F, 0x07ECF0AE5EE44DD9,
+            0xDB71E91432B1A24A, 0xC9E82CD9F69D6150, 0x892731AC9FAF056E, 0xBE311C083A225CD2,
+            0xAB70FE17C79AC6CA, 0x6DBD630A48AAF406, 0xD64D3D9DB981787D, 0x092CBBCCDAD5B108,
+            0x85F0468293F0EB4E, 0x25BBF56008C58EA5, 0xA76C582338ED2621, 0xAF2AF2B80AF6F24E,
+            0xD1476E2C07286FAA, 0x1AF5AF660DB4AEE1, 0x82CCA4DB847945CA, 0x50D98D9FC890ED4D,
+            0xA37FCE126597973C, 0xE50FF107BAB528A0, 0xCC5FC196FEFD7D0C, 0x1E53ED49A96272C8,
+            0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7A, 0x9FAACF3DF73609B1, 0x77B191618C54E9AC,
+            0xC795830D75038C1D, 0xD59DF5B9EF6A2417, 0xF97AE3D0D2446F25, 0x4B0573286B44AD1D,
+            0x9BECCE62836AC577, 0x4EE367F9430AEC32, 0xC2E801FB244576D5, 0x229C41F793CDA73F,
+            0xF3A20279ED56D48A, 0x6B43527578C1110F, 0x9845418C345644D6, 0x830A13896B78AAA9,
+            0xBE5691EF416BD60C, 0x23CC986BC656D553, 0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA8,
+            0x94B3A202EB1C3F39, 0x7BF7D71432F3D6A9, 0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC53,
+            0xE858AD248F5C22C9, 0xD1B3400F8F9CFF68, 0x91376C36D99995BE, 0x23100809B9C21FA1,
+            0xB58547448FFFFB2D, 0xABD40A0C2832A78A, 0xE2E69915B3FFF9F9, 0x16C90C8F323F516C,
+            0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E3, 0xB1442798F49FFB4A, 0x99CD11CFDF41779C,
+            0xDD95317F31C7FA1D, 0x40405643D711D583, 0x8A7D3EEF7F1CFC52, 0x482835EA666B2572,
+            0xAD1C8EAB5EE43B66, 0xDA3243650005EECF, 0xD863B256369D4A40, 0x90BED43E40076A82,
+            0x873E4F75E2224E68, 0x5A7744A6E804A291, 0xA90DE3535AAAE202, 0x711515D0A205CB36,
+            0xD3515C2831559A83, 0x0D5A5B44CA873E03, 0x8412D9991ED58091, 0xE858790AFE9486C2,
+            0xA5178FFF668AE0B6, 0x626E974DBE39A872, 0xCE5D73FF402D98E3, 0xFB0A3D212DC8128F,
+            0x80FA687F881C7F8E, 0x7CE66634BC9D0B99, 0xA139029F6A239F72, 0x1C1FFFC1EBC44E80,
+            0xC987434744AC874E, 0xA327FFB266B56220, 0xFBE9141915D7A922, 0x4BF1FF9F0062BAA8,
+            0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4A9, 0xC4CE17B399107C22, 0xCB550FB4384D21D3,
+            0xF6019DA07F549B2B, 0x7E2A53A146606A48, 0x99C102844F94E0FB, 0x2EDA7444CBFC426D,
+            0xC0314325637A1939, 0xFA911155FEFB5308, 0xF03D93EEBC589F88, 0x793555AB7EBA27CA,
+            0x96267C7535B763B5, 0x4BC1558B2F3458DE, 0xBBB01B9283253CA2, 0x9EB1AAEDFB016F16,
+            0xEA9C227723EE8BCB, 0x465E15A979C1CADC, 0x92A1958A7675175F, 0x0BFACD89EC191EC9,
+            0xB749FAED14125D36, 0xCEF980EC671F667B, 0xE51C79A85916F484, 0x82B7E12780E7401A,
+            0x8F31CC0937AE58D2, 0xD1B2ECB8B0908810, 0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA15,
+            0xDFBDCECE67006AC9, 0x67A791E093E1D49A, 0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E0,
+            0xAECC49914078536D, 0x58FAE9F773886E18, 0xDA7F5BF590966848, 0xAF39A475506A899E,
+            0x888F99797A5E012D, 0x6D8406C952429603, 0xAAB37FD7D8F58178, 0xC8E5087BA6D33B83,
+            0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A64, 0x855C3BE0A17FCD26, 0x5CF2EEA09A55067F,
+            0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481E, 0xD0601D8EFC57B08B, 0xF13B94DAF124DA26,
+            0x823C12795DB6CE57, 0x76C53D08D6B70858, 0xA2CB1717B52481ED, 0x54768C4B0C64CA6E,
+            0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD09, 0xFE5D54150B090B02, 0xD3F93B35435D7C4C,
+            0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DAF, 0xC6B8E9B0709F109A, 0x359AB6419CA1091B,
+            0xF867241C8CC6D4C0, 0xC30163D203C94B62, 0x9B407691D7FC44F8, 0x79E0DE63425DCF1D,
+            0xC21094364DFB5636, 0x985915FC12F542E4, 0xF294B943E17A2BC4, 0x3E6F5B7B17B2939D,
+            0x979CF3CA6CEC5B5A, 0xA705992CEECF9C42, 0xBD8430BD08277231, 0x50C6FF782A838353,
+            0xECE53CEC4A314EBD, 0xA4F8BF5635246428, 0x940F4613AE5ED136, 0x871B7795E136BE99,
+            0xB913179899F68584, 0x28E2557B59846E3F, 0xE757DD7EC07426E5, 0x331AEADA2FE589CF,
+            0x9096EA6F3848984F, 0x3FF0D2C85DEF7621, 0xB4BCA50B065ABE63, 0x0FED077A756B53A9,
+            0xE1EBCE4DC7F16DFB, 0xD3E8495912C62894, 0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95C,
+            0xB080392CC4349DEC, 0xBD8D794D96AACFB3, 0xDCA04777F541C567, 0xECF0D7A0FC5583A0,
+            0x89E42CAAF9491B60, 0xF41686C49DB57244, 0xAC5D37D5B79B6239, 0x311C2875C522CED5,
+            0xD77485CB25823AC7, 0x7D633293366B828B, 0x86A8D39EF77164BC, 0xAE5DFF9C02033197,
+            0xA8530886B54DBDEB, 0xD9F57F830283FDFC, 0xD267CAA862A12D66, 0xD072DF63C324FD7B,
+            0x8380DEA93DA4BC60, 0x4247CB9E59F71E6D, 0xA46116538D0DEB78, 0x52D9BE85F074E608,
+            0xCD795BE870516656, 0x67902E276C921F8B, 0x806BD9714632DFF6, 0x00BA1CD8A3DB53B6,
+            0xA086CFCD97BF97F3, 0x80E8A40ECCD228A4, 0xC8A883C0FDAF7DF0, 0x6122CD128006B2CD,
+            0xFAD2A4B13D1B5D6C, 0x796B805720085F81, 0x9CC3A6EEC6311A63, 0xCBE3303674053BB0,
+            0xC3F490AA77BD60FC, 0xBEDBFC4411068A9C, 0xF4F1B4D515ACB93B, 0xEE92FB5515482D44,
+            0x991711052D8BF3C5, 0x751BDD152D4D1C4A, 0xBF5CD54678EEF0B6, 0xD262D45A78A0635D,
+            0xEF340A98172AACE4, 0x86FB897116C87C34, 0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA0,
+            0xBAE0A846D2195712, 0x8974836059CCA109, 0xE998D258869FACD7, 0x2BD1A438703FC94B,
+            0x91FF83775423CC06, 0x7B6306A34627DDCF, 0xB67F6455292CBF08, 0x1A3BC84C17B1D542,
+            0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A93, 0x8E938662882AF53E, 0x547EB47B7282EE9C,
+            0xB23867FB2A35B28D, 0xE99E619A4F23AA43, 0xDEC681F9F4C31F31, 0x6405FA00E2EC94D4,
+            0x8B3C113C38F9F37E, 0xDE83BC408DD3DD04, 0xAE0B158B4738705E, 0x9624AB50B148D445,
+            0xD98DDAEE19068C76, 0x3BADD624DD9B0957, 0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D6,
+            0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4C, 0xD47487CC8470652B, 0x7647C3200069671F,
+            0x84C8D4DFD2C63F3B, 0x29ECD9F40041E073, 0xA5FB0A17C777CF09, 0xF468107100525890,
+            0xCF79CC9DB955C2CC, 0x7182148D4066EEB4, 0x81AC1FE293D599BF, 0xC6F14CD848405530,
+            0xA21727DB38CB002F, 0xB8ADA00E5A506A7C, 0xCA9CF1D206FDC03B, 0xA6D90811F0E4851C,
+            0xFD442E4688BD304A, 0x908F4A166D1DA663, 0x9E4A9CEC15763E2E, 0x9A598E4E043287FE,
+            0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FD, 0xF7549530E188C128, 0xD12BEE59E68EF47C,
+            0x9A94DD3E8CF578B9, 0x82BB74F8301958CE, 0xC13A148E3032D6E7, 0xE36A52363C1FAF01,
+            0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC1, 0x96F5600F15A7B7E5, 0x29AB103A5EF8C0B9,
+            0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E7, 0xEBDF661791D60F56, 0x111B495B3464AD21,
+            0x936B9FCEBB25C995, 0xCAB10DD900BEEC34, 0xB84687C269EF3BFB, 0x3D5D514F40EEA742,
+            0xE65829B3046B0AFA, 0x0CB4A5A3112A5112, 0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AB,
+            0xB3F4E093DB73A093, 0x59ED216765690F56, 0xE0F218B8D25088B8, 0x306869C13EC3532C,
+            0x8C974F7383725573, 0x1E414218C73A13FB, 0xAFBD2350644EEACF, 0xE5D1929EF90898FA,
+            0xDBAC6C247D62A583, 0xDF45F746B74ABF39, 0x894BC396CE5DA772, 0x6B8BBA8C328EB783,
+            0xAB9EB47C81F5114F, 0x066EA92F3F326564, 0xD686619BA27255A2, 0xC80A537B0EFEFEBD,
+            0x8613FD0145877585, 0xBD06742CE95F5F36, 0xA798FC4196E952E7, 0x2C48113823B73704,
+            0xD17F3B51FCA3A7A0, 0xF75A15862CA504C5, 0x82EF85133DE648C4, 0x9A984D73DBE722FB,
+            0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBA, 0xCC963FEE10B7D1B3, 0x318DF905079926A8,
+            0xFFBBCFE994E5C61F, 0xFDF17746497F7052, 0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA633,
+            0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC0, 0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B0,
+            0x9C1661A651213E2D, 0x06BEA10CA65C084E, 0xC31BFA0FE5698DB8, 0x486E494FCFF30A62,
+            0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFA, 0x986DDB5C6B3A76B7, 0xF89629465A75E01C,
+            0xBE89523386091465, 0xF6BBB397F1135823, 0xEE2BA6C0678B597F, 0x746AA07DED582E2C,
+            0x94DB483840B717EF, 0xA8C2A44EB4571CDC, 0xBA121A4650E4DDEB, 0x92F34D62616CE413,
+            0xE896A0D7E51E1566, 0x77B020BAF9C81D17, 0x915E2486EF32CD60, 0x0ACE1474DC1D122E,
+            0xB5B5ADA8AAFF80B8, 0x0D819992132456BA, 0xE3231912D5BF60E6, 0x10E1FFF697ED6C69,
+            0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C1, 0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB2,
+            0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDE, 0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96B,
+            0xAD4AB7112EB3929D, 0x86C16C98D2C953C6, 0xD89D64D57A607744, 0xE871C7BF077BA8B7,
+            0x87625F056C7C4A8B, 0x11471CD764AD4972, 0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BCF,
+            0xD389B47879823479, 0x4AFF1D108D4EC2C3, 0x843610CB4BF160CB, 0xCEDF722A585139BA,
+            0xA54394FE1EEDB8FE, 0xC2974EB4EE658828, 0xCE947A3DA6A9273E, 0x733D226229FEEA32,
+            0x811CCC668829B887, 0x0806357D5A3F525F, 0xA163FF802A3426A8, 0xCA07C2DCB0CF26F7,
+            0xC9BCFF6034C13052, 0xFC89B393DD02F0B5, 0xFC2C3F3841F17C67, 0xBBAC2078D443ACE2,
+            0x9D9BA7832936EDC0, 0xD54B944B84AA4C0D, 0xC5029163F384A931, 0x0A9E795E65D4DF11,
+            0xF64335BCF065D37D, 0x4D4617B5FF4A16D5, 0x99EA0196163FA42E, 0x504BCED1BF8E4E45,
+            0xC06481FB9BCF8D39, 0xE45EC2862F71E1D6, 0xF07DA27A82C37088, 0x5D767327BB4E5A4C,
+            0x964E858C91BA2655, 0x3A6A07F8D510F86F, 0xBBE226EFB628AFEA, 0x890489F70A55368B,
+            0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842E, 0x92C8AE6B464FC96F, 0x3B0B8BC90012929D,
+            0xB77ADA0617E3BBCB, 0x09CE6EBB40173744, 0xE55990879DDCAABD, 0xCC420A6A101D0515,
+            0x8F57FA54C2A9EAB6, 0x9FA946824A12232D, 0xB32DF8E9F3546564, 0x47939822DC96ABF9,
+            0xDFF9772470297EBD, 0x59787E2B93BC56F7, 0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65A,
+            0xAEFAE51477A06B03, 0xEDE622920B6B23F1, 0xDAB99E59958885C4, 0xE95FAB368E45ECED,
+            0x88B402F7FD75539B, 0x11DBCB0218EBB414, 0xAAE103B5FCD2A881, 0xD652BDC29F26A119,
+            0xD59944A37C0752A2, 0x4BE76D3346F0495F, 0x857FCAE62D8493A5, 0x6F70A4400C562DDB,
+            0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB952, 0xD097AD07A71F26B2, 0x7E2000A41346A7A7,
+            0x825ECC24C873782F, 0x8ED400668C0C28C8, 0xA2F67F2DFA90563B, 0x728900802F0F32FA,
+            0xCBB41EF979346BCA, 0x4F2B40A03AD2FFB9, 0xFEA126B7D78186BC, 0xE2F610C84987BFA8,
+            0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7C9, 0xC6EDE63FA05D3143, 0x91503D1C79720DBB,
+            0xF8A95FCF88747D94, 0x75A44C6397CE912A, 0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABA,
+            0xC24452DA229B021B, 0xFBE85BADCE996168, 0xF2D56790AB41C2A2, 0xFAE27299423FB9C3,
+            0x97C560BA6B0919A5, 0xDCCD879FC967D41A, 0xBDB6B8E905CB600F, 0x5400E987BBC1C920,
+            0xED246723473E3813, 0x290123E9AAB23B68, 0x9436C0760C86E30B, 0xF9A0B6720AAF6521,
+            0xB94470938FA89BCE, 0xF808E40E8D5B3E69, 0xE7958CB87392C2C2, 0xB60B1D1230B20E04,
+            0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C2, 0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF3,
+            0xE2280B6C20DD5232, 0x25C6DA63C38DE1B0, 0x8D590723948A535F, 0x579C487E5A38AD0E,
+            0xB0AF48EC79ACE837, 0x2D835A9DF0C6D851, 0xDCDB1B2798182244, 0xF8E431456CF88E65,
+            0x8A08F0F8BF0F156B, 0x1B8E9ECB641B58FF, 0xAC8B2D36EED2DAC5, 0xE272467E3D222F3F,
+            0xD7ADF884AA879177, 0x5B0ED81DCC6ABB0F, 0x86CCBB52EA94BAEA, 0x98E947129FC2B4E9,
+            0xA87FEA27A539E9A5, 0x3F2398D747B36224, 0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD,
+            0x83A3EEEEF9153E89, 0x1953CF68300424AC, 0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7,
+            0xCDB02555653131B6, 0x3792F412CB06794D, 0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0,
+            0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4, 0xC8DE047564D20A8B, 0xF245825A5A445275,
+            0xFB158592BE068D2E, 0xEED6E2F0F0D56712, 0x9CED737BB6C4183D, 0x55464DD69685606B,
+            0xC428D05AA4751E4C, 0xAA97E14C3C26B886, 0xF53304714D9265DF, 0xD53DD99F4B3066A8,
+            0x993FE2C6D07B7FAB, 0xE546A8038EFE4029, 0xBF8FDB78849A5F96, 0xDE98520472BDD033,
+            0xEF73D256A5C0F77C, 0x963E66858F6D4440, 0x95A8637627989AAD, 0xDDE7001379A44AA8,
+            0xBB127C53B17EC159, 0x5560C018580D5D52, 0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6,
+            0x9226712162AB070D, 0xCAB3961304CA70E8, 0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22,
+            0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A, 0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242,
+            0xB267ED1940F1C61C, 0x55F038B237591ED3, 0xDF01E85F912E37A3, 0x6B6C46DEC52F6688,
+            0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015, 0xAE397D8AA96C1B77, 0xABEC975E0A0D081A,
+            0xD9C7DCED53C72255, 0x96E7BD358C904A21, 0x881CEA14545C7575, 0x7E50D64177DA2E54,
+            0xAA242499697392D2, 0xDDE50BD1D5D0B9E9, 0xD4AD2DBFC3D07787, 0x955E4EC64B44E864,
+            0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E, 0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E,
+            0xCFB11EAD453994BA, 0x67DE18EDA5814AF2, 0x81CEB32C4B43FCF4, 0x80EACF948770CED7,
+            0xA2425FF75E14FC31, 0xA1258379A94D028D, 0xCAD2F7F5359A3B3E, 0x096EE45813A04330,
+            0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC, 0x9E74D1B791E07E48, 0x775EA264CF55347E,
+            0xC612062576589DDA, 0x95364AFE032A819E, 0xF79687AED3EEC551, 0x3A83DDBD83F52205,
+            0x9ABE14CD44753B52, 0xC4926A9672793543, 0xC16D9A0095928A27, 0x75B7053C0F178294,
+            0xF1C90080BAF72CB1, 0x5324C68B12DD6339, 0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04,
+            0xBCE5086492111AEA, 0x88F4BB1CA6BCF585, 0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6,
+            0x9392EE8E921D5D07, 0x3AFF322E62439FD0, 0xB877AA3236A4B449, 0x09BEFEB9FAD487C3,
+            0xE69594BEC44DE15B, 0x4C2EBE687989A9B4, 0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11,
+            0xB424DC35095CD80F, 0x538484C19EF38C95, 0xE12E13424BB40E13, 0x2865A5F206B06FBA,
+            0x8CBCCC096F5088CB, 0xF93F87B7442E45D4, 0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749,
+            0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C, 0x89705F4136B4A597, 0x31680A88F8953031,
+            0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E, 0xD6BF94D5E57A42BC, 0x3D32907604691B4D,
+            0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110, 0xA7C5AC471B478423, 0x0FCF80DC33721D54,
+            0xD1B71758E219652B, 0xD3C36113404EA4A9, 0x83126E978D4FDF3B, 0x645A1CAC083126EA,
+            0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4, 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD,
+            0x8000000000000000, 0x0000000000000000, 0xA000000000000000, 0x0000000000000000,
+            0xC800000000000000, 0x0000000000000000, 0xFA00000000000000, 0x0000000000000000,
+            0x9C40000000000000, 0x0000000000000000, 0xC350000000000000, 0x0000000000000000,
+            0xF424000000000000, 0x0000000000000000, 0x9896800000000000, 0x0000000000000000,
+            0xBEBC200000000000, 0x0000000000000000, 0xEE6B280000000000, 0x0000000000000000,
+            0x9502F90000000000, 0x0000000000000000, 0xBA43B74000000000, 0x0000000000000000,
+            0xE8D4A51000000000, 0x0000000000000000, 0x9184E72A00000000, 0x0000000000000000,
+            0xB5E620F480000000, 0x0000000000000000, 0xE35FA931A0000000, 0x0000000000000000,
+            0x8E1BC9BF04000000, 0x0000000000000000, 0xB1A2BC2EC5000000, 0x0000000000000000,
+            0xDE0B6B3A76400000, 0x0000000000000000, 0x8AC7230489E80000, 0x0000000000000000,
+            0xAD78EBC5AC620000, 0x0000000000000000, 0xD8D726B7177A8000, 0x0000000000000000,
+            0x878678326EAC9000, 0x0000000000000000, 0xA968163F0A57B400, 0x0000000000000000,
+            0xD3C21BCECCEDA100, 0x0000000000000000, 0x84595161401484A0, 0x0000000000000000,
+            0xA56FA5B99019A5C8, 0x0000000000000000, 0xCECB8F27F4200F3A, 0x0000000000000000,
+            0x813F3978F8940984, 0x4000000000000000, 0xA18F07D736B90BE5, 0x5000000000000000,
+            0xC9F2C9CD04674EDE, 0xA400000000000000, 0xFC6F7C4045812296, 0x4D00000000000000,
+            0x9DC5ADA82B70B59D, 0xF020000000000000, 0xC5371912364CE305, 0x6C28000000000000,
+            0xF684DF56C3E01BC6, 0xC732000000000000, 0x9A130B963A6C115C, 0x3C7F400000000000,
+            0xC097CE7BC90715B3, 0x4B9F100000000000, 0xF0BDC21ABB48DB20, 0x1E86D40000000000,
+            0x96769950B50D88F4, 0x1314448000000000, 0xBC143FA4E250EB31, 0x17D955A000000000,
+            0xEB194F8E1AE525FD, 0x5DCFAB0800000000, 0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000,
+            0xB7ABC627050305AD, 0xF14A3D9E40000000, 0xE596B7B0C643C719, 0x6D9CCD05D0000000,
+            0x8F7E32CE7BEA5C6F, 0xE4820023A2000000, 0xB35DBF821AE4F38B, 0xDDA2802C8A800000,
+            0xE0352F62A19E306E, 0xD50B2037AD200000, 0x8C213D9DA502DE45, 0x4526F422CC340000,
+            0xAF298D050E4395D6, 0x9670B12B7F410000, 0xDAF3F04651D47B4C, 0x3C0CDD765F114000,
+            0x88D8762BF324CD0F, 0xA5880A69FB6AC800, 0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00,
+            0xD5D238A4ABE98068, 0x72A4904598D6D880, 0x85A36366EB71F041, 0x47A6DA2B7F864750,
+            0xA70C3C40A64E6C51, 0x999090B65F67D924, 0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D,
+            0x82818F1281ED449F, 0xBFF8F10E7A8921A4, 0xA321F2D7226895C7, 0xAFF72D52192B6A0D,
+            0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490, 0xFEE50B7025C36A08, 0x02F236D04753D5B4,
+            0x9F4F2726179A2245, 0x01D762422C946590, 0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5,
+            0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2, 0x9B934C3B330C8577, 0x63CC55F49F88EB2F,
+            0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB, 0xF316271C7FC3908A, 0x8BEF464E3945EF7A,
+            0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AC, 0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA317,
+            0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDD, 0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6A,
+            0xB975D6B6EE39E436, 0xB3E2FD538E122B44, 0xE7D34C64A9C85D44, 0x60DBBCA87196B616,
+            0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CD, 0xB51D13AEA4A488DD, 0x6BABAB6398BDBE41,
+            0xE264589A4DCDAB14, 0xC696963C7EED2DD1, 0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA2,
+            0xB0DE65388CC8ADA8, 0x3B25A55F43294BCB, 0xDD15FE86AFFAD912, 0x49EF0EB713F39EBE,
+            0x8A2DBF142DFCC7AB, 0x6E3569326C784337, 0xACB92ED9397BF996, 0x49C2C37F07965404,
+            0xD7E77A8F87DAF7FB, 0xDC33745EC97BE906, 0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A3,
+            0xA8ACD7C0222311BC, 0xC40832EA0D68CE0C, 0xD2D80DB02AABD62B, 0xF50A3FA490C30190,
+            0x83C7088E1AAB65DB, 0x792667C6DA79E0FA, 0xA4B8CAB1A1563F52, 0x577001B891185938,
+            0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F86, 0x80B05E5AC60B6178, 0x544F8158315B05B4,
+            0xA0DC75F1778E39D6, 0x696361AE3DB1C721, 0xC913936DD571C84C, 0x03BC3A19CD1E38E9,
+            0xFB5878494ACE3A5F, 0x04AB48A04065C723, 0x9D174B2DCEC0E47B, 0x62EB0D64283F9C76,
+            0xC45D1DF942711D9A, 0x3BA5D0BD324F8394, 0xF5746577930D6500, 0xCA8F44EC7EE36479,
+            0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECB, 0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67E,
+            0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101E, 0x95D04AEE3B80ECE5, 0xBBA1F1D158724A12,
+            0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC97, 0xEA1575143CF97226, 0xF52D09D71A3293BD,
+            0x924D692CA61BE758, 0x593C2626705F9C56, 0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836C,
+            0xE498F455C38B997A, 0x0B6DFB9C0F956447, 0x8EDF98B59A373FEC, 0x4724BD4189BD5EAC,
+            0xB2977EE300C50FE7, 0x58EDEC91EC2CB657, 0xDF3D5E9BC0F653E1, 0x2F2967B66737E3ED,
+            0x8B865B215899F46C, 0xBD79E0D20082EE74, 0xAE67F1E9AEC07187, 0xECD8590680A3AA11,
+            0xDA01EE641A708DE9, 0xE80E6F4820CC9495, 0x884134FE908658B2, 0x3109058D147FDCDD,
+            0xAA51823E34A7EEDE, 0xBD4B46F0599FD415, 0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91A,
+            0x850FADC09923329E, 0x03E2CF6BC604DDB0, 0xA6539930BF6BFF45, 0x84DB8346B786151C,
+            0xCFE87F7CEF46FF16, 0xE612641865679A63, 0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07E,
+            0xA26DA3999AEF7749, 0xE3BE5E330F38F09D, 0xCB090C8001AB551C, 0x5CADF5BFD3072CC5,
+            0xFDCB4FA002162A63, 0x73D9732FC7C8F7F6, 0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFA,
+            0xC646D63501A1511D, 0xB281E1FD541501B8, 0xF7D88BC24209A565, 0x1F225A7CA91A4226,
+            0x9AE757596946075F, 0x3375788DE9B06958, 0xC1A12D2FC3978937, 0x0052D6B1641C83AE,
+            0xF209787BB47D6B84, 0xC0678C5DBD23A49A, 0x9745EB4D50CE6332, 0xF840B7BA963646E0,
+            0xBD176620A501FBFF, 0xB650E5A93BC3D898, 0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBE,
+            0x93BA47C980E98CDF, 0xC66F336C36B10137, 0xB8A8D9BBE123F017, 0xB80B0047445D4184,
+            0xE6D3102AD96CEC1D, 0xA60DC059157491E5, 0x9043EA1AC7E41392, 0x87C89837AD68DB2F,
+            0xB454E4A179DD1877, 0x29BABE4598C311FB, 0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67A,
+            0x8CE2529E2734BB1D, 0x1899E4A65F58660C, 0xB01AE745B101E9E4, 0x5EC05DCFF72E7F8F,
+            0xDC21A1171D42645D, 0x76707543F4FA1F73, 0x899504AE72497EBA, 0x6A06494A791C53A8,
+            0xABFA45DA0EDBDE69, 0x0487DB9D17636892, 0xD6F8D7509292D603, 0x45A9D2845D3C42B6,
+            0x865B86925B9BC5C2, 0x0B8A2392BA45A9B2, 0xA7F26836F282B732, 0x8E6CAC7768D7141E,
+            0xD1EF0244AF2364FF, 0x3207D795430CD926, 0x8335616AED761F1F, 0x7F44E6BD49E807B8,
+            0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A6, 0xCD036837130890A1, 0x36DBA887C37A8C0F,
+            0x802221226BE55A64, 0xC2494954DA2C9789, 0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6C,
+            0xC83553C5C8965D3D, 0x6F92829494E5ACC7, 0xFA42A8B73ABBF48C, 0xCB772339BA1F17F9,
+            0x9C69A97284B578D7, 0xFF2A760414536EFB, 0xC38413CF25E2D70D, 0xFEF5138519684ABA,
+            0xF46518C2EF5B8CD1, 0x7EB258665FC25D69, 0x98BF2F79D5993802, 0xEF2F773FFBD97A61,
+            0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FA, 0xEEAABA2E5DBF6784, 0x95BA2A53F983CF38,
+            0x952AB45CFA97A0B2, 0xDD945A747BF26183, 0xBA756174393D88DF, 0x94F971119AEEF9E4,
+            0xE912B9D1478CEB17, 0x7A37CD5601AAB85D, 0x91ABB422CCB812EE, 0xAC62E055C10AB33A,
+            0xB616A12B7FE617AA, 0x577B986B314D6009, 0xE39C49765FDF9D94, 0xED5A7E85FDA0B80B,
+            0x8E41ADE9FBEBC27D, 0x14588F13BE847307, 0xB1D219647AE6B31C, 0x596EB2D8AE258FC8,
+            0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BB, 0x8AEC23D680043BEE, 0x25DE7BB9480D5854,
+            0xADA72CCC20054AE9, 0xAF561AA79A10AE6A, 0xD910F7FF28069DA4, 0x1B2BA1518094DA04,
+            0x87AA9AFF79042286, 0x90FB44D2F05D0842, 0xA99541BF57452B28, 0x353A1607AC744A53,
+            0xD3FA922F2D1675F2, 0x42889B8997915CE8, 0x847C9B5D7C2E09B7, 0x69956135FEBADA11,
+            0xA59BC234DB398C25, 0x43FAB9837E699095, 0xCF02B2C21207EF2E, 0x94F967E45E03F4BB,
+            0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F5, 0xA1BA1BA79E1632DC, 0x6462D92A69731732,
+            0xCA28A291859BBF93, 0x7D7B8F7503CFDCFE, 0xFCB2CB35E702AF78, 0x5CDA735244C3D43E,
+            0x9DEFBF01B061ADAB, 0x3A0888136AFA64A7, 0xC56BAEC21C7A1916, 0x088AAA1845B8FDD0,
+            0xF6C69A72A3989F5B, 0x8AAD549E57273D45, 0x9A3C2087A63F6399, 0x36AC54E2F678864B,
+            0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DD, 0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D5,
+            0x969EB7C47859E743, 0x9F644AE5A4B1B325, 0xBC4665B596706114, 0x873D5D9F0DDE1FEE,
+            0xEB57FF22FC0C7959, 0xA90CB506D155A7EA, 0x9316FF75DD87CBD8, 0x09A7F12442D588F2,
+            0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB2F, 0xE5D3EF282A242E81, 0x8F1668C8A86DA5FA,
+            0x8FA475791A569D10, 0xF96E017D694487BC, 0xB38D92D760EC4455, 0x37C981DCC395A9AC,
+            0xE070F78D3927556A, 0x85BBE253F47B1417, 0x8C469AB843B89562, 0x93956D7478CCEC8E,
+            0xAF58416654A6BABB, 0x387AC8D1970027B2, 0xDB2E51BFE9D0696A, 0x06997B05FCC0319E,
+            0x88FCF317F22241E2, 0x441FECE3BDF81F03, 0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C3,
+            0xD60B3BD56A5586F1, 0x8A71E223D8D3B074, 0x85C7056562757456, 0xF6872D5667844E49,
+            0xA738C6BEBB12D16C, 0xB428F8AC016561DB, 0xD106F86E69D785C7, 0xE13336D701BEBA52,
+            0x82A45B450226B39C, 0xECC0024661173473, 0xA34D721642B06084, 0x27F002D7F95D0190,
+            0xCC20CE9BD35C78A5, 0x31EC038DF7B441F4, 0xFF290242C83396CE, 0x7E67047175A15271,
+            0x9F79A169BD203E41, 0x0F0062C6E984D386, 0xC75809C42C684DD1, 0x52C07B78A3E60868,
+            0xF92E0C3537826145, 0xA7709A56CCDF8A82, 0x9BBCC7A142B17CCB, 0x88A66076400BB691,
+            0xC2ABF989935DDBFE, 0x6ACFF893D00EA435, 0xF356F7EBF83552FE, 0x0583F6B8C4124D43,
+            0x98165AF37B2153DE, 0xC3727A337A8B704A, 0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5C,
+            0xEDA2EE1C7064130C, 0x1162DEF06F79DF73, 0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA8,
+            0xB9A74A0637CE2EE1, 0x6D953E2BD7173692, 0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0437,
+            0x910AB1D4DB9914A0, 0x1D9C9892400A22A2, 0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4B,
+            0xE2A0B5DC971F303A, 0x2E44AE64840FD61D, 0x8DA471A9DE737E24, 0x5CEAECFED289E5D2,
+            0xB10D8E1456105DAD, 0x7425A83E872C5F47, 0xDD50F1996B947518, 0xD12F124E28F77719,
+            0x8A5296FFE33CC92F, 0x82BD6B70D99AAA6F, 0xACE73CBFDC0BFB7B, 0x636CC64D1001550B,
+            0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4E, 0x8714A775E3E95C78, 0x65ACFAEC34810A71,
+            0xA8D9D1535CE3B396, 0x7F1839A741A14D0D, 0xD31045A8341CA07C, 0x1EDE48111209A050,
+            0x83EA2B892091E44D, 0x934AED0AAB460432, 0xA4E4B66B68B65D60, 0xF81DA84D5617853F,
+            0xCE1DE40642E3F4B9, 0x36251260AB9D668E, 0x80D2AE83E9CE78F3, 0xC1D72B7C6B426019,
+            0xA1075A24E4421730, 0xB24CF65B8612F81F, 0xC94930AE1D529CFC, 0xDEE033F26797B627,
+            0xFB9B7CD9A4A7443C, 0x169840EF017DA3B1, 0x9D412E0806E88AA5, 0x8E1F289560EE864E,
+            0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E2, 0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DB,
+            0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF29, 0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF3,
+            0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B0, 0x95F83D0A1FB69CD9, 0x4ABDAF101564F98E,
+            0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F1, 0xEA53DF5FD18D5513, 0x84C86189216DC5ED,
+            0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB4, 0xB7118682DBB66A77, 0x3FBC8C33221DC2A1,
+            0xE4D5E82392A40515, 0x0FABAF3FEAA5334A, 0x8F05B1163BA6832D, 0x29CB4D87F2A7400E,
+            0xB2C71D5BCA9023F8, 0x743E20E9EF511012, 0xDF78E4B2BD342CF6, 0x914DA9246B255416,
+            0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548E, 0xAE9672ABA3D0C320, 0xA184AC2473B529B1,
+            0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741E, 0x8865899617FB1871, 0x7E2FA67C7A658892,
+            0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB7, 0xD51EA6FA85785631, 0x552A74227F3EA565,
+            0x8533285C936B35DE, 0xD53A88958F87275F, 0xA67FF273B8460356, 0x8A892ABAF368F137,
+            0xD01FEF10A657842C, 0x2D2B7569B0432D85, 0x8213F56A67F6B29B, 0x9C3B29620E29FC73,
+            0xA298F2C501F45F42, 0x8349F3BA91B47B8F, 0xCB3F2F7642717713, 0x241C70A936219A73,
+            0xFE0EFB53D30DD4D7, 0xED238CD383AA0110, 0x9EC95D1463E8A506, 0xF4363804324A40AA,
+            0xC67BB4597CE2CE48, 0xB143C6053EDCD0D5, 0xF81AA16FDC1B81DA, 0xDD94B7868E94050A,
+            0x9B10A4E5E9913128, 0xCA7CF2B4191C8326, 0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F0,
+            0xF24A01A73CF2DCCF, 0xBC633B39673C8CEC, 0x976E41088617CA01, 0xD5BE0503E085D813,
+            0xBD49D14AA79DBC82, 0x4B2D8644D8A74E18, 0xEC9C459D51852BA2, 0xDDF8E7D60ED1219E,
+            0x93E1AB8252F33B45, 0xCABB90E5C942B503, 0xB8DA1662E7B00A17, 0x3D6A751F3B936243,
+            0xE7109BFBA19C0C9D, 0x0CC512670A783AD4, 0x906A617D450187E2, 0x27FB2B80668B24C5,
+            0xB484F9DC9641E9DA, 0xB1F9F660802DEDF6, 0xE1A63853BBD26451, 0x5E7873F8A0396973,
+            0x8D07E33455637EB2, 0xDB0B487B6423E1E8, 0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA62,
+            0xDC5C5301C56B75F7, 0x7641A140CC7810FB, 0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9D,
+            0xAC2820D9623BF429, 0x546345FA9FBDCD44, 0xD732290FBACAF133, 0xA97C177947AD4095,
+            0x867F59A9D4BED6C0, 0x49ED8EABCCCC485D, 0xA81F301449EE8C70, 0x5C68F256BFFF5A74,
+            0xD226FC195C6A2F8C, 0x73832EEC6FFF3111, 0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAB,
+            0xA42E74F3D032F525, 0xBA3E7CA8B77F5E55, 0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EB,
+            0x80444B5E7AA7CF85, 0x7980D163CF5B81B3, 0xA0555E361951C366, 0xD7E105BCC332621F,
+            0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA7, 0xFA856334878FC150, 0xB14F98F6F0FEB951,
+            0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D3, 0xC3B8358109E84F07, 0x0A862F80EC4700C8,
+            0xF4A642E14C6262C8, 0xCD27BB612758C0FA, 0x98E7E9CCCFBD7DBD, 0x8038D51CB897789C,
+            0xBF21E44003ACDD2C, 0xE0470A63E6BD56C3, 0xEEEA5D5004981478, 0x1858CCFCE06CAC74,
+            0x95527A5202DF0CCB, 0x0F37801E0C43EBC8, 0xBAA718E68396CFFD, 0xD30560258F54E6BA,
+            0xE950DF20247C83FD, 0x47C6B82EF32A2069, 0x91D28B7416CDD27E, 0x4CDC331D57FA5441,
+            0xB6472E511C81471D, 0xE0133FE4ADF8E952, 0xE3D8F9E563A198E5, 0x58180FDDD97723A6,
+            0x8E679C2F5E44FF8F, 0x570F09EAA7EA7648 };
+
+        // The powers of ten that are exactly representable as doubles.
+        alignas( 64 ) const double exactPowerOfTen[ 23 ] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                                             1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+        // Entry n of decimalLeftShiftTable holds, in its upper five bits, the number of digits that a left shift by n
+        // bits adds to a decimal, and in its lower eleven bits, the offset of the digits of 5^n in
+        // decimalLeftShiftPowerOfFive. A decimal whose leading digits are less than those of 5^n gains one digit fewer.
+        const uint16 decimalLeftShiftTable[ 65 ] = {
+            0x0000, 0x0800, 0x0801, 0x0803, 0x1006, 0x1009, 0x100D, 0x1812, 0x1817, 0x181D,
+            0x2024, 0x202B, 0x2033, 0x203C, 0x2846, 0x2850, 0x285B, 0x3067, 0x3073, 0x3080,
+            0x388E, 0x389C, 0x38AB, 0x38BB, 0x40CC, 0x40DD, 0x40EF, 0x4902, 0x4915, 0x4929,
+            0x513E, 0x5153, 0x5169, 0x5180, 0x5998, 0x59B0, 0x59C9, 0x61E3, 0x61FD, 0x6218,
+            0x6A34, 0x6A50, 0x6A6D, 0x6A8B, 0x72AA, 0x72C9, 0x72E9, 0x7B0A, 0x7B2B, 0x7B4D,
+            0x8370, 0x8393, 0x83B7, 0x83DC, 0x8C02, 0x8C28, 0x8C4F, 0x9477, 0x949F, 0x94C8,
+            0x9CF2, 0x9D1C, 0x9D1C, 0x9D1C, 0xA51C };
+
+        const uint8 decimalLeftShiftPowerOfFive[ 1308 ] = {
+            5, 2, 5, 1, 2, 5, 6, 2, 5, 3, 1, 2, 5, 1, 5, 6, 2, 5, 7, 8, 1, 2, 5, 3, 9, 0, 6, 2, 5, 1, 9, 5, 3, 1, 2, 5, 9, 7, 6, 5,
+            6, 2, 5, 4, 8, 8, 2, 8, 1, 2, 5, 2, 4, 4, 1, 4, 0, 6, 2, 5, 1, 2, 2, 0, 7, 0, 3, 1, 2, 5, 6, 1, 0, 3, 5, 1, 5, 6, 2, 5,
+            3, 0, 5, 1, 7, 5, 7, 8, 1, 2, 5, 1, 5, 2, 5, 8, 7, 8, 9, 0, 6, 2, 5, 7, 6, 2, 9, 3, 9, 4, 5, 3, 1, 2, 5, 3, 8, 1, 4, 6,
+            9, 7, 2, 6, 5, 6, 2, 5, 1, 9, 0, 7, 3, 4, 8, 6, 3, 2, 8, 1, 2, 5, 9, 5, 3, 6, 7, 4, 3, 1, 6, 4, 0, 6, 2, 5, 4, 7, 6, 8,
+            3, 7, 1, 5, 8, 2, 0, 3, 1, 2, 5, 2, 3, 8, 4, 1, 8, 5, 7, 9, 1, 0, 1, 5, 6, 2, 5, 1, 1, 9, 2, 0, 9, 2, 8, 9, 5, 5, 0, 7,
+            8, 1, 2, 5, 5, 9, 6, 0, 4, 6, 4, 4, 7, 7, 5, 3, 9, 0, 6, 2, 5, 2, 9, 8, 0, 2, 3, 2, 2, 3, 8, 7, 6, 9, 5, 3, 1, 2, 5, 1,
+            4, 9, 0, 1, 1, 6, 1, 1, 9, 3, 8, 4, 7, 6, 5, 6, 2, 5, 7, 4, 5, 0, 5, 8, 0, 5, 9, 6, 9, 2, 3, 8, 2, 8, 1, 2, 5, 3, 7, 2,
+            5, 2, 9, 0, 2, 9, 8, 4, 6, 1, 9, 1, 4, 0, 6, 2, 5, 1, 8, 6, 2, 6, 4, 5, 1, 4, 9, 2, 3, 0, 9, 5, 7, 0, 3, 1, 2, 5, 9, 3,
+            1, 3, 2, 2, 5, 7, 4, 6, 1, 5, 4, 7, 8, 5, 1, 5, 6, 2, 5, 4, 6, 5, 6, 6, 1, 2, 8, 7, 3, 0, 7, 7, 3, 9, 2, 5, 7, 8, 1, 2,
+            5, 2, 3, 2, 8, 3, 0, 6, 4, 3, 6, 5, 3, 8, 6, 9, 6, 2, 8, 9, 0, 6, 2, 5, 1, 1, 6, 4, 1, 5, 3, 2, 1, 8, 2, 6, 9, 3, 4, 8,
+            1, 4, 4, 5, 3, 1, 2, 5, 5, 8, 2, 0, 7, 6, 6, 0, 9, 1, 3, 4, 6, 7, 4, 0, 7, 2, 2, 6, 5, 6, 2, 5, 2, 9, 1, 0, 3, 8, 3, 0,
+            4, 5, 6, 7, 3, 3, 7, 0, 3, 6, 1, 3, 2, 8, 1, 2, 5, 1, 4, 5, 5, 1, 9, 1, 5, 2, 2, 8, 3, 6, 6, 8, 5, 1, 8, 0, 6, 6, 4, 0,
+            6, 2, 5, 7, 2, 7, 5, 9, 5, 7, 6, 1, 4, 1, 8, 3, 4, 2, 5, 9, 0, 3, 3, 2, 0, 3, 1, 2, 5, 3, 6, 3, 7, 9, 7, 8, 8, 0, 7, 0,
+            9, 1, 7, 1, 2, 9, 5, 1, 6, 6, 0, 1, 5, 6, 2, 5, 1, 8, 1, 8, 9, 8, 9, 4, 0, 3, 5, 4, 5, 8, 5, 6, 4, 7, 5, 8, 3, 0, 0, 7,
+            8, 1, 2, 5, 9, 0, 9, 4, 9, 4, 7, 0, 1, 7, 7, 2, 9, 2, 8, 2, 3, 7, 9, 1, 5, 0, 3, 9, 0, 6, 2, 5, 4, 5, 4, 7, 4, 7, 3, 5,
+            0, 8, 8, 6, 4, 6, 4, 1, 1, 8, 9, 5, 7, 5, 1, 9, 5, 3, 1, 2, 5, 2, 2, 7, 3, 7, 3, 6, 7, 5, 4, 4, 3, 2, 3, 2, 0, 5, 9, 4,
+            7, 8, 7, 5, 9, 7, 6, 5, 6, 2, 5, 1, 1, 3, 6, 8, 6, 8, 3, 7, 7, 2, 1, 6, 1, 6, 0, 2, 9, 7, 3, 9, 3, 7, 9, 8, 8, 2, 8, 1,
+            2, 5, 5, 6, 8, 4, 3, 4, 1, 8, 8, 6, 0, 8, 0, 8, 0, 1, 4, 8, 6, 9, 6, 8, 9, 9, 4, 1, 4, 0, 6, 2, 5, 2, 8, 4, 2, 1, 7, 0,
+            9, 4, 3, 0, 4, 0, 4, 0, 0, 7, 4, 3, 4, 8, 4, 4, 9, 7, 0, 7, 0, 3, 1, 2, 5, 1, 4, 2, 1, 0, 8, 5, 4, 7, 1, 5, 2, 0, 2, 0,
+            0, 3, 7, 1, 7, 4, 2, 2, 4, 8, 5, 3, 5, 1, 5, 6, 2, 5, 7, 1, 0, 5, 4, 2, 7, 3, 5, 7, 6, 0, 1, 0, 0, 1, 8, 5, 8, 7, 1, 1,
+            2, 4, 2, 6, 7, 5, 7, 8, 1, 2, 5, 3, 5, 5, 2, 7, 1, 3, 6, 7, 8, 8, 0, 0, 5, 0, 0, 9, 2, 9, 3, 5, 5, 6, 2, 1, 3, 3, 7, 8,
+            9, 0, 6, 2, 5, 1, 7, 7, 6, 3, 5, 6, 8, 3, 9, 4, 0, 0, 2, 5, 0, 4, 6, 4, 6, 7, 7, 8, 1, 0, 6, 6, 8, 9, 4, 5, 3, 1, 2, 5,
+            8, 8, 8, 1, 7, 8, 4, 1, 9, 7, 0, 0, 1, 2, 5, 2, 3, 2, 3, 3, 8, 9, 0, 5, 3, 3, 4, 4, 7, 2, 6, 5, 6, 2, 5, 4, 4, 4, 0, 8,
+            9, 2, 0, 9, 8, 5, 0, 0, 6, 2, 6, 1, 6, 1, 6, 9, 4, 5, 2, 6, 6, 7, 2, 3, 6, 3, 2, 8, 1, 2, 5, 2, 2, 2, 0, 4, 4, 6, 0, 4,
+            9, 2, 5, 0, 3, 1, 3, 0, 8, 0, 8, 4, 7, 2, 6, 3, 3, 3, 6, 1, 8, 1, 6, 4, 0, 6, 2, 5, 1, 1, 1, 0, 2, 2, 3, 0, 2, 4, 6, 2,
+            5, 1, 5, 6, 5, 4, 0, 4, 2, 3, 6, 3, 1, 6, 6, 8, 0, 9, 0, 8, 2, 0, 3, 1, 2, 5, 5, 5, 5, 1, 1, 1, 5, 1, 2, 3, 1, 2, 5, 7,
+            8, 2, 7, 0, 2, 1, 1, 8, 1, 5, 8, 3, 4, 0, 4, 5, 4, 1, 0, 1, 5, 6, 2, 5, 2, 7, 7, 5, 5, 5, 7, 5, 6, 1, 5, 6, 2, 8, 9, 1,
+            3, 5, 1, 0, 5, 9, 0, 7, 9, 1, 7, 0, 2, 2, 7, 0, 5, 0, 7, 8, 1, 2, 5, 1, 3, 8, 7, 7, 7, 8, 7, 8, 0, 7, 8, 1, 4, 4, 5, 6,
+            7, 5, 5, 2, 9, 5, 3, 9, 5, 8, 5, 1, 1, 3, 5, 2, 5, 3, 9, 0, 6, 2, 5, 6, 9, 3, 8, 8, 9, 3, 9, 0, 3, 9, 0, 7, 2, 2, 8, 3,
+            7, 7, 6, 4, 7, 6, 9, 7, 9, 2, 5, 5, 6, 7, 6, 2, 6, 9, 5, 3, 1, 2, 5, 3, 4, 6, 9, 4, 4, 6, 9, 5, 1, 9, 5, 3, 6, 1, 4, 1,
+            8, 8, 8, 2, 3, 8, 4, 8, 9, 6, 2, 7, 8, 3, 8, 1, 3, 4, 7, 6, 5, 6, 2, 5, 1, 7, 3, 4, 7, 2, 3, 4, 7, 5, 9, 7, 6, 8, 0, 7,
+            0, 9, 4, 4, 1, 1, 9, 2, 4, 4, 8, 1, 3, 9, 1, 9, 0, 6, 7, 3, 8, 2, 8, 1, 2, 5, 8, 6, 7, 3, 6, 1, 7, 3, 7, 9, 8, 8, 4, 0,
+            3, 5, 4, 7, 2, 0, 5, 9, 6, 2, 2, 4, 0, 6, 9, 5, 9, 5, 3, 3, 6, 9, 1, 4, 0, 6, 2, 5 };
+
+        constexpr uint8 space          = 0x20;
+        constexpr uint8 tab            = 0x09;
+        constexpr uint8 newLine        = 0x0A;
+        constexpr uint8 carriageReturn = 0x0D;
+
+        class StringValue;
+        class NumberValue;
+        class BoolValue;
+        class NullValue;
+        class ArrayValue;
+
+        void ExpandArray( Array<char>& array, const char c, const uint32 n )
+        {
+            for ( uint32 a = 0; a != n; a++ )
+            {
+                array.AppendArrayElement( c );
+            }
+        }
+
+        // Writes a string enclosed in double quotes, escaping the characters that cannot appear in a JSON string
+        // literal, and the delete character, which the parser does not accept unescaped. Runs of characters that need
+        // no escaping are written with a single copy. The string is given by its length, because strings borrowed from
+        // the parsed text are not null-terminated.
+        void WriteStringLiteral( OutputSink& sink, const char* text, int32 length ) noexcept
+        {
+            static const char hexadecimalDigit[] = "0123456789ABCDEF";
+
+            sink << '"';
+
+            const char* run = text;
+            for ( const char* end = text + length; text != end; text++ )
+            {
+                uint8 c = uint8( text[ 0 ] );
+                if ( c >= 0x20 && c != '"' && c != '\\' && c != 0x7F )
+                {
+                    continue;
+                }
+
+                sink.Write( run, uint64( text - run ) );
+
+                switch ( c )
+                {
+                case '"':
+                    sink << "\\\"";
+                    break;
+                case '\\':
+                    sink << "\\\\";
+                    break;
+                case '\b':
+                    sink << "\\b";
+                    break;
+                case '\f':
+                    sink << "\\f";
+                    break;
+                case '\n':
+                    sink << "\\n";
+                    break;
+                case '\r':
+                    sink << "\\r";
+                    break;
+                case '\t':
+                    sink << "\\t";
+                    break;
+                default:
+                    sink << "\\u00" << hexadecimalDigit[ c >> 4 ] << hexadecimalDigit[ c & 15 ];
+                    break;
+                }
+
+                run = text + 1;
+            }
+
+            sink.Write( run, uint64( text - run ) );
+            sink << '"';
+        }
+
+        inline bool IsWhitespace( uint32 c ) noexcept
+        {
+            return c == space || c == tab || c == newLine || c == carriageReturn;
+        }
+
+#if defined( TERATHON_AVX ) && defined( __AVX2__ )
+
+#    define JSON4C4_SIMD
+
+        constexpr machine_address kSimdBlockSize       = 32;
+        constexpr uint32          kSimdMaskBitsPerByte = 1;
+
+        // Returns a mask with the bits set for the characters in an aligned block that are not whitespace.
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeNonWhitespaceMask( const uint8* block ) noexcept
+        {
+            __m256i v = _mm256_load_si256( reinterpret_cast<const __m256i*>( block ) );
+
+            __m256i spaceOrTab      = _mm256_or_si256( _mm256_cmpeq_epi8( v, _mm256_set1_epi8( space ) ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( tab ) ) );
+            __m256i newLineOrReturn = _mm256_or_si256( _mm256_cmpeq_epi8( v, _mm256_set1_epi8( newLine ) ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( carriageReturn ) ) );
+            uint32  whitespaceMask  = uint32( _mm256_movemask_epi8( _mm256_or_si256( spaceOrTab, newLineOrReturn ) ) );
+
+            return uint64( ~whitespaceMask );
+        }
+
+        // Returns a mask with the bits set for the characters in an aligned block that end a plain run in a string
+        // literal: double quotes, backslashes, control characters, DEL, and all non-ASCII bytes.
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeStringSpecialMask( const uint8* block ) noexcept
+        {
+            __m256i v = _mm256_load_si256( reinterpret_cast<const __m256i*>( block ) );
+
+            // The signed compare catches both the control characters and the bytes with the high bit set.
+            __m256i quoteOrBackslash = _mm256_or_si256( _mm256_cmpeq_epi8( v, _mm256_set1_epi8( '"' ) ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( '\\' ) ) );
+            __m256i controlOrDelete  = _mm256_or_si256( _mm256_cmpgt_epi8( _mm256_set1_epi8( 0x20 ), v ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( 0x7F ) ) );
+
+            return uint64( uint32( _mm256_movemask_epi8( _mm256_or_si256( quoteOrBackslash, controlOrDelete ) ) ) );
+        }
+
+        // Returns a mask with the bits set for the characters in an aligned block that a value is skipped by: double
+        // quotes, backslashes, brackets, braces, and the null terminator. Setting bit 5 folds '[' and ']' onto '{'
+        // and '}', and no other character folds onto them.
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeStructuralMask( const uint8* block ) noexcept
+        {
+            __m256i v = _mm256_load_si256( reinterpret_cast<const __m256i*>( block ) );
+
+            __m256i folded           = _mm256_or_si256( v, _mm256_set1_epi8( 0x20 ) );
+            __m256i quoteOrBackslash = _mm256_or_si256( _mm256_cmpeq_epi8( v, _mm256_set1_epi8( '"' ) ), _mm256_cmpeq_epi8( v, _mm256_set1_epi8( '\\' ) ) );
+            __m256i bracketOrBrace   = _mm256_or_si256( _mm256_cmpeq_epi8( folded, _mm256_set1_epi8( '{' ) ),
+                                                        _mm256_cmpeq_epi8( folded, _mm256_set1_epi8( '}' ) ) );
+            __m256i terminator       = _mm256_cmpeq_epi8( v, _mm256_setzero_si256() );
+
+            return uint64( uint32( _mm256_movemask_epi8( _mm256_or_si256( _mm256_or_si256( quoteOrBackslash, bracketOrBrace ), terminator ) ) ) );
+        }
+
+#elif defined( TERATHON_SSE )
+
+#    define JSON4C4_SIMD
+
+        constexpr machine_address kSimdBlockSize       = 16;
+        constexpr uint32          kSimdMaskBitsPerByte = 1;
+
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeNonWhitespaceMask( const uint8* block ) noexcept
+        {
+            __m128i v = _mm_load_si128( reinterpret_cast<const __m128i*>( block ) );
+
+            __m128i spaceOrTab      = _mm_or_si128( _mm_cmpeq_epi8( v, _mm_set1_epi8( space ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( tab ) ) );
+            __m128i newLineOrReturn = _mm_or_si128( _mm_cmpeq_epi8( v, _mm_set1_epi8( newLine ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( carriageReturn ) ) );
+            uint32  whitespaceMask  = uint32( _mm_movemask_epi8( _mm_or_si128( spaceOrTab, newLineOrReturn ) ) );
+
+            return uint64( ~whitespaceMask & 0xFFFF );
+        }
+
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeStringSpecialMask( const uint8* block ) noexcept
+        {
+            __m128i v = _mm_load_si128( reinterpret_cast<const __m128i*>( block ) );
+
+            __m128i quoteOrBackslash = _mm_or_si128( _mm_cmpeq_epi8( v, _mm_set1_epi8( '"' ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( '\\' ) ) );
+            __m128i controlOrDelete  = _mm_or_si128( _mm_cmplt_epi8( v, _mm_set1_epi8( 0x20 ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( 0x7F ) ) );
+
+            return uint64( uint32( _mm_movemask_epi8( _mm_or_si128( quoteOrBackslash, controlOrDelete ) ) ) );
+        }
+
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeStructuralMask( const uint8* block ) noexcept
+        {
+            __m128i v = _mm_load_si128( reinterpret_cast<const __m128i*>( block ) );
+
+            __m128i folded           = _mm_or_si128( v, _mm_set1_epi8( 0x20 ) );
+            __m128i quoteOrBackslash = _mm_or_si128( _mm_cmpeq_epi8( v, _mm_set1_epi8( '"' ) ), _mm_cmpeq_epi8( v, _mm_set1_epi8( '\\' ) ) );
+            __m128i bracketOrBrace   = _mm_or_si128( _mm_cmpeq_epi8( folded, _mm_set1_epi8( '{' ) ), _mm_cmpeq_epi8( folded, _mm_set1_epi8( '}' ) ) );
+            __m128i terminator       = _mm_cmpeq_epi8( v, _mm_setzero_si128() );
+
+            return uint64( uint32( _mm_movemask_epi8( _mm_or_si128( _mm_or_si128( quoteOrBackslash, bracketOrBrace ), terminator ) ) ) );
+        }
+
+#elif defined( TERATHON_NEON )
+
+#    define JSON4C4_SIMD
+
+        constexpr machine_address kSimdBlockSize       = 16;
+        constexpr uint32          kSimdMaskBitsPerByte = 4;
+
+        // NEON has no movemask, so the comparison result is narrowed to four bits per character instead.
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeNonWhitespaceMask( const uint8* block ) noexcept
+        {
+            uint8x16_t v = vld1q_u8( block );
+
+            uint8x16_t spaceOrTab      = vorrq_u8( vceqq_u8( v, vdupq_n_u8( space ) ), vceqq_u8( v, vdupq_n_u8( tab ) ) );
+            uint8x16_t newLineOrReturn = vorrq_u8( vceqq_u8( v, vdupq_n_u8( newLine ) ), vceqq_u8( v, vdupq_n_u8( carriageReturn ) ) );
+            uint8x8_t  narrowed        = vshrn_n_u16( vreinterpretq_u16_u8( vorrq_u8( spaceOrTab, newLineOrReturn ) ), 4 );
+
+            return ~vget_lane_u64( vreinterpret_u64_u8( narrowed ), 0 );
+        }
+
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeStringSpecialMask( const uint8* block ) noexcept
+        {
+            uint8x16_t v = vld1q_u8( block );
+
+            uint8x16_t quoteOrBackslash = vorrq_u8( vceqq_u8( v, vdupq_n_u8( '"' ) ), vceqq_u8( v, vdupq_n_u8( '\\' ) ) );
+            uint8x16_t controlOrDelete  = vorrq_u8( vcltq_s8( vreinterpretq_s8_u8( v ), vdupq_n_s8( 0x20 ) ), vceqq_u8( v, vdupq_n_u8( 0x7F ) ) );
+            uint8x8_t  narrowed         = vshrn_n_u16( vreinterpretq_u16_u8( vorrq_u8( quoteOrBackslash, controlOrDelete ) ), 4 );
+
+            return vget_lane_u64( vreinterpret_u64_u8( narrowed ), 0 );
+        }
+
+        JSON4C4_NO_SANITIZE_ADDRESS inline uint64 ComputeStructuralMask( const uint8* block ) noexcept
+        {
+            uint8x16_t v = vld1q_u8( block );
+
+            uint8x16_t folded           = vorrq_u8( v, vdupq_n_u8( 0x20 ) );
+            uint8x16_t quoteOrBackslash = vorrq_u8( vceqq_u8( v, vdupq_n_u8( '"' ) ), vceqq_u8( v, vdupq_n_u8( '\\' ) ) );
+            uint8x16_t bracketOrBrace   = vorrq_u8( vceqq_u8( folded, vdupq_n_u8( '{' ) ), vceqq_u8( folded, vdupq_n_u8( '}' ) ) );
+            uint8x16_t terminator       = vceqq_u8( v, vdupq_n_u8( 0 ) );
+            uint8x8_t  narrowed         = vshrn_n_u16( vreinterpretq_u16_u8( vorrq_u8( vorrq_u8( quoteOrBackslash, bracketOrBrace ), terminator ) ), 4 );
+
+            return vget_lane_u64( vreinterpret_u64_u8( narrowed ), 0 );
+        }
+
+#endif
+
+        inline uint32 CountTrailingZeros( uint64 x ) noexcept
+        {
+#if defined( _MSC_VER )
+            unsigned long index;
+
+            if ( _BitScanForward( &index, (unsigned long)( x ) ) )
+            {
+                return uint32( index );
+            }
+
+            _BitScanForward( &index, (unsigned long)( x >> 32 ) );
+            return uint32( index ) + 32;
+#else
+            return uint32( __builtin_ctzll( x ) );
+#endif
+        }
+
+        int32 ComputeWhitespaceLength( const char* text ) noexcept
+        {
+            const uint8* byte = reinterpret_cast<const uint8*>( text );
+
+            // Most tokens are separated by no whitespace or by a single space, so the first two characters are
+            // checked before any vector work is done.
+            if ( !IsWhitespace( byte[ 0 ] ) )
+            {
+                return 0;
+            }
+
+            if ( !IsWhitespace( byte[ 1 ] ) )
+            {
+                return 1;
+            }
+
+            byte += 2;
+
+#ifdef JSON4C4_SIMD
+
+            // Blocks are loaded from aligned addresses, so a load never crosses into the next page. The null
+            // terminator is not whitespace, which ends the scan in the block that contains it, so no block that lies
+            // entirely past the end of the text is read.
+            const uint8* block = reinterpret_cast<const uint8*>( machine_address( byte ) & ~( kSimdBlockSize - 1 ) );
+            uint64       mask  = ComputeNonWhitespaceMask( block ) >> ( uint32( byte - block ) * kSimdMaskBitsPerByte );
+
+            while ( mask == 0 )
+            {
+                block += kSimdBlockSize;
+                byte = block;
+                mask = ComputeNonWhitespaceMask( block );
+            }
+
+            byte += CountTrailingZeros( mask ) / kSimdMaskBitsPerByte;
+
+#else
+
+            while ( IsWhitespace( byte[ 0 ] ) )
+            {
+                byte++;
+            }
+
+#endif
+
+            return int32( reinterpret_cast<const char*>( byte ) - text );
+        }
+
+        // Returns the number of characters at the beginning of the text that can be copied from a string literal
+        // unchanged. The run ends at the first double quote, backslash, control character, DEL, or non-ASCII byte,
+        // and the null terminator always ends it, so the same page argument as for whitespace applies.
+        inline int32 ComputeStringRunLength( const char* text ) noexcept
+        {
+            const uint8* byte = reinterpret_cast<const uint8*>( text );
+
+#ifdef JSON4C4_SIMD
+
+            const uint8* block = reinterpret_cast<const uint8*>( machine_address( byte ) & ~( kSimdBlockSize - 1 ) );
+            uint64       mask  = ComputeStringSpecialMask( block ) >> ( uint32( byte - block ) * kSimdMaskBitsPerByte );
+
+            while ( mask == 0 )
+            {
+                block += kSimdBlockSize;
+                byte = block;
+                mask = ComputeStringSpecialMask( block );
+            }
+
+            byte += CountTrailingZeros( mask ) / kSimdMaskBitsPerByte;
+
+#else
+
+            for ( ;; byte++ )
+            {
+                uint32 c = byte[ 0 ];
+                if ( c < 32U || c >= 127U || c == '\"' || c == '\\' )
+                {
+                    break;
+                }
+            }
+
+#endif
+
+            return int32( reinterpret_cast<const char*>( byte ) - text );
+        }
+
+        int32 ReadEscapeChar( const char* text, uint32* value ) noexcept
+        {
+            const uint8* byte = reinterpret_cast<const uint8*>( text );
+            uint32       c    = byte[ 0 ];
+
+            if ( ( c == '\"' ) || ( c == '\\' ) || ( c == '/' ) )
+            {
+                *value = c;
+                return ( 1 );
+            }
+            else if ( c == 'b' )
+            {
+                *value = '\b';
+                return ( 1 );
+            }
+            else if ( c == 'f' )
+            {
+                *value = '\f';
+                return ( 1 );
+            }
+            else if ( c == 'n' )
+            {
+                *value = '\n';
+                return ( 1 );
+            }
+            else if ( c == 'r' )
+            {
+                *value = '\r';
+                return ( 1 );
+            }
+            else if ( c == 't' )
+            {
+                *value = '\t';
+                return ( 1 );
+            }
+
+            return ( 0 );
+        }
+
+        int32 ReadStringEscapeChar( const char* text, int32* stringLength, char* restrict string ) noexcept
+        {
+            const uint8* byte = reinterpret_cast<const uint8*>( text );
+            uint32       c    = byte[ 0 ];
+
+            if ( c == 'u' )
+            {
+                uint32 code = 0;
+
+                for ( machine a = 1; a <= 4; a++ )
+                {
+                    c = byte[ a ] - '0';
+                    if ( c >= 55U )
+                    {
+                        return ( 0 );
+                    }
+
+                    int32 x = hexadecimalCharValue[ c ];
+                    if ( x < 0 )
+                    {
+                        return ( 0 );
+                    }
+
+                    code = ( code << 4 ) | x;
+                }
+
+                if ( code != 0 )
+                {
+                    if ( string )
+                    {
+                        *stringLength = Text::WriteUnicodeChar( string, code );
+                    }
+                    else
+                    {
+                        *stringLength = 1 + ( code >= 0x000080 ) + ( code >= 0x000800 );
+                    }
+
+                    return ( 5 );
+                }
+            }
+            else
+            {
+                uint32 value;
+
+                int32 textLength = ReadEscapeChar( text, &value );
+                if ( textLength != 0 )
+                {
+                    if ( string )
+                    {
+                        *string = char( value );
+                    }
+
+                    *stringLength = 1;
+                    return ( textLength );
+                }
+            }
+
+            return ( 0 );
+        }
+
+        // Reads the characters of a string literal after its opening double quote, and decodes them into string if it is
+        // not null. With the grammar of RFC 8259, the delete character and the escape sequence \u0000 are accepted as
+        // well, and string must be null, since a decoded string cannot hold a null character.
+        Status ReadStringLiteral( const char* text, int32* textLength, int32* stringLength, char* restrict string = nullptr,
+                                  Grammar grammar = Grammar::kParse ) noexcept( false )
+        {
+            const uint8* byte  = reinterpret_cast<const uint8*>( text );
+            int32        count = 0;
+
+            for ( ;; )
+            {
+                int32 runLength = ComputeStringRunLength( reinterpret_cast<const char*>( byte ) );
+
+                if ( string )
+                {
+                    memcpy( string, byte, size_t( runLength ) );
+                    string += runLength;
+                }
+
+                byte += runLength;
+                count += runLength;
+
+                uint32 c = byte[ 0 ];
+                if ( c == 0 )
+                {
+                    return Status::kPrematureNullTerminator;
+                }
+
+                if ( c == '\"' )
+                {
+                    break;
+                }
+
+                if ( ( c < 32U ) || ( c == 127U && grammar == Grammar::kParse ) )
+                {
+                    return ( Status::kStringIllegalChar );
+                }
+
+                if ( c != '\\' )
+                {
+                    // Non-ASCII characters are validated one at a time, and consecutive ones are handled here
+                    // without returning to the vector scan.
+                    do
+                    {
+                        int32 len = Text::ValidateUnicodeChar( reinterpret_cast<const char*>( byte ) );
+                        if ( len == 0 )
+                        {
+                            return ( Status::kStringIllegalChar );
+                        }
+
+                        if ( string )
+                        {
+                            for ( machine a = 0; a < len; a++ )
+                            {
+                                string[ a ] = char( byte[ a ] );
+                            }
+
+                            string += len;
+                        }
+
+                        byte += len;
+                        count += len;
+                    } while ( byte[ 0 ] >= 128U );
+                }
+                else
+                {
+                    int32 stringLen;
+
+                    int32 textLen = ReadStringEscapeChar( reinterpret_cast<const char*>( ++byte ), &stringLen, string );
+                    if ( textLen == 0 )
+                    {
+                        if ( grammar == Grammar::kParse || byte[ 0 ] != 'u' || byte[ 1 ] != '0' || byte[ 2 ] != '0' || byte[ 3 ] != '0' || byte[ 4 ] != '0' )
+                        {
+                            return ( Status::kStringIllegalEscape );
+                        }
+
+                        textLen   = 5;
+                        stringLen = 1;
+                    }
+
+                    if ( string )
+                    {
+                        string += stringLen;
+                    }
+
+                    byte += textLen;
+                    count += stringLen;
+                }
+            }
+
+            *textLength   = int32( reinterpret_cast<const char*>( byte ) - text );
+            *stringLength = count;
+
+            return ( Status::kOk );
+        }
+
+        struct UInt128
+        {
+            uint64 low;
+            uint64 high;
+        };
+
+        inline UInt128 MultiplyFull( uint64 a, uint64 b ) noexcept
+        {
+            UInt128 result;
+
+#if defined( __SIZEOF_INT128__ )
+
+            __extension__ using uint128 = unsigned __int128;
+
+            uint128 product = uint128( a ) * b;
+            result.low      = uint64( product );
+            result.high     = uint64( product >> 64 );
+
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+
+            result.low = _umul128( a, b, &result.high );
+
+#else
+
+            uint64 aLow   = a & 0xFFFFFFFF;
+            uint64 aHigh  = a >> 32;
+            uint64 bLow   = b & 0xFFFFFFFF;
+            uint64 bHigh  = b >> 32;
+            uint64 ll     = aLow * bLow;
+            uint64 lh     = aLow * bHigh;
+            uint64 hl     = aHigh * bLow;
+            uint64 middle = ( ll >> 32 ) + ( lh & 0xFFFFFFFF ) + ( hl & 0xFFFFFFFF );
+
+            result.low  = ( middle << 32 ) | ( ll & 0xFFFFFFFF );
+            result.high = aHigh * bHigh + ( lh >> 32 ) + ( hl >> 32 ) + ( middle >> 32 );
+
+#endif
+
+            return result;
+        }
+
+        inline uint32 CountLeadingZeros( uint64 x ) noexcept
+        {
+#if defined( _MSC_VER )
+            unsigned long index;
+
+            if ( _BitScanReverse( &index, (unsigned long)( x >> 32 ) ) )
+            {
+                return 31 - uint32( index );
+            }
+
+            _BitScanReverse( &index, (unsigned long)( x ) );
+            return 63 - uint32( index );
+#else
+            return uint32( __builtin_clzll( x ) );
+#endif
+        }
+
+        // The significand without the implicit bit and the biased exponent of a double.
+        struct BinaryDouble
+        {
+            uint64 mantissa;
+            int32  power2;
+
+            bool operator==( const BinaryDouble& other ) const noexcept
+            {
+                return mantissa == other.mantissa && power2 == other.power2;
+            }
+        };
+
+        constexpr int32  kDoubleMantissaBits    = 52;
+        constexpr int32  kDoubleMinimumExponent = -1023;
+        constexpr int32  kDoubleInfinitePower   = 0x7FF;
+        constexpr uint64 kMaxExactMantissa      = uint64( 2 ) << kDoubleMantissaBits;
+
+        // Converts w * 10^q to the nearest double with the Eisel-Lemire algorithm. For any w of at most 19 decimal
+        // digits, the truncated 128-bit product with the power of five determines the correctly rounded result.
+        BinaryDouble ComputeDoubleEiselLemire( int64 q, uint64 w ) noexcept
+        {
+            BinaryDouble result;
+
+            if ( w == 0 || q < kSmallestPowerOfTen )
+            {
+                result.mantissa = 0;
+                result.power2   = 0;
+                return result;
+            }
+
+            if ( q > kLargestPowerOfTen )
+            {
+                result.mantissa = 0;
+                result.power2   = kDoubleInfinitePower;
+                return result;
+            }
+
+            int32 leadingZeroCount = int32( CountLeadingZeros( w ) );
+            w <<= leadingZeroCount;
+
+            // Only the upper 55 bits of the product are needed. The second word of the power of five matters only
+            // when the bits below them are all ones.
+            constexpr uint64 precisionMask = uint64( 0xFFFFFFFFFFFFFFFF ) >> ( kDoubleMantissaBits + 3 );
+
+            int32   index   = 2 * int32( q - kSmallestPowerOfTen );
+            UInt128 product = MultiplyFull( w, powerOfFive128[ index ] );
+
+            if ( ( product.high & precisionMask ) == precisionMask )
+            {
+                UInt128 secondProduct = MultiplyFull( w, powerOfFive128[ index + 1 ] );
+
+                product.low += secondProduct.high;
+                if ( secondProduct.high > product.low )
+                {
+                    product.high++;
+                }
+            }
+
+            int32 upperBit = int32( product.high >> 63 );
+            int32 shift    = upperBit + 64 - kDoubleMantissaBits - 3;
+
+            // The binary exponent of 10^q is floor(q * log2(10)), computed with a fixed-point multiply.
+            result.mantissa = product.high >> shift;
+            result.power2   = ( ( ( 152170 + 65536 ) * int32( q ) ) >> 16 ) + 63 + upperBit - leadingZeroCount - kDoubleMinimumExponent;
+
+            if ( result.power2 <= 0 )
+            {
+                if ( -result.power2 + 1 >= 64 )
+                {
+                    result.mantissa = 0;
+                    result.power2   = 0;
+                    return result;
+                }
+
+                result.mantissa >>= -result.power2 + 1;
+                result.mantissa += ( result.mantissa & 1 );
+                result.mantissa >>= 1;
+                result.power2 = ( result.mantissa < ( uint64( 1 ) << kDoubleMantissaBits ) ) ? 0 : 1;
+                return result;
+            }
+
+            // Exact halfway cases can only occur for small exponents, and are rounded to even.
+            if ( product.low <= 1 && q >= -4 && q <= 23 && ( result.mantissa & 3 ) == 1 )
+            {
+                if ( ( result.mantissa << shift ) == product.high )
+                {
+                    result.mantissa &= ~uint64( 1 );
+                }
+            }
+
+            result.mantissa += ( result.mantissa & 1 );
+            result.mantissa >>= 1;
+
+            if ( result.mantissa >= kMaxExactMantissa )
+            {
+                result.mantissa = uint64( 1 ) << kDoubleMantissaBits;
+                result.power2++;
+            }
+
+            result.mantissa &= ~( uint64( 1 ) << kDoubleMantissaBits );
+
+            if ( result.power2 >= kDoubleInfinitePower )
+            {
+                result.mantissa = 0;
+                result.power2   = kDoubleInfinitePower;
+            }
+
+            return result;
+        }
+
+        // An arbitrary decimal, used for the rare literals whose value the first 19 significant digits do not
+        // determine. Digits beyond the capacity only matter through the truncated flag, which breaks ties.
+        struct DecimalNumber
+        {
+            static constexpr uint32 kMaxDigitCount     = 768;
+            static constexpr int32  kDecimalPointRange = 2047;
+
+            uint32 digitCount;
+            int32  decimalPoint;
+            bool   truncated;
+            uint8  digit[ kMaxDigitCount ];
+
+            void Trim() noexcept
+            {
+                while ( digitCount > 0 && digit[ digitCount - 1 ] == 0 )
+                {
+                    digitCount--;
+                }
+            }
+
+            void AppendDigits( const uint8* byte, const uint8* end, bool integerPart ) noexcept
+            {
+                for ( ; byte != end; byte++ )
+                {
+                    uint8 d = uint8( byte[ 0 ] - '0' );
+
+                    // Leading zeros only move the decimal point when they follow it.
+                    if ( digitCount == 0 && d == 0 )
+                    {
+                        decimalPoint -= !integerPart;
+                        continue;
+                    }
+
+                    if ( digitCount < kMaxDigitCount )
+                    {
+                        digit[ digitCount++ ] = d;
+                    }
+                    else if ( d != 0 )
+                    {
+                        truncated = true;
+                    }
+
+                    decimalPoint += integerPart;
+                }
+            }
+
+            uint32 ComputeLeftShiftDigitCount( uint32 shift ) const noexcept
+            {
+                uint32 a           = decimalLeftShiftTable[ shift ];
+                uint32 b           = decimalLeftShiftTable[ shift + 1 ];
+                uint32 newDigits   = a >> 11;
+                uint32 powerLength = ( b & 0x7FF ) - ( a & 0x7FF );
+
+                const uint8* powerOfFive = &decimalLeftShiftPowerOfFive[ a & 0x7FF ];
+
+                for ( uint32 i = 0; i != powerLength; i++ )
+                {
+                    if ( i >= digitCount || digit[ i ] < powerOfFive[ i ] )
+                    {
+                        return newDigits - 1;
+                    }
+
+                    if ( digit[ i ] > powerOfFive[ i ] )
+                    {
+                        return newDigits;
+                    }
+                }
+
+                return newDigits;
+            }
+
+            void ShiftLeft( uint32 shift ) noexcept
+            {
+                if ( digitCount == 0 )
+                {
+                    return;
+                }
+
+                uint32 newDigits  = ComputeLeftShiftDigitCount( shift );
+                int32  readIndex  = int32( digitCount ) - 1;
+                uint32 writeIndex = digitCount - 1 + newDigits;
+                uint64 n          = 0;
+
+                for ( ; readIndex >= 0 || n > 0; readIndex--, writeIndex-- )
+                {
+                    if ( readIndex >= 0 )
+                    {
+                        n += uint64( digit[ readIndex ] ) << shift;
+                    }
+
+                    uint64 quotient  = n / 10;
+                    uint64 remainder = n - 10 * quotient;
+
+                    if ( writeIndex < kMaxDigitCount )
+                    {
+                        digit[ writeIndex ] = uint8( remainder );
+                    }
+                    else if ( remainder > 0 )
+                    {
+                        truncated = true;
+                    }
+
+                    n = quotient;
+                }
+
+                digitCount += newDigits;
+                if ( digitCount > kMaxDigitCount )
+                {
+                    digitCount = kMaxDigitCount;
+                }
+
+                decimalPoint += int32( newDigits );
+                Trim();
+            }
+
+            void ShiftRight( uint32 shift ) noexcept
+            {
+                uint32 readIndex  = 0;
+                uint32 writeIndex = 0;
+                uint64 n          = 0;
+
+                while ( ( n >> shift ) == 0 )
+                {
+                    if ( readIndex < digitCount )
+                    {
+                        n = 10 * n + digit[ readIndex++ ];
+                    }
+                    else if ( n == 0 )
+                    {
+                        return;
+                    }
+                    else
+                    {
+                        while ( ( n >> shift ) == 0 )
+                        {
+                            n = 10 * n;
+                            readIndex++;
+                        }
+
+                        break;
+                    }
+                }
+
+                decimalPoint -= int32( readIndex - 1 );
+                if ( decimalPoint < -kDecimalPointRange )
+                {
+                    digitCount   = 0;
+                    decimalPoint = 0;
+                    truncated    = false;
+                    return;
+                }
+
+                uint64 mask = ( uint64( 1 ) << shift ) - 1;
+
+                while ( readIndex < digitCount )
+                {
+                    uint8 newDigit = uint8( n >> shift );
+                    n              = 10 * ( n & mask ) + digit[ readIndex++ ];
+
+                    digit[ writeIndex++ ] = newDigit;
+                }
+
+                while ( n > 0 )
+                {
+                    uint8 newDigit = uint8( n >> shift );
+                    n              = 10 * ( n & mask );
+
+                    if ( writeIndex < kMaxDigitCount )
+                    {
+                        digit[ writeIndex++ ] = newDigit;
+                    }
+                    else if ( newDigit > 0 )
+                    {
+                        truncated = true;
+                    }
+                }
+
+                digitCount = writeIndex;
+                Trim();
+            }
+
+            uint64 Round() const noexcept
+            {
+                if ( digitCount == 0 || decimalPoint < 0 )
+                {
+                    return 0;
+                }
+
+                if ( decimalPoint > 18 )
+                {
+                    return ~uint64( 0 );
+                }
+
+                uint32 point = uint32( decimalPoint );
+                uint64 n     = 0;
+
+                for ( uint32 i = 0; i < point; i++ )
+                {
+                    n = 10 * n + ( ( i < digitCount ) ? digit[ i ] : 0 );
+                }
+
+                bool roundUp = false;
+                if ( point < digitCount )
+                {
+                    roundUp = ( digit[ point ] >= 5 );
+
+                    if ( digit[ point ] == 5 && point + 1 == digitCount )
+                    {
+                        roundUp = truncated || ( point > 0 && ( digit[ point - 1 ] & 1 ) != 0 );
+                    }
+                }
+
+                return roundUp ? n + 1 : n;
+            }
+        };
+
+        // Converts a decimal to the nearest double exactly by repeated binary shifts of its digits. This is slow, but
+        // it is only needed when the first 19 significant digits leave the result undecided.
+        BinaryDouble ComputeDoubleFromDecimal( const uint8* integer, const uint8* integerEnd, const uint8* fraction, const uint8* fractionEnd, int64 exponent ) noexcept
+        {
+            static constexpr uint32 kMaxShift           = 60;
+            static constexpr uint8  decimalShiftPower[] = { 0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59 };
+            static constexpr uint32 kShiftPowerCount    = sizeof( decimalShiftPower );
+
+            DecimalNumber decimal;
+            decimal.digitCount   = 0;
+            decimal.decimalPoint = 0;
+            decimal.truncated    = false;
+
+            decimal.AppendDigits( integer, integerEnd, true );
+            decimal.AppendDigits( fraction, fractionEnd, false );
+            decimal.Trim();
+
+            if ( exponent > 0x10000 )
+            {
+                exponent = 0x10000;
+            }
+            else if ( exponent < -0x10000 )
+            {
+                exponent = -0x10000;
+            }
+
+            decimal.decimalPoint += int32( exponent );
+
+            BinaryDouble result;
+            result.mantissa = 0;
+            result.power2   = 0;
+
+            if ( decimal.digitCount == 0 || decimal.decimalPoint < -324 )
+            {
+                return result;
+            }
+
+            result.power2 = kDoubleInfinitePower;
+
+            if ( decimal.decimalPoint >= 310 )
+            {
+                return result;
+            }
+
+            // Shift right until the value is less than one, then left until it is in [1/2, 1).
+            int32 exponent2 = 0;
+
+            while ( decimal.decimalPoint > 0 )
+            {
+                uint32 n     = uint32( decimal.decimalPoint );
+                uint32 shift = ( n < kShiftPowerCount ) ? decimalShiftPower[ n ] : kMaxShift;
+
+                decimal.ShiftRight( shift );
+                if ( decimal.decimalPoint < -DecimalNumber::kDecimalPointRange )
+                {
+                    result.power2 = 0;
+                    return result;
+                }
+
+                exponent2 += int32( shift );
+            }
+
+            while ( decimal.decimalPoint <= 0 )
+            {
+                uint32 shift;
+
+                if ( decimal.decimalPoint == 0 )
+                {
+                    if ( decimal.digit[ 0 ] >= 5 )
+                    {
+                        break;
+                    }
+
+                    shift = ( decimal.digit[ 0 ] < 2 ) ? 2 : 1;
+                }
+                else
+                {
+                    uint32 n = uint32( -decimal.decimalPoint );
+                    shift    = ( n < kShiftPowerCount ) ? decimalShiftPower[ n ] : kMaxShift;
+                }
+
+                decimal.ShiftLeft( shift );
+                if ( decimal.decimalPoint > DecimalNumber::kDecimalPointRange )
+                {
+                    return result;
+                }
+
+                exponent2 -= int32( shift );
+            }
+
+            exponent2--;
+
+            while ( kDoubleMinimumExponent + 1 > exponent2 )
+            {
+                uint32 n = uint32( kDoubleMinimumExponent + 1 - exponent2 );
+                if ( n > kMaxShift )
+                {
+                    n = kMaxShift;
+                }
+
+                decimal.ShiftRight( n );
+                exponent2 += int32( n );
+            }
+
+            if ( exponent2 - kDoubleMinimumExponent >= kDoubleInfinitePower )
+            {
+                return result;
+            }
+
+            decimal.ShiftLeft( kDoubleMantissaBits + 1 );
+            uint64 mantissa = decimal.Round();
+
+            if ( mantissa >= kMaxExactMantissa )
+            {
+                decimal.ShiftRight( 1 );
+                exponent2++;
+                mantissa = decimal.Round();
+
+                if ( exponent2 - kDoubleMinimumExponent >= kDoubleInfinitePower )
+                {
+                    return result;
+                }
+            }
+
+            result.power2 = exponent2 - kDoubleMinimumExponent;
+            if ( mantissa < ( uint64( 1 ) << kDoubleMantissaBits ) )
+            {
+                result.power2--;
+            }
+
+            result.mantissa = mantissa & ( ( uint64( 1 ) << kDoubleMantissaBits ) - 1 );
+
+            return result;
+        }
+
+#if defined( _MSC_VER ) || ( defined( __BYTE_ORDER__ ) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+
+#    define JSON4C4_SWAR_DIGITS
+
+        // Reads eight digits at a time when the load stays within one page, for the same reason as MatchLiteral4.
+        JSON4C4_NO_SANITIZE_ADDRESS inline bool ReadEightDigits( const uint8* byte, uint64* value ) noexcept
+        {
+            if ( ( machine_address( byte ) & 4095 ) > 4088 )
+            {
+                return false;
+            }
+
+            uint64 word;
+            memcpy( &word, byte, 8 );
+
+            if ( ( ( word + 0x4646464646464646 ) | ( word - 0x3030303030303030 ) ) & 0x8080808080808080 )
+            {
+                return false;
+            }
+
+            constexpr uint64 mask        = 0x000000FF000000FF;
+            constexpr uint64 multiplier1 = 0x000F424000000064;
+            constexpr uint64 multiplier2 = 0x0000271000000001;
+
+            word -= 0x3030303030303030;
+            word   = word * 10 + ( word >> 8 );
+            *value = ( ( ( word & mask ) * multiplier1 ) + ( ( ( word >> 16 ) & mask ) * multiplier2 ) ) >> 32;
+
+            return true;
+        }
+
+#endif
+
+        inline const uint8* ReadDigits( const uint8* byte, uint64& mantissa ) noexcept
+        {
+#ifdef JSON4C4_SWAR_DIGITS
+
+            uint64 eightDigits;
+            while ( ReadEightDigits( byte, &eightDigits ) )
+            {
+                mantissa = mantissa * 100000000 + eightDigits;
+                byte += 8;
+            }
+
+#endif
+
+            for ( ;; byte++ )
+            {
+                uint32 x = uint32( byte[ 0 ] ) - '0';
+                if ( x >= 10U )
+                {
+                    break;
+                }
+
+                mantissa = mantissa * 10 + x;
+            }
+
+            return byte;
+        }
+
+        // Parses an unsigned JSON number without allocating and without the C library. Literals of up to 19
+        // significant digits and exponents up to 22 are exact in double arithmetic; other values are converted with
+        // the Eisel-Lemire algorithm, falling back to an exact decimal conversion when digits beyond the 19th could
+        // change the result.
+        Status ReadDoubleLiteral( const char* text, int32* textLength, double* value ) noexcept
+        {
+            const uint8* integer    = reinterpret_cast<const uint8*>( text );
+            uint64       mantissa   = 0;
+            const uint8* integerEnd = ReadDigits( integer, mantissa );
+            const uint8* byte       = integerEnd;
+
+            if ( integerEnd - integer > 1 && integer[ 0 ] == '0' )
+            {
+                return ( Status::kNumbersCannotHaveLeadingZeros );
+            }
+
+            int64        digitCount  = integerEnd - integer;
+            int64        exponent    = 0;
+            const uint8* fraction    = nullptr;
+            const uint8* fractionEnd = nullptr;
+
+            if ( byte[ 0 ] == '.' )
+            {
+                fraction    = byte + 1;
+                fractionEnd = ReadDigits( fraction, mantissa );
+                byte        = fractionEnd;
+
+                exponent = fraction - fractionEnd;
+                digitCount -= exponent;
+            }
+
+            if ( digitCount == 0 )
+            {
+                return ( Status::kFloatInvalid );
+            }
+
+            int64 explicitExponent = 0;
+
+            if ( byte[ 0 ] == 'e' || byte[ 0 ] == 'E' )
+            {
+                bool negative = false;
+
+                byte++;
+                if ( byte[ 0 ] == '-' )
+                {
+                    negative = true;
+                    byte++;
+                }
+                else if ( byte[ 0 ] == '+' )
+                {
+                    byte++;
+                }
+
+                if ( uint32( byte[ 0 ] ) - '0' >= 10U )
+                {
+                    return ( Status::kFloatInvalid );
+                }
+
+                for ( ;; byte++ )
+                {
+                    uint32 x = uint32( byte[ 0 ] ) - '0';
+                    if ( x >= 10U )
+                    {
+                        break;
+                    }
+
+                    if ( explicitExponent < 0x10000000 )
+                    {
+                        explicitExponent = explicitExponent * 10 + x;
+                    }
+                }
+
+                if ( negative )
+                {
+                    explicitExponent = -explicitExponent;
+                }
+
+                exponent += explicitExponent;
+            }
+
+            *textLength = int32( reinterpret_cast<const char*>( byte ) - text );
+
+            // With more than 19 significant digits the mantissa has overflowed, so it is rebuilt from the first 19.
+            bool manyDigits = false;
+
+            if ( digitCount > 19 )
+            {
+                for ( const uint8* leading = integer; leading[ 0 ] == '0' || leading[ 0 ] == '.'; leading++ )
+                {
+                    digitCount -= ( leading[ 0 ] == '0' );
+                }
+
+                if ( digitCount > 19 )
+                {
+                    constexpr uint64 kMinNineteenDigitInteger = 1000000000000000000;
+
+                    manyDigits = true;
+                    mantissa   = 0;
+
+                    const uint8* digit = integer;
+                    for ( ; mantissa < kMinNineteenDigitInteger && digit != integerEnd; digit++ )
+                    {
+                        mantissa = mantissa * 10 + uint32( digit[ 0 ] - '0' );
+                    }
+
+                    if ( mantissa >= kMinNineteenDigitInteger )
+                    {
+                        exponent = ( integerEnd - digit ) + explicitExponent;
+                    }
+                    else
+                    {
+                        for ( digit = fraction; mantissa < kMinNineteenDigitInteger && digit != fractionEnd; digit++ )
+                        {
+                            mantissa = mantissa * 10 + uint32( digit[ 0 ] - '0' );
+                        }
+
+                        exponent = ( fraction - digit ) + explicitExponent;
+                    }
+                }
+            }
+
+            if ( !manyDigits && mantissa <= ( uint64( 1 ) << 53 ) && exponent >= -22 && exponent <= 22 )
+            {
+                double v = double( int64( mantissa ) );
+                *value   = ( exponent < 0 ) ? v / exactPowerOfTen[ -exponent ] : v * exactPowerOfTen[ exponent ];
+
+                return ( Status::kOk );
+            }
+
+            BinaryDouble binary = ComputeDoubleEiselLemire( exponent, mantissa );
+
+            // The value lies between mantissa and mantissa + 1 scaled by the same power of ten. If both bounds round
+            // to the same double, so does the value.
+            if ( manyDigits && !( binary == ComputeDoubleEiselLemire( exponent, mantissa + 1 ) ) )
+            {
+                binary = ComputeDoubleFromDecimal( integer, integerEnd, fraction, fractionEnd, explicitExponent );
+            }
+
+            uint64 bits = binary.mantissa | ( uint64( binary.power2 ) << kDoubleMantissaBits );
+            memcpy( value, &bits, sizeof( double ) );
+
+            return ( Status::kOk );
+        }
+
+        // Reads a literal made only of decimal digits that fits in 64 bits. Anything else, including literals with a
+        // fraction or an exponent and malformed literals, is left to ReadDoubleLiteral.
+        bool ReadIntegerLiteral( const char* text, int32* textLength, uint64* value ) noexcept
+        {
+            static constexpr char maxUInt64Text[] = "18446744073709551615";
+
+            const uint8* byte     = reinterpret_cast<const uint8*>( text );
+            uint64       mantissa = 0;
+            const uint8* end      = ReadDigits( byte, mantissa );
+            int64        length   = end - byte;
+
+            if ( length == 0 || length > 20 || ( length > 1 && byte[ 0 ] == '0' ) )
+            {
+                return false;
+            }
+
+            if ( end[ 0 ] == '.' || end[ 0 ] == 'e' || end[ 0 ] == 'E' )
+            {
+                return false;
+            }
+
+            if ( length == 20 )
+            {
+                for ( int32 a = 0; a != 20; a++ )
+                {
+                    if ( byte[ a ] != uint8( maxUInt64Text[ a ] ) )
+                    {
+                        if ( byte[ a ] > uint8( maxUInt64Text[ a ] ) )
+                        {
+                            return false;
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            *textLength = int32( length );
+            *value      = mantissa;
+
+            return true;
+        }
+
+        const char decimalDigitPairs[ 201 ] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                                              "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                                              "8081828384858687888990919293949596979899";
+
+        // Formats an integer from its least significant end, two digits at a time.
+        void WriteIntegerLiteral( OutputSink& sink, uint64 magnitude, bool negative ) noexcept
+        {
+            char  buffer[ 24 ];
+            char* end   = buffer + sizeof( buffer );
+            char* start = end;
+
+            while ( magnitude >= 100 )
+            {
+                const char* pair = &decimalDigitPairs[ ( magnitude % 100 ) * 2 ];
+                magnitude /= 100;
+
+                start -= 2;
+                start[ 0 ] = pair[ 0 ];
+                start[ 1 ] = pair[ 1 ];
+            }
+
+            if ( magnitude >= 10 )
+            {
+                const char* pair = &decimalDigitPairs[ magnitude * 2 ];
+
+                start -= 2;
+                start[ 0 ] = pair[ 0 ];
+                start[ 1 ] = pair[ 1 ];
+            }
+            else
+            {
+                *--start = char( '0' + magnitude );
+            }
+
+            if ( negative )
+            {
+                *--start = '-';
+            }
+
+            sink.Write( start, uint64( end - start ) );
+        }
+
+        bool ParseSign( const char*& text ) noexcept
+        {
+            char c = text[ 0 ];
+
+            if ( c == '-' )
+            {
+                text++;
+                text += ComputeWhitespaceLength( text );
+                return ( true );
+            }
+
+            if ( c == '+' )
+            {
+                text++;
+                text += ComputeWhitespaceLength( text );
+            }
+
+            return ( false );
+        }
+
+        constexpr uint64 kInt64Magnitude = uint64( 1 ) << 63;
+
+        // Reads a number literal and the whitespace after it. Integer literals are read exactly, as kInt64 when they
+        // fit, with the bits of the int64 in integer, and as kUInt64 above that. Negative zero and negative values
+        // beyond the range of int64 are left to the double conversion.
+        Status ReadNumberLiteral( const char*& text, NumberType* type, uint64* integer, double* value ) noexcept
+        {
+            int32  length;
+            uint64 magnitude;
+
+            bool negative = ParseSign( text );
+
+            if ( ReadIntegerLiteral( text, &length, &magnitude ) && ( !negative || ( magnitude - 1 ) < kInt64Magnitude ) )
+            {
+                if ( negative || magnitude < kInt64Magnitude )
+                {
+                    *type    = NumberType::kInt64;
+                    *integer = negative ? 0 - magnitude : magnitude;
+                }
+                else
+                {
+                    *type    = NumberType::kUInt64;
+                    *integer = magnitude;
+                }
+
+                text += length;
+                text += ComputeWhitespaceLength( text );
+
+                return ( Status::kOk );
+            }
+
+            double doubleData;
+
+            Status status = ReadDoubleLiteral( text, &length, &doubleData );
+
+            if ( status != Status::kOk )
+            {
+                return ( status );
+            }
+
+            *type  = NumberType::kDouble;
+            *value = negative ? -doubleData : doubleData;
+
+            text += length;
+            text += ComputeWhitespaceLength( text );
+
+            return ( Status::kOk );
+        }
+
+        // Checks a number literal against the grammar accepted by ReadNumberLiteral without converting it, and reads
+        // the whitespace after it. On success, literalEnd is set to the end of the literal. Errors are reported as
+        // ReadNumberLiteral reports them, with text left at the same position.
+        Status ScanNumberLiteral( const char*& text, const char** literalEnd ) noexcept
+        {
+            ParseSign( text );
+
+            const uint8* integer    = reinterpret_cast<const uint8*>( text );
+            const uint8* integerEnd = integer;
+
+            while ( uint32( integerEnd[ 0 ] ) - '0' < 10U )
+            {
+                integerEnd++;
+            }
+
+            if ( integerEnd - integer > 1 && integer[ 0 ] == '0' )
+            {
+                return ( Status::kNumbersCannotHaveLeadingZeros );
+            }
+
+            const uint8* byte       = integerEnd;
+            int64        digitCount = integerEnd - integer;
+
+            if ( byte[ 0 ] == '.' )
+            {
+                const uint8* fraction = ++byte;
+
+                while ( uint32( byte[ 0 ] ) - '0' < 10U )
+                {
+                    byte++;
+                }
+
+                digitCount += byte - fraction;
+            }
+
+            if ( digitCount == 0 )
+            {
+                return ( Status::kFloatInvalid );
+            }
+
+            if ( byte[ 0 ] == 'e' || byte[ 0 ] == 'E' )
+            {
+                byte++;
+                if ( byte[ 0 ] == '-' || byte[ 0 ] == '+' )
+                {
+                    byte++;
+                }
+
+                if ( uint32( byte[ 0 ] ) - '0' >= 10U )
+                {
+                    return ( Status::kFloatInvalid );
+                }
+
+                while ( uint32( byte[ 0 ] ) - '0' < 10U )
+                {
+                    byte++;
+                }
+            }
+
+            text        = reinterpret_cast<const char*>( byte );
+            *literalEnd = text;
+            text += ComputeWhitespaceLength( text );
+
+            return ( Status::kOk );
+        }
+
+        // Checks a number literal against the grammar of RFC 8259, in which a number has no plus sign, no whitespace
+        // after its minus sign, and digits before its decimal point and after it, and reads the whitespace after it.
+        // Errors are reported as ScanNumberLiteral reports them.
+        Status ScanRfc8259NumberLiteral( const char*& text ) noexcept
+        {
+            const uint8* byte = reinterpret_cast<const uint8*>( text );
+
+            if ( byte[ 0 ] == '-' )
+            {
+                byte++;
+            }
+
+            const uint8* integer = byte;
+
+            while ( uint32( byte[ 0 ] ) - '0' < 10U )
+            {
+                byte++;
+            }
+
+            if ( byte == integer )
+            {
+                return ( Status::kFloatInvalid );
+            }
+
+            if ( byte - integer > 1 && integer[ 0 ] == '0' )
+            {
+                text = reinterpret_cast<const char*>( integer );
+                return ( Status::kNumbersCannotHaveLeadingZeros );
+            }
+
+            if ( byte[ 0 ] == '.' )
+            {
+                const uint8* fraction = ++byte;
+
+                while ( uint32( byte[ 0 ] ) - '0' < 10U )
+                {
+                    byte++;
+                }
+
+                if ( byte == fraction )
+                {
+                    return ( Status::kFloatInvalid );
+                }
+            }
+
+            if ( byte[ 0 ] == 'e' || byte[ 0 ] == 'E' )
+            {
+                byte++;
+                if ( byte[ 0 ] == '-' || byte[ 0 ] == '+' )
+                {
+                    byte++;
+                }
+
+                if ( uint32( byte[ 0 ] ) - '0' >= 10U )
+                {
+                    return ( Status::kFloatInvalid );
+                }
+
+                while ( uint32( byte[ 0 ] ) - '0' < 10U )
+                {
+                    byte++;
+                }
+            }
+
+            text = reinterpret_cast<const char*>( byte );
+            text += ComputeWhitespaceLength( text );
+
+            return ( Status::kOk );
+        }
+
+        // Converts a number to an integer of type T. For kInt64 and kUInt64 numbers, integer holds the exact value, as
+        // written by ReadNumberLiteral, and data is ignored.
+        template <class T>
+        Status ConvertNumberToInteger( NumberType type, uint64 integer, double data, T* result ) noexcept
+        {
+            constexpr bool   isSigned = ( T( -1 ) < T( 0 ) );
+            constexpr int32  bitCount = int32( sizeof( T ) * 8 ) - int32( isSigned );
+            constexpr uint64 maximum  = ( bitCount == 64 ) ? ~uint64( 0 ) : ( uint64( 1 ) << bitCount ) - 1;
+            constexpr int64  minimum  = isSigned ? -int64( maximum ) - 1 : 0;
+
+            if ( type == NumberType::kInt64 )
+            {
+                int64 int64Data = int64( integer );
+
+                if ( int64Data < minimum || ( int64Data > 0 && uint64( int64Data ) > maximum ) )
+                {
+                    return Status::kNumberOutOfRange;
+                }
+
+                *result = T( int64Data );
+                return Status::kOk;
+            }
+
+            if ( type == NumberType::kUInt64 )
+            {
+                if ( integer > maximum )
+                {
+                    return Status::kNumberOutOfRange;
+                }
+
+                *result = T( integer );
+                return Status::kOk;
+            }
+
+            // Both bounds are powers of two, so they are exact in double precision.
+            constexpr double lowerBound = double( minimum );
+            constexpr double upperBound = double( maximum / 2 + 1 ) * 2.0;
+
+            if ( !( data >= lowerBound && data < upperBound ) )
+            {
+                return ( data == data ) ? Status::kNumberOutOfRange : Status::kInvalidValueType;
+            }
+
+            T converted = T( data );
+            if ( double( converted ) != data )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            *result = converted;
+            return Status::kOk;
+        }
+
+        void WriteNumber( OutputSink& sink, NumberType type, uint64 integer, double data ) noexcept
+        {
+            if ( type == NumberType::kInt64 )
+            {
+                int64 int64Data = int64( integer );
+
+                WriteIntegerLiteral( sink, ( int64Data < 0 ) ? 0 - integer : integer, int64Data < 0 );
+
+                return;
+            }
+
+            if ( type == NumberType::kUInt64 )
+            {
+                WriteIntegerLiteral( sink, integer, false );
+
+                return;
+            }
+
+#ifdef JSON4C4_USE_SYSTEM_DOUBLE_STRING_CONVERSIONS
+
+            constexpr int maxDoubleDigits = 32;
+            char          output[ maxDoubleDigits ];
+
+            snprintf( output, maxDoubleDigits, "%.17g", data );
+
+            sink << output;
+
+#else
+
+            sink << Text::FloatToString( data );
+
+#endif
+        }
+
+        // State shared by the parse of one document. Container elements are collected on elementStack while the
+        // container is open and copied to arena storage of the exact size when it closes. Keys with escape sequences
+        // are decoded into keyBuffer before they are interned. When arrayPacking is set, the elements of an array
+        // that may be packed are collected in numberBuffer or boolBuffer.
+        struct ParseContext
+        {
+            Arena&               arena;
+            Array<Value*>&       elementStack;
+            Array<ObjectMember>& memberStack;
+            KeyTable&            keyTable;
+            Array<char>&         keyBuffer;
+            Array<double>&       numberBuffer;
+            Array<bool>&          boolBuffer;
+            Array<EscapedString>& escapedStrings;
+            bool                  arrayPacking;
+            bool                  lazyNumbers;
+            bool                  inSitu;
+            const Key*            projectionKeys;
+            int32                 projectionKeyCount;
+            bool                  trustedSkipping;
+        };
+
+        // Every string a parsed value holds is shorter than this or lives in the arena.
+        constexpr int32 kLocalStringLength = 15;
+
+        // A value that fails to parse is abandoned in the arena. Parsed values own no memory outside the arena, so
+        // nothing is leaked, and the arena is released with the rest of the document.
+        template <class T>
+        Status ParseValue( Value*& value, const char*& text, ParseContext& context ) noexcept
+        {
+            T* jsonValue = nullptr;
+
+            Status status = MayThrow(
+                [ & ]()
+                {
+                    jsonValue = new ( context.arena ) T;
+                    return Status::kOk;
+                } );
+
+            if ( status != Status::kOk )
+            {
+                return status;
+            }
+
+            status = MayThrow( [ & ]() { return T::Parse( jsonValue, text, context ); } );
+
+            if ( status == Status::kOk )
+            {
+                value = jsonValue;
+            }
+
+            return status;
+        };
+
+        // The value types of first characters and the comparison of literals are shared with the event parser.
+        using Detail::kValueTypeInvalid;
+        using Detail::kValueTypeString;
+        using Detail::kValueTypeNumber;
+        using Detail::kValueTypeBool;
+        using Detail::kValueTypeNull;
+        using Detail::kValueTypeArray;
+        using Detail::kValueTypeObject;
+        using Detail::valueTypeTable;
+        using Detail::MatchLiteral4;
+
+        bool ParsePackedArray( Value*& value, const char*& text, ParseContext& context ) noexcept;
+
+        Status ParseAnyValue( Value*& value, const char*& text, ParseContext& context ) noexcept
+        {
+            const char* start = text;
+
+            switch ( valueTypeTable.type[ uint8( text[ 0 ] ) ] )
+            {
+            case kValueTypeString:
+                return ParseValue<StringValue>( value, text, context );
+
+            case kValueTypeNumber:
+            {
+                Status status = ParseValue<NumberValue>( value, text, context );
+                if ( status == Status::kOk || status == Status::kNumbersCannotHaveLeadingZeros )
+                {
+                    return status;
+                }
+                break;
+            }
+
+            case kValueTypeBool:
+                if ( ParseValue<BoolValue>( value, text, context ) == Status::kOk )
+                {
+                    return Status::kOk;
+                }
+                break;
+
+            case kValueTypeNull:
+                if ( ParseValue<NullValue>( value, text, context ) == Status::kOk )
+                {
+                    return Status::kOk;
+                }
+                break;
+
+            case kValueTypeArray:
+                if ( context.arrayPacking && ParsePackedArray( value, text, context ) )
+                {
+                    return Status::kOk;
+                }
+
+                return ParseValue<ArrayValue>( value, text, context );
+
+            case kValueTypeObject:
+                return ParseValue<ObjectValue>( value, text, context );
+            }
+
+            text = start;
+
+            return Status::kExpectedJsonValue;
+        }
+
+        // Reads a string literal and decodes it into the storage returned by allocateStorage, which is called with the
+        // decoded length and must provide one more character for the terminating null character. A literal without
+        // escape sequences is first offered to borrowString, which is called with its characters in the text and its
+        // length, and is not copied if borrowString returns true.
+        template <class AllocateStorage, class BorrowString>
+        Status ReadStringLiteralValue( const char*& text, AllocateStorage&& allocateStorage, BorrowString&& borrowString ) noexcept
+        {
+            if ( text[ 0 ] != '"' )
+            {
+                return ( Status::kExpectedBeginingDoubleQuotes );
+            }
+
+            int32 textLength;
+            int32 stringLength;
+
+            text++;
+
+            Status status = ReadStringLiteral( text, &textLength, &stringLength );
+            if ( status != Status::kOk )
+            {
+                return ( status );
+            }
+
+            if ( textLength != stringLength || !borrowString( text, stringLength ) )
+            {
+                char* storage = nullptr;
+
+                status = MayThrow(
+                    [ & ]()
+                    {
+                        storage                 = allocateStorage( stringLength );
+                        storage[ stringLength ] = 0;
+
+                        return Status::kOk;
+                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                // A literal without escape sequences is its own decoded string, so it is copied in one block.
+                // Otherwise, a second pass decodes the escape sequences.
+                if ( textLength == stringLength )
+                {
+                    memcpy( storage, text, size_t( stringLength ) );
+                }
+                else
+                {
+                    ReadStringLiteral( text, &textLength, &stringLength, storage );
+                }
+            }
+
+            text += textLength;
+
+            if ( text[ 0 ] != '"' )
+            {
+                return ( Status::kExpectedEndingDoubleQuotes );
+            }
+
+            text++;
+
+            return ( Status::kOk );
+        }
+
+        template <class AllocateStorage>
+        Status ReadStringLiteralValue( const char*& text, AllocateStorage&& allocateStorage ) noexcept
+        {
+            return ReadStringLiteralValue( text, allocateStorage, []( const char*, int32 ) { return false; } );
+        }
+
+        // Decodes the escape sequences of a validated string literal over the literal itself and terminates it. A
+        // decoded character is never longer than its escape sequence, so the decoded string never overtakes the text
+        // still to be read.
+        void DecodeStringInPlace( char* text, int32 textLength ) noexcept
+        {
+            char*       string = text;
+            const char* end    = text + textLength;
+
+            for ( ;; )
+            {
+                char*       escape = static_cast<char*>( memchr( text, '\\', size_t( end - text ) ) );
+                const char* runEnd = escape ? escape : end;
+
+                memmove( string, text, size_t( runEnd - text ) );
+                string += runEnd - text;
+
+                if ( !escape )
+                {
+                    string[ 0 ] = 0;
+                    break;
+                }
+
+                char  decoded[ 4 ];
+                int32 decodedLength = 0;
+
+                text = escape + 1;
+                text += ReadStringEscapeChar( text, &decodedLength, decoded );
+
+                memcpy( string, decoded, size_t( decodedLength ) );
+                string += decodedLength;
+            }
+        }
+
+        // Reads a string literal of a buffer parsed in situ. A literal without escape sequences is terminated in place
+        // of its closing quote, and one with escape sequences is decoded when the parse has succeeded. Strings that
+        // fit the local buffer of String<> and need no decoding are stored there, and other strings refer to the
+        // buffer as external storage.
+        Status ReadStringValueInSitu( const char*& text, String<>& string, ParseContext& context ) noexcept
+        {
+            if ( text[ 0 ] != '"' )
+            {
+                return ( Status::kExpectedBeginingDoubleQuotes );
+            }
+
+            int32 textLength;
+            int32 stringLength;
+
+            text++;
+
+            Status status = ReadStringLiteral( text, &textLength, &stringLength );
+            if ( status != Status::kOk )
+            {
+                return ( status );
+            }
+
+            // The buffer is the one passed to ParseInSitu, which the caller gave up for modification.
+            char* literal = const_cast<char*>( text );
+
+            text += textLength + 1;
+
+            return MayThrow(
+                [ & ]()
+                {
+                    if ( textLength != stringLength )
+                    {
+                        context.escapedStrings.AppendArrayElement( EscapedString { literal, textLength } );
+                        string.SetExternalString( literal, stringLength );
+                    }
+                    else if ( stringLength <= kLocalStringLength )
+                    {
+                        string.SetStringLength( stringLength );
+
+                        char* storage = string;
+                        memcpy( storage, literal, size_t( stringLength ) );
+                        storage[ stringLength ] = 0;
+                    }
+                    else
+                    {
+                        literal[ stringLength ] = 0;
+                        string.SetExternalString( literal, stringLength );
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        // Reads a string literal into string. Strings that fit the local buffer of String<> are stored there, and
+        // longer ones are decoded into the arena and referenced as external storage.
+        Status ReadStringValue( const char*& text, String<>& string, ParseContext& context ) noexcept
+        {
+            if ( context.inSitu )
+            {
+                return ReadStringValueInSitu( text, string, context );
+            }
+
+            return ReadStringLiteralValue( text,
+                                           [ & ]( int32 stringLength )
+                                           {
+                                               if ( stringLength <= kLocalStringLength )
+                                               {
+                                                   string.SetStringLength( stringLength );
+                                                   return static_cast<char*>( string );
+                                               }
+
+                                               char* storage = static_cast<char*>( context.arena.Allocate( uint64( stringLength ) + 1, 1 ) );
+                                               string.SetExternalString( storage, stringLength );
+
+                                               return storage;
+                                           } );
+        }
+
+        // Returns whether a key is in the projection of the context.
+        bool IsProjectionKey( const char* name, int32 length, const ParseContext& context ) noexcept
+        {
+            uint32 hash = HashKey( name, length );
+
+            for ( int32 a = 0; a != context.projectionKeyCount; a++ )
+            {
+                const Key& key = context.projectionKeys[ a ];
+
+                if ( key.hash == hash && key.length == length && memcmp( key.name, name, size_t( length ) ) == 0 )
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Reads a member key and interns it if keepKey, called with its decoded name and length, returns true. A key
+        // without escape sequences is interned straight from the text. A key that is not kept is not stored, and its
+        // name is set to nullptr.
+        template <class KeepKey>
+        Status ReadKeyIf( const char*& text, Key& key, ParseContext& context, KeepKey&& keepKey ) noexcept
+        {
+            if ( text[ 0 ] != '"' )
+            {
+                return ( Status::kExpectedBeginingDoubleQuotes );
+            }
+
+            int32 textLength;
+            int32 stringLength;
+
+            text++;
+
+            Status status = ReadStringLiteral( text, &textLength, &stringLength );
+            if ( status != Status::kOk )
+            {
+                return ( status );
+            }
+
+            status = MayThrow(
+                [ & ]()
+                {
+                    const char* name = text;
+
+                    if ( textLength != stringLength )
+                    {
+                        context.keyBuffer.SetArrayElementCount( stringLength + 1 );
+                        ReadStringLiteral( text, &textLength, &stringLength, context.keyBuffer.begin() );
+                        name = context.keyBuffer.begin();
+                    }
+
+                    if ( !keepKey( name, stringLength ) )
+                    {
+                        key.name = nullptr;
+                    }
+                    else
+                    {
+                        key = context.keyTable.Intern( name, stringLength, context.arena );
+                    }
+
+                    return Status::kOk;
+                } );
+
+            if ( status != Status::kOk )
+            {
+                return status;
+            }
+
+            text += textLength;
+
+            if ( text[ 0 ] != '"' )
+            {
+                return ( Status::kExpectedEndingDoubleQuotes );
+            }
+
+            text++;
 
-            *value = v;
             return ( Status::kOk );
+        }
+
+        // Reads the key of a member into the key table, unless the context has a projection that leaves it out.
+        Status ReadKey( const char*& text, Key& key, ParseContext& context ) noexcept
+        {
+            return ReadKeyIf( text, key, context,
+                              [ & ]( const char* name, int32 length ) { return context.projectionKeyCount == 0 || IsProjectionKey( name, length, context ); } );
+        }
+
+        namespace Detail
+        {
+            int32 ComputeTextWhitespaceLength( const char* text ) noexcept
+            {
+                return ComputeWhitespaceLength( text );
+            }
+
+            // A string without escape sequences is reported in the text, and others are decoded into buffer.
+            Status ReadEventString( const char*& text, Array<char>& buffer, const char** string, int32* length ) noexcept
+            {
+                return ReadStringLiteralValue(
+                    text,
+                    [ & ]( int32 stringLength )
+                    {
+                        buffer.SetArrayElementCount( stringLength + 1 );
+
+                        *string = buffer.begin();
+                        *length = stringLength;
+
+                        return buffer.begin();
+                    },
+                    [ & ]( const char* literal, int32 stringLength )
+                    {
+                        *string = literal;
+                        *length = stringLength;
+
+                        return true;
+                    } );
+            }
+
+            Status ReadEventNumber( const char*& text, Number* number ) noexcept
+            {
+                Status status = ReadNumberLiteral( text, &number->type, &number->integer, &number->data );
+
+                if ( number->type == NumberType::kInt64 )
+                {
+                    number->data = double( int64( number->integer ) );
+                }
+                else if ( number->type == NumberType::kUInt64 )
+                {
+                    number->data = double( number->integer );
+                }
+
+                return status;
+            }
+
+            Status SkipEventString( const char*& text, Grammar grammar ) noexcept
+            {
+                if ( text[ 0 ] != '"' )
+                {
+                    return ( Status::kExpectedBeginingDoubleQuotes );
+                }
+
+                int32 textLength;
+                int32 stringLength;
+
+                text++;
+
+                Status status = ReadStringLiteral( text, &textLength, &stringLength, nullptr, grammar );
+                if ( status != Status::kOk )
+                {
+                    return ( status );
+                }
+
+                text += textLength + 1;
+
+                return ( Status::kOk );
+            }
+
+            Status SkipEventNumber( const char*& text, Grammar grammar ) noexcept
+            {
+                if ( grammar == Grammar::kRfc8259 )
+                {
+                    return ScanRfc8259NumberLiteral( text );
+                }
+
+                const char* literalEnd;
+
+                return ScanNumberLiteral( text, &literalEnd );
+            }
+        } // namespace Detail
+
+        // Marks the arena of a value as modified when the value is given memory outside it, or may be. The word in
+        // front of the value, written by Value::operator new, points to the arena, and is null for a heap value.
+        inline void MarkOwnerModified( const Value* value ) noexcept
+        {
+            Arena* arena = reinterpret_cast<Arena*>( machine_address( reinterpret_cast<const uint64*>( value )[ -1 ] ) );
+
+            if ( arena )
+            {
+                arena->MarkModified();
+            }
+        }
+
+        class StringValue final : public Value
+        {
+        public:
+            static Status Parse( StringValue* jsonStringValue, const char*& text, ParseContext& context ) noexcept
+            {
+                return ReadStringValue( text, jsonStringValue->data, context );
+            }
+
+        public:
+            using DataType = String<>;
+
+            DataType data;
+            ~StringValue() noexcept override {};
+
+            String<>* GetStringData() noexcept override
+            {
+                MarkOwnerModified( this );
+                return &data;
+            }
+
+            const String<>* GetStringData() const noexcept override
+            {
+                return &data;
+            }
+
+            Status Write( OutputSink& sink, uint32 /*indentationLength*/, const char /*indentationChar*/, Array<char>& /*indentationCharArray*/ ) const override
+            {
+                WriteStringLiteral( sink, data, data.GetStringLength() );
+
+                return Status::kOk;
+            }
+        };
+
+        class NumberValue final : public Value
+        {
+        public:
+            static Status Parse( NumberValue* value, const char*& text, ParseContext& context ) noexcept
+            {
+                if ( context.lazyNumbers )
+                {
+                    return ParseLiteral( value, text, context );
+                }
+
+                NumberType type;
+                uint64     integer = 0;
+                double     doubleData;
+
+                Status status = ReadNumberLiteral( text, &type, &integer, &doubleData );
+
+                if ( status == Status::kOk && value )
+                {
+                    value->Assign( type, integer, doubleData );
+                }
+
+                return status;
+            }
+
+        private:
+            // A number parsed with lazy numbers keeps its literal until it is first read. The literal is copied to the
+            // arena with a terminating null character, except in a buffer parsed in situ, which outlives the document
+            // and is never modified next to a number.
+            static Status ParseLiteral( NumberValue* value, const char*& text, ParseContext& context ) noexcept
+            {
+                const char* start = text;
+                const char* literalEnd;
+
+                Status status = ScanNumberLiteral( text, &literalEnd );
+
+                if ( status == Status::kOk && value )
+                {
+                    const char* literal = start;
+
+                    if ( !context.inSitu )
+                    {
+                        size_t length = size_t( literalEnd - start );
+                        char*  copy   = static_cast<char*>( context.arena.Allocate( length + 1, 1 ) );
+
+                        memcpy( copy, start, length );
+                        copy[ length ] = 0;
+                        literal        = copy;
+                    }
+
+                    value->literal = literal;
+                    value->pending = true;
+                }
+
+                return status;
+            }
+
+            mutable NumberType type    = NumberType::kDouble;
+            mutable bool       pending = false;
+
+            union
+            {
+                mutable int64       int64Data;
+                mutable uint64      uint64Data;
+                mutable const char* literal;
+            };
+
+            void Assign( NumberType numberType, uint64 integer, double doubleData ) const noexcept
+            {
+                type       = numberType;
+                pending    = false;
+                uint64Data = integer;
+
+                data = ( numberType == NumberType::kDouble ) ? doubleData : GetIntegerAsDouble();
+            }
+
+            double GetIntegerAsDouble() const noexcept
+            {
+                return ( type == NumberType::kInt64 ) ? double( int64Data ) : double( uint64Data );
+            }
+
+            // Converts the literal of a number parsed with lazy numbers, which was validated by the parse.
+            void Decode() const noexcept
+            {
+                if ( pending )
+                {
+                    const char* text = literal;
+                    NumberType  literalType;
+                    uint64      integer    = 0;
+                    double      doubleData = 0.0;
+
+                    ReadNumberLiteral( text, &literalType, &integer, &doubleData );
+                    Assign( literalType, integer, doubleData );
+                }
+            }
+
+        public:
+            using DataType        = double;
+            mutable DataType data = 0;
+
+            ~NumberValue() override {};
+
+            NumberValue* AsJsonNumberValue() noexcept override
+            {
+                return this;
+            }
+
+            const NumberValue* AsJsonNumberValue() const noexcept override
+            {
+                return this;
+            }
+
+            NumberType GetNumberType() const noexcept override
+            {
+                Decode();
+                return type;
+            }
+
+            // The double is kept equal to the integer, rounded to nearest, so that every number can be read as a
+            // double. A store through the mutable pointer cannot be told apart from a read, so handing it out turns
+            // the number into a double. Integers are read exactly through the const pointer.
+            double* GetDoubleData() noexcept override
+            {
+                Decode();
+                type = NumberType::kDouble;
+
+                return &data;
+            }
+
+            const double* GetDoubleData() const noexcept override
+            {
+                Decode();
+                return &data;
+            }
+
+            void SetInt64( int64 value ) noexcept
+            {
+                Assign( NumberType::kInt64, uint64( value ), 0.0 );
+            }
+
+            void SetUInt64( uint64 value ) noexcept
+            {
+                Assign( ( value < kInt64Magnitude ) ? NumberType::kInt64 : NumberType::kUInt64, value, 0.0 );
+            }
+
+            // Converts the number to an integer of type T without going through double for integer literals.
+            template <class T>
+            Status GetInteger( T* result ) const noexcept
+            {
+                Decode();
+                return ConvertNumberToInteger( type, GetIntegerBits(), data, result );
+            }
+
+            Status Write( OutputSink& sink, uint32 /*indentationLength*/, const char /*indentationChar*/, Array<char>& /*indentationCharArray*/ ) const override
+            {
+                Decode();
+                WriteNumber( sink, type, GetIntegerBits(), data );
+
+                return Status::kOk;
+            }
+
+        private:
+            uint64 GetIntegerBits() const noexcept
+            {
+                return ( type == NumberType::kInt64 ) ? uint64( int64Data ) : ( type == NumberType::kUInt64 ) ? uint64Data : 0;
+            }
+        };
+
+        class BoolValue final : public Value
+        {
+        public:
+            static Status Parse( BoolValue* value, const char*& text, ParseContext& /*context*/ ) noexcept
+            {
+                if ( MatchLiteral4( text, "true" ) )
+                {
+                    value->data = true;
+                    text += 4;
+
+                    return Status::kOk;
+                }
+
+                if ( text[ 0 ] == 'f' && MatchLiteral4( text + 1, "alse" ) )
+                {
+                    value->data = false;
+                    text += 5;
+
+                    return Status::kOk;
+                }
+
+                return Status::kExpectedTrueOrFalse;
+            }
+
+        public:
+            using DataType = bool;
+            DataType data  = true;
+
+            ~BoolValue() override {};
+
+            bool* GetBoolData() noexcept override
+            {
+                return &data;
+            }
+
+            const bool* GetBoolData() const noexcept override
+            {
+                return &data;
+            }
+
+            Status Write( OutputSink& sink, uint32, const char, Array<char>& ) const override
+            {
+
+                if ( data )
+                {
+                    sink << "true";
+                }
+                else
+                {
+                    sink << "false";
+                }
+
+                return Status::kOk;
+            }
+        };
+
+        class NullValue final : public Value
+        {
+        public:
+            static Status Parse( NullValue* /*JsonNullValue*/, const char*& text, ParseContext& /*context*/ ) noexcept
+            {
+                if ( MatchLiteral4( text, "null" ) )
+                {
+                    text += 4;
+
+                    return Status::kOk;
+                }
+
+                return Status::kExpectedNull;
+            }
+
+        public:
+            using DataType = Null;
+            DataType data;
+
+            ~NullValue() override {};
+
+            Null* GetJsonNullData() noexcept override
+            {
+                return &data;
+            }
+
+            const Null* GetJsonNullData() const noexcept override
+            {
+                return &data;
+            }
+
+            Status Write( OutputSink& sink, uint32 /*indentationLength*/, const char /*indentationChar*/, Array<char>& /*indentationCharArray*/ ) const override
+            {
+
+                sink << "null";
+
+                return Status::kOk;
+            }
+        };
+
+        // Writes the elements of an array, one per line, with writeElement( a ) writing element a.
+        template <class WriteElement>
+        Status WriteArrayElements( OutputSink& sink, int32 count, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray,
+                                   WriteElement&& writeElement )
+        {
+            sink << "[\n";
+
+            ExpandArray( indentationCharArray, indentationChar, indentationLength );
+            for ( int32 a = 0; a != count; a++ )
+            {
+                sink.Write( indentationCharArray.begin(), uint64( indentationCharArray.GetArrayElementCount() ) );
+
+                Status status = writeElement( a );
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                sink << ( a < count - 1 ? "," : "" ) << '\n';
+            }
+
+            indentationCharArray.SetArrayElementCount( indentationCharArray.GetArrayElementCount() - indentationLength );
+
+            sink.Write( indentationCharArray.begin(), uint64( indentationCharArray.GetArrayElementCount() ) );
+            sink << "]";
+
+            return Status::kOk;
+        }
+
+        // The arrays a StructuredData packs when array packing is enabled. Their elements are stored in the arena and
+        // referenced as external storage, which an array moves to the heap if it grows.
+        class NumberArrayValue final : public Value
+        {
+        public:
+            using DataType = Array<double>;
+
+            DataType data;
+            bool     integral = true;
+
+            ~NumberArrayValue() override {};
+
+            Array<double>* GetNumberArrayData() noexcept override
+            {
+                MarkOwnerModified( this );
+                return &data;
+            }
+
+            const Array<double>* GetNumberArrayData() const noexcept override
+            {
+                return &data;
+            }
+
+            Status Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const override
+            {
+                return WriteArrayElements( sink, data.GetArrayElementCount(), indentationLength, indentationChar, indentationCharArray,
+                                           [ & ]( int32 a )
+                                           {
+                                               double number = data[ a ];
+
+                                               if ( integral )
+                                               {
+                                                   WriteNumber( sink, NumberType::kInt64, uint64( int64( number ) ), number );
+                                               }
+                                               else
+                                               {
+                                                   WriteNumber( sink, NumberType::kDouble, 0, number );
+                                               }
+
+                                               return Status::kOk;
+                                           } );
+            }
+        };
+
+        class BoolArrayValue final : public Value
+        {
+        public:
+            using DataType = Array<bool>;
+
+            DataType data;
+
+            ~BoolArrayValue() override {};
+
+            Array<bool>* GetBoolArrayData() noexcept override
+            {
+                MarkOwnerModified( this );
+                return &data;
+            }
+
+            const Array<bool>* GetBoolArrayData() const noexcept override
+            {
+                return &data;
+            }
+
+            Status Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const override
+            {
+                return WriteArrayElements( sink, data.GetArrayElementCount(), indentationLength, indentationChar, indentationCharArray,
+                                           [ & ]( int32 a )
+                                           {
+                                               sink << ( data[ a ] ? "true" : "false" );
+
+                                               return Status::kOk;
+                                           } );
+            }
+        };
+
+        // Integers up to this magnitude are exact in double precision.
+        constexpr int64 kMaxPackedInteger = int64( 1 ) << 53;
+
+        // Reads the elements of an array with readElement, which returns false for an element that cannot be packed,
+        // and copies them to the arena. Returns nullptr, without moving text, if an element cannot be packed or the
+        // array is malformed, so that the array is parsed again as generic values, which reports any error at the
+        // same position.
+        template <class PackedValue, class Element, class ReadElement>
+        PackedValue* ParsePackedElements( const char*& text, ParseContext& context, Array<Element>& buffer, ReadElement&& readElement ) noexcept
+        {
+            const char* cursor = text + 1;
+
+            buffer.SetArrayElementCount( 0 );
+
+            for ( ;; )
+            {
+                Element element;
+
+                cursor += ComputeWhitespaceLength( cursor );
+                if ( !readElement( cursor, &element ) )
+                {
+                    return nullptr;
+                }
+
+                Status status = MayThrow(
+                    [ & ]()
+                    {
+                        buffer.AppendArrayElement( element );
+                        return Status::kOk;
+                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return nullptr;
+                }
+
+                cursor += ComputeWhitespaceLength( cursor );
+
+                if ( cursor[ 0 ] == ']' )
+                {
+                    break;
+                }
+
+                if ( cursor[ 0 ] != ',' )
+                {
+                    return nullptr;
+                }
+
+                cursor++;
+            }
+
+            PackedValue* packedValue = nullptr;
+
+            Status status = MayThrow(
+                [ & ]()
+                {
+                    int32    count   = buffer.GetArrayElementCount();
+                    Element* storage = static_cast<Element*>( context.arena.Allocate( sizeof( Element ) * uint64( count ), alignof( Element ) ) );
+
+                    memcpy( storage, buffer.begin(), sizeof( Element ) * size_t( count ) );
+
+                    packedValue = new ( context.arena ) PackedValue;
+                    packedValue->data.SetExternalArray( storage, count );
+
+                    return Status::kOk;
+                } );
+
+            if ( status != Status::kOk )
+            {
+                return nullptr;
+            }
+
+            text = cursor + 1;
+
+            return packedValue;
+        }
+
+        // Reads a number that can be stored as a double without losing its value, and clears integral if it is not
+        // an integer literal.
+        bool ReadPackedNumber( const char*& text, double* number, bool* integral ) noexcept
+        {
+            NumberType type;
+            uint64     integer;
+
+            if ( valueTypeTable.type[ uint8( text[ 0 ] ) ] != kValueTypeNumber || ReadNumberLiteral( text, &type, &integer, number ) != Status::kOk )
+            {
+                return false;
+            }
+
+            if ( type == NumberType::kDouble )
+            {
+                *integral = false;
+                return true;
+            }
+
+            int64 int64Data = int64( integer );
+            if ( type != NumberType::kInt64 || int64Data > kMaxPackedInteger || int64Data < -kMaxPackedInteger )
+            {
+                return false;
+            }
+
+            *number = double( int64Data );
+            return true;
+        }
+
+        bool ReadPackedBool( const char*& text, bool* element ) noexcept
+        {
+            if ( MatchLiteral4( text, "true" ) )
+            {
+                *element = true;
+                text += 4;
+
+                return true;
+            }
+
+            if ( text[ 0 ] == 'f' && MatchLiteral4( text + 1, "alse" ) )
+            {
+                *element = false;
+                text += 5;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        // Packs an array whose elements are all numbers or all bools. The type of the first element decides which
+        // is attempted.
+        bool ParsePackedArray( Value*& value, const char*& text, ParseContext& context ) noexcept
+        {
+            const char* first = text + 1;
+            first += ComputeWhitespaceLength( first );
+
+            uint8 type = valueTypeTable.type[ uint8( first[ 0 ] ) ];
+
+            if ( type == kValueTypeNumber )
+            {
+                bool integral = true;
+
+                NumberArrayValue* numberArray = ParsePackedElements<NumberArrayValue>( text, context, context.numberBuffer,
+                                                                                       [ & ]( const char*& cursor, double* number )
+                                                                                       { return ReadPackedNumber( cursor, number, &integral ); } );
+
+                if ( !numberArray )
+                {
+                    return false;
+                }
+
+                numberArray->integral = integral;
+                value                 = numberArray;
+
+                return true;
+            }
+
+            if ( type == kValueTypeBool )
+            {
+                BoolArrayValue* boolArray = ParsePackedElements<BoolArrayValue>( text, context, context.boolBuffer, ReadPackedBool );
+
+                if ( !boolArray )
+                {
+                    return false;
+                }
+
+                value = boolArray;
+
+                return true;
+            }
+
+            return false;
+        }
+
+        namespace Detail
+        {
+            template <>
+            Value* CreateValueFor( const String<>& ) noexcept( false )
+            {
+                return new StringValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const double& ) noexcept( false )
+            {
+                return new NumberValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const bool& ) noexcept( false )
+            {
+                return new BoolValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const Null& ) noexcept( false )
+            {
+                return new NullValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const int32& ) noexcept( false )
+            {
+                return new NumberValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const int64& ) noexcept( false )
+            {
+                return new NumberValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const uint32& ) noexcept( false )
+            {
+                return new NumberValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const uint64& ) noexcept( false )
+            {
+                return new NumberValue;
+            }
+
+            template <>
+            Value* CreateValueFor( const StringView& ) noexcept( false )
+            {
+                return new StringValue;
+            }
+
+            Status ConvertPackedNumber( double number, int32* result ) noexcept
+            {
+                return ConvertNumberToInteger( NumberType::kDouble, 0, number, result );
+            }
+
+            Status ConvertPackedNumber( double number, int64* result ) noexcept
+            {
+                return ConvertNumberToInteger( NumberType::kDouble, 0, number, result );
+            }
+
+            Status ConvertPackedNumber( double number, uint32* result ) noexcept
+            {
+                return ConvertNumberToInteger( NumberType::kDouble, 0, number, result );
+            }
+
+            Status ConvertPackedNumber( double number, uint64* result ) noexcept
+            {
+                return ConvertNumberToInteger( NumberType::kDouble, 0, number, result );
+            }
+
+        } // namespace Detail
+
+        template <class T>
+        Status ReadIntegerValue( const Value* value, T& data ) noexcept
+        {
+            const NumberValue* numberValue = value->AsJsonNumberValue();
+
+            if ( !numberValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return numberValue->GetInteger( &data );
+        }
+
+        template <class T>
+        Status WriteIntegerValue( Value* value, const T& data ) noexcept
+        {
+            NumberValue* numberValue = value->AsJsonNumberValue();
+
+            if ( !numberValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            if ( data < T( 0 ) )
+            {
+                numberValue->SetInt64( int64( data ) );
+            }
+            else
+            {
+                numberValue->SetUInt64( uint64( data ) );
+            }
+
+            return Status::kOk;
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const int32& /*data*/ ) noexcept
+        {
+            int32 temp;
+
+            return ReadIntegerValue( value, temp );
+        }
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, int32& data ) noexcept
+        {
+            return ReadIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const int32& data ) noexcept
+        {
+            return WriteIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const int64& /*data*/ ) noexcept
+        {
+            int64 temp;
+
+            return ReadIntegerValue( value, temp );
+        }
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, int64& data ) noexcept
+        {
+            return ReadIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const int64& data ) noexcept
+        {
+            return WriteIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const uint32& /*data*/ ) noexcept
+        {
+            uint32 temp;
+
+            return ReadIntegerValue( value, temp );
+        }
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, uint32& data ) noexcept
+        {
+            return ReadIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const uint32& data ) noexcept
+        {
+            return WriteIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const uint64& /*data*/ ) noexcept
+        {
+            uint64 temp;
+
+            return ReadIntegerValue( value, temp );
+        }
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, uint64& data ) noexcept
+        {
+            return ReadIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const uint64& data ) noexcept
+        {
+            return WriteIntegerValue( value, data );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const StringView& /*data*/ ) noexcept
+        {
+            return value->GetDataAsPointerTo<String<>>() ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, StringView& data ) noexcept
+        {
+            const String<>* valueData = value->GetDataAsPointerTo<String<>>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            data = StringView( *valueData, valueData->GetStringLength() );
+
+            return Status::kOk;
+        }
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const StringView& data ) noexcept
+        {
+            String<>* valueData = value->GetDataAsPointerTo<String<>>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    valueData->Set( data.text, data.length );
+
+                    return Status::kOk;
+                } );
+        }
+
+        Status ArrayValue::Parse( ArrayValue* jsonArray, const char*& text, ParseContext& context ) noexcept
+        {
+            if ( text[ 0 ] != '[' )
+            {
+                return Status::kExpectedOpeningSquareBrackets;
+            }
+
+            int32 stackBase  = context.elementStack.GetArrayElementCount();
+            bool  emptyArray = true;
+
+            for ( ;; )
+            {
+                text++;
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] == ']' )
+                {
+                    if ( !emptyArray )
+                    {
+                        return Status::kExpectedJsonValue;
+                    }
+
+                    text++;
+
+                    return Status::kOk;
+                }
+
+                Value* jsonValue = nullptr;
+                Status status    = ParseAnyValue( jsonValue, text, context );
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                status = MayThrow(
+                    [ & ]()
+                    {
+                        context.elementStack.AppendArrayElement( jsonValue );
+                        return Status::kOk;
+                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                emptyArray = false;
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] != ',' )
+                {
+                    break;
+                }
+            }
+
+            if ( text[ 0 ] != ']' )
+            {
+                return Status::kExpectedClosingSquareBracketsOrComma;
+            }
+
+            text++;
+
+            return FinishParse( jsonArray, stackBase, context );
+        }
+
+        Status ArrayValue::FinishParse( ArrayValue* jsonArray, int32 stackBase, ParseContext& context ) noexcept
+        {
+            return MayThrow(
+                [ & ]()
+                {
+                    int32 count = context.elementStack.GetArrayElementCount() - stackBase;
+                    if ( count == 0 )
+                    {
+                        return Status::kOk;
+                    }
+
+                    Value** storage = static_cast<Value**>( context.arena.Allocate( sizeof( Value* ) * uint64( count ), alignof( Value* ) ) );
+
+                    memcpy( storage, &context.elementStack[ stackBase ], sizeof( Value* ) * size_t( count ) );
+                    jsonArray->data.SetExternalArray( storage, count );
+                    context.elementStack.SetArrayElementCount( stackBase );
+
+                    return Status::kOk;
+                } );
+        }
+
+        ArrayValue::~ArrayValue()
+        {
+            for ( auto pointer : data )
+            {
+                delete pointer;
+            }
+        };
+
+        Array<Value*>* ArrayValue::GetJsonValueArrayData() noexcept
+        {
+            MarkOwnerModified( this );
+            return &data;
+        }
+
+        const Array<Value*>* ArrayValue::GetJsonValueArrayData() const noexcept
+        {
+            return &data;
+        }
+
+        Status ArrayValue::Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const
+        {
+            return WriteArrayElements( sink, data.GetArrayElementCount(), indentationLength, indentationChar, indentationCharArray,
+                                       [ & ]( int32 a ) { return data[ a ]->Write( sink, indentationLength, indentationChar, indentationCharArray ); } );
+        }
+
+        Value::~Value() noexcept
+        {
+        }
+
+        static_assert( alignof( StringValue ) <= sizeof( uint64 ) && alignof( NumberValue ) <= sizeof( uint64 ) && alignof( BoolValue ) <= sizeof( uint64 ) &&
+                           alignof( NullValue ) <= sizeof( uint64 ) && alignof( ArrayValue ) <= sizeof( uint64 ) &&
+                           alignof( ObjectValue ) <= sizeof( uint64 ) && alignof( NumberArrayValue ) <= sizeof( uint64 ) &&
+                           alignof( BoolArrayValue ) <= sizeof( uint64 ),
+                       "Json4C4: Values must not need more alignment than the allocation word in front of them provides." );
+
+        void* Value::operator new( size_t size )
+        {
+            uint64* word = reinterpret_cast<uint64*>( new char[ size + sizeof( uint64 ) ] );
+            word[ 0 ]    = 0;
+
+            return word + 1;
+        }
+
+        void* Value::operator new( size_t size, Arena& arena )
+        {
+            uint64* word = static_cast<uint64*>( arena.Allocate( size + sizeof( uint64 ), sizeof( uint64 ) ) );
+            word[ 0 ]    = uint64( machine_address( &arena ) );
+
+            return word + 1;
+        }
+
+        void Value::operator delete( void* pointer ) noexcept
+        {
+            if ( pointer )
+            {
+                uint64* word = static_cast<uint64*>( pointer ) - 1;
+                if ( word[ 0 ] == 0 )
+                {
+                    delete[] reinterpret_cast<char*>( word );
+                }
+            }
+        }
+
+        void Value::operator delete( void* /*pointer*/, Arena& /*arena*/ ) noexcept
+        {
+        }
+
+        // The hash index has at least twice as many slots as the object has members, so probe sequences stay short.
+        inline int32 ComputeHashIndexCapacity( int32 memberCount ) noexcept
+        {
+            int32 capacity = ObjectValue::kObjectHashThreshold * 2;
+
+            while ( capacity < memberCount * 2 )
+            {
+                capacity *= 2;
+            }
+
+            return capacity;
+        }
+
+        // The values of members left out by a projection are skipped by these, which are defined after ParseDocument.
+        Status CheckAnyValue( const char*& text ) noexcept;
+        Status SkipTrustedValue( const char*& text ) noexcept;
+
+        Status ObjectValue::Parse( ObjectValue* jsonObject, const char*& text, ParseContext& context ) noexcept
+        {
+            if ( text[ 0 ] != '{' )
+            {
+                return Status::kExpectedOpeningCurlyBraces;
+            }
+
+            int32 stackBase   = context.memberStack.GetArrayElementCount();
+            bool  emptyObject = true;
+
+            for ( ;; )
+            {
+                text++;
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] == '}' )
+                {
+                    if ( !emptyObject )
+                    {
+                        return Status::kExpectedJsonValue;
+                    }
+                    text++;
+
+                    return Status::kOk;
+                }
+
+                // The member is read in place on the stack, which parsing the value may grow, so it is referred to
+                // by index.
+                int32  memberIndex = context.memberStack.GetArrayElementCount();
+                Status status      = MayThrow(
+                    [ & ]()
+                    {
+                        context.memberStack.AppendArrayElement();
+                        return Status::kOk;
+                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                status = ReadKey( text, context.memberStack[ memberIndex ].key, context );
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] != ':' )
+                {
+                    return Status::kExpectedColon;
+                }
+
+                text++;
+                text += ComputeWhitespaceLength( text );
+
+                if ( !context.memberStack[ memberIndex ].key.name )
+                {
+                    context.memberStack.SetArrayElementCount( memberIndex );
+
+                    status = context.trustedSkipping ? SkipTrustedValue( text ) : CheckAnyValue( text );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+                }
+                else
+                {
+                    Value* jsonValue = nullptr;
+
+                    status = ParseAnyValue( jsonValue, text, context );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+
+                    context.memberStack[ memberIndex ].value = jsonValue;
+                }
+
+                emptyObject = false;
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] != ',' )
+                {
+                    break;
+                }
+            }
+
+            if ( text[ 0 ] != '}' )
+            {
+                return Status::kExpectedClosingCurlyBracesOrComma;
+            }
+
+            text++;
+
+            return FinishParse( jsonObject, stackBase, context );
+        }
+
+        Status ObjectValue::FinishParse( ObjectValue* jsonObject, int32 stackBase, ParseContext& context ) noexcept
+        {
+            return MayThrow(
+                [ & ]()
+                {
+                    int32         count   = context.memberStack.GetArrayElementCount() - stackBase;
+                    ObjectMember* storage = static_cast<ObjectMember*>( context.arena.Allocate( sizeof( ObjectMember ) * uint64( count ), alignof( ObjectMember ) ) );
+
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        new ( &storage[ a ] ) ObjectMember( static_cast<ObjectMember&&>( context.memberStack[ stackBase + a ] ) );
+                    }
+
+                    jsonObject->members.SetExternalArray( storage, count );
+                    context.memberStack.SetArrayElementCount( stackBase );
+
+                    if ( count > kObjectHashThreshold )
+                    {
+                        int32 capacity = ComputeHashIndexCapacity( count );
+                        jsonObject->hashIndex.SetExternalArray( static_cast<int32*>( context.arena.Allocate( sizeof( int32 ) * uint64( capacity ), alignof( int32 ) ) ),
+                                                                capacity );
+                        jsonObject->FillHashIndex();
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        ObjectValue::~ObjectValue() noexcept
+        {
+            for ( ObjectMember& member : members )
+            {
+                delete member.value;
+            }
+
+            for ( char* key : ownedKeys )
+            {
+                delete[] key;
+            }
+        }
+
+        ObjectValue* ObjectValue::AsJsonObjectValue() noexcept
+        {
+            return this;
+        }
+
+        const ObjectValue* ObjectValue::AsJsonObjectValue() const noexcept
+        {
+            return this;
+        }
+
+        // Keys interned by the same document are equal exactly when their addresses are, and keys with different
+        // hashes differ, so the characters are only compared for keys from different sources.
+        inline bool MatchKey( const Key& memberKey, const Key& key ) noexcept
+        {
+            return memberKey.name == key.name ||
+                   ( memberKey.hash == key.hash && memberKey.length == key.length && memcmp( memberKey.name, key.name, size_t( key.length ) ) == 0 );
+        }
+
+        int32 ObjectValue::SearchMembers( const char* name, int32 length ) const noexcept
+        {
+            const ObjectMember* member = members.begin();
+            int32               count  = members.GetArrayElementCount();
+
+            for ( int32 a = 0; a != count; a++ )
+            {
+                if ( member[ a ].key.length == length && memcmp( member[ a ].key.name, name, size_t( length ) ) == 0 )
+                {
+                    return a;
+                }
+            }
+
+            return -1;
+        }
+
+        int32 ObjectValue::SearchMembers( const Key& key ) const noexcept
+        {
+            const ObjectMember* member = members.begin();
+            int32               count  = members.GetArrayElementCount();
+
+            for ( int32 a = 0; a != count; a++ )
+            {
+                if ( MatchKey( member[ a ].key, key ) )
+                {
+                    return a;
+                }
+            }
+
+            return -1;
+        }
+
+        int32 ObjectValue::ProbeHashIndex( const Key& key ) const noexcept
+        {
+            const ObjectMember* member = members.begin();
+            uint32              mask   = uint32( hashIndex.GetArrayElementCount() - 1 );
+
+            for ( uint32 slot = key.hash & mask;; slot = ( slot + 1 ) & mask )
+            {
+                int32 entry = hashIndex[ int32( slot ) ];
+                if ( entry == 0 )
+                {
+                    return -1;
+                }
+
+                if ( MatchKey( member[ entry - 1 ].key, key ) )
+                {
+                    return entry - 1;
+                }
+            }
+        }
+
+        int32 ObjectValue::FindMemberIndex( const char* name, int32 length ) const noexcept
+        {
+            if ( hashIndex.GetArrayElementCount() == 0 )
+            {
+                return SearchMembers( name, length );
+            }
+
+            return ProbeHashIndex( Key( name, length ) );
+        }
+
+        int32 ObjectValue::FindMemberIndex( const Key& key ) const noexcept
+        {
+            if ( hashIndex.GetArrayElementCount() == 0 )
+            {
+                return SearchMembers( key );
+            }
+
+            return ProbeHashIndex( key );
+        }
+
+        // Slots hold member indices plus one, and zero marks an empty slot. Members with equal keys are inserted in
+        // order along the same probe sequence, so a lookup finds the first of them, as the linear search does.
+        void ObjectValue::InsertIntoHashIndex( int32 memberIndex ) noexcept
+        {
+            uint32 mask = uint32( hashIndex.GetArrayElementCount() - 1 );
+            uint32 slot = members[ memberIndex ].key.hash & mask;
+
+            while ( hashIndex[ int32( slot ) ] != 0 )
+            {
+                slot = ( slot + 1 ) & mask;
+            }
+
+            hashIndex[ int32( slot ) ] = memberIndex + 1;
+        }
+
+        void ObjectValue::FillHashIndex() noexcept
+        {
+            memset( hashIndex.begin(), 0, sizeof( int32 ) * size_t( hashIndex.GetArrayElementCount() ) );
+
+            for ( int32 a = 0; a != members.GetArrayElementCount(); a++ )
+            {
+                InsertIntoHashIndex( a );
+            }
+        }
+
+        void ObjectValue::AddMember( const char* name, Value* value )
+        {
+            MarkOwnerModified( this );
+
+            int32 length = GetKeyLength( name );
+            int32 count  = members.GetArrayElementCount() + 1;
+
+            // Everything that can throw happens before the member is appended. An object without an index is
+            // searched linearly, so failing to allocate a new index leaves the object consistent, and a new index
+            // is filled with the existing members before the key is allocated.
+            members.ReserveArrayElementCount( count );
+            ownedKeys.ReserveArrayElementCount( ownedKeys.GetArrayElementCount() + 1 );
+
+            if ( count > kObjectHashThreshold && count * 2 > hashIndex.GetArrayElementCount() )
+            {
+                hashIndex.PurgeArray();
+                hashIndex.SetArrayElementCount( ComputeHashIndexCapacity( count ) );
+                FillHashIndex();
+            }
+
+            char* storage = new char[ length + 1 ];
+            memcpy( storage, name, size_t( length ) + 1 );
+
+            ownedKeys.AppendArrayElement( storage );
+            members.AppendArrayElement( ObjectMember { Key( storage, length ), value } );
+
+            if ( hashIndex.GetArrayElementCount() != 0 )
+            {
+                InsertIntoHashIndex( count - 1 );
+            }
+        }
+
+        void ObjectValue::RemoveAllMembers() noexcept
+        {
+            for ( ObjectMember& member : members )
+            {
+                delete member.value;
+            }
+
+            for ( char* key : ownedKeys )
+            {
+                delete[] key;
+            }
+
+            members.PurgeArray();
+            hashIndex.PurgeArray();
+            ownedKeys.PurgeArray();
+        }
+
+        template <class T>
+        const T* GetMemberData( const Value* jsonValue ) noexcept
+        {
+            return jsonValue ? jsonValue->GetDataAsPointerTo<T>() : nullptr;
+        }
+
+        inline const ObjectValue* GetMemberObject( const Value* jsonValue ) noexcept
+        {
+            return jsonValue ? jsonValue->AsJsonObjectValue() : nullptr;
+        }
+
+        const String<>* ObjectValue::FindString( const char* name ) const noexcept
+        {
+            return GetMemberData<String<>>( FindMember( name ) );
+        }
+
+        const double* ObjectValue::FindNumber( const char* name ) const noexcept
+        {
+            return GetMemberData<double>( FindMember( name ) );
+        }
+
+        const bool* ObjectValue::FindBool( const char* name ) const noexcept
+        {
+            return GetMemberData<bool>( FindMember( name ) );
+        }
+
+        const Null* ObjectValue::FindJsonNull( const char* name ) const noexcept
+        {
+            return GetMemberData<Null>( FindMember( name ) );
+        }
+
+        const Array<Value*>* ObjectValue::FindJsonValueArray( const char* name ) const noexcept
+        {
+            return GetMemberData<Array<Value*>>( FindMember( name ) );
+        }
+
+        const ObjectValue* ObjectValue::FindJsonObjectValue( const char* name ) const noexcept
+        {
+            return GetMemberObject( FindMember( name ) );
+        }
+
+        const String<>* ObjectValue::FindString( const Key& key ) const noexcept
+        {
+            return GetMemberData<String<>>( FindMember( key ) );
+        }
+
+        const double* ObjectValue::FindNumber( const Key& key ) const noexcept
+        {
+            return GetMemberData<double>( FindMember( key ) );
+        }
+
+        const bool* ObjectValue::FindBool( const Key& key ) const noexcept
+        {
+            return GetMemberData<bool>( FindMember( key ) );
+        }
+
+        const Null* ObjectValue::FindJsonNull( const Key& key ) const noexcept
+        {
+            return GetMemberData<Null>( FindMember( key ) );
+        }
+
+        const Array<Value*>* ObjectValue::FindJsonValueArray( const Key& key ) const noexcept
+        {
+            return GetMemberData<Array<Value*>>( FindMember( key ) );
+        }
+
+        const ObjectValue* ObjectValue::FindJsonObjectValue( const Key& key ) const noexcept
+        {
+            return GetMemberObject( FindMember( key ) );
+        }
+
+        // Returns the value of a reference token that is an array index, or -1. Indices that an int32 cannot hold
+        // cannot refer to an element, so they are not indices either.
+        inline int32 ReadPointerIndex( const char* token, int32 length ) noexcept
+        {
+            if ( length == 0 || length > 10 || ( token[ 0 ] == '0' && length != 1 ) )
+            {
+                return -1;
+            }
+
+            int64 index = 0;
+
+            for ( int32 a = 0; a != length; a++ )
+            {
+                if ( uint32( token[ a ] - '0' ) > 9 )
+                {
+                    return -1;
+                }
+
+                index = index * 10 + ( token[ a ] - '0' );
+            }
+
+            return ( index <= 0x7FFFFFFF ) ? int32( index ) : -1;
+        }
+
+        // Checks that every tilde in a pointer begins one of the escape sequences ~0 and ~1.
+        inline bool CheckPointerEscapes( const char* pointer, const char* end ) noexcept
+        {
+            for ( const char* c = pointer; c != end; c++ )
+            {
+                if ( c[ 0 ] == '~' && ( c + 1 == end || ( c[ 1 ] != '0' && c[ 1 ] != '1' ) ) )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Compares a member key with a reference token that holds escape sequences.
+        inline bool MatchEscapedToken( const Key& key, const char* token, const char* tokenEnd ) noexcept
+        {
+            int32 length = 0;
+
+            for ( const char* c = token; c != tokenEnd; c++, length++ )
+            {
+                char expected = c[ 0 ];
+
+                if ( expected == '~' )
+                {
+                    c++;
+                    expected = ( c[ 0 ] == '0' ) ? '~' : '/';
+                }
+
+                if ( length == key.length || key.name[ length ] != expected )
+                {
+                    return false;
+                }
+            }
+
+            return length == key.length;
+        }
+
+        Status CompiledPointer::Compile( const char* pointer, int32 length ) noexcept
+        {
+            tokens.ClearArray();
+            compiled = false;
+
+            if ( ( length != 0 && pointer[ 0 ] != '/' ) || !CheckPointerEscapes( pointer, pointer + length ) )
+            {
+                return Status::kInvalidPointer;
+            }
+
+            Status status = MayThrow(
+                [ & ]()
+                {
+                    // Unescaping never lengthens a token, so the names fit in the length of the pointer and the keys
+                    // that refer to them are not moved by a later token.
+                    names.SetArrayElementCount( length );
+
+                    const char* c    = pointer;
+                    const char* end  = pointer + length;
+                    char*       name = names.begin();
+
+                    while ( c != end )
+                    {
+                        char* tokenName = name;
+
+                        for ( c++; c != end && c[ 0 ] != '/'; c++ )
+                        {
+                            if ( c[ 0 ] == '~' )
+                            {
+                                c++;
+                                *name++ = ( c[ 0 ] == '0' ) ? '~' : '/';
+                            }
+                            else
+                            {
+                                *name++ = c[ 0 ];
+                            }
+                        }
+
+                        int32 tokenLength = int32( name - tokenName );
+
+                        tokens.AppendArrayElement( Token { Key( tokenName, tokenLength ), ReadPointerIndex( tokenName, tokenLength ) } );
+                    }
+
+                    return Status::kOk;
+                } );
+
+            if ( status != Status::kOk )
+            {
+                tokens.ClearArray();
+                return status;
+            }
+
+            compiled = true;
+
+            return Status::kOk;
+        }
+
+        // Looks up a reference token in an object as a key, and in an array as an index.
+        inline const Value* FindPointerToken( const Value* value, const Key& key, int32 index ) noexcept
+        {
+            if ( const ObjectValue* object = value->AsJsonObjectValue() )
+            {
+                return object->FindMember( key );
+            }
+
+            const Array<Value*>* elements = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !elements || index < 0 || index >= elements->GetArrayElementCount() )
+            {
+                return nullptr;
+            }
+
+            return ( *elements )[ index ];
+        }
+
+        // Each token is looked up straight from the text of the pointer. Tokens without escape sequences are looked
+        // up as keys of their length, and the rare tokens with them are compared with each member key in turn.
+        const Value* Value::FindPointer( const char* pointer ) const noexcept
+        {
+            const char* end = pointer + GetKeyLength( pointer );
+
+            if ( ( pointer != end && pointer[ 0 ] != '/' ) || !CheckPointerEscapes( pointer, end ) )
+            {
+                return nullptr;
+            }
+
+            const Value* value = this;
+
+            for ( const char* c = pointer; value && c != end; )
+            {
+                const char* token   = ++c;
+                bool        escaped = false;
+
+                for ( ; c != end && c[ 0 ] != '/'; c++ )
+                {
+                    escaped |= ( c[ 0 ] == '~' );
+                }
+
+                int32 length = int32( c - token );
+
+                if ( !escaped )
+                {
+                    value = FindPointerToken( value, Key( token, length ), ReadPointerIndex( token, length ) );
+                }
+                else if ( const ObjectValue* object = value->AsJsonObjectValue() )
+                {
+                    const Value* memberValue = nullptr;
+
+                    for ( const ObjectMember& member : *object )
+                    {
+                        if ( MatchEscapedToken( member.key, token, c ) )
+                        {
+                            memberValue = member.value;
+                            break;
+                        }
+                    }
+
+                    value = memberValue;
+                }
+                else
+                {
+                    value = nullptr;
+                }
+            }
+
+            return value;
+        }
+
+        const Value* Value::FindPointer( const CompiledPointer& pointer ) const noexcept
+        {
+            if ( !pointer.IsCompiled() )
+            {
+                return nullptr;
+            }
+
+            const Value* value = this;
+
+            for ( int32 a = 0; value && a != pointer.GetTokenCount(); a++ )
+            {
+                const CompiledPointer::Token& token = pointer.GetToken( a );
+
+                value = FindPointerToken( value, token.key, token.index );
+            }
+
+            return value;
+        }
+
+        Status ObjectValue::Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const
+        {
+            sink << "{\n";
+
+            ExpandArray( indentationCharArray, indentationChar, indentationLength );
+
+            int32 count = members.GetArrayElementCount();
+
+            for ( int32 a = 0; a != count; a++ )
+            {
+                const ObjectMember& member = members[ a ];
+
+                sink.Write( indentationCharArray.begin(), uint64( indentationCharArray.GetArrayElementCount() ) );
+
+                WriteStringLiteral( sink, member.key.name, member.key.length );
+
+                sink << " : ";
+
+                Status status = member.value->Write( sink, indentationLength, indentationChar, indentationCharArray );
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                sink << ( a < count - 1 ? "," : "" ) << '\n';
+            }
+
+            indentationCharArray.SetArrayElementCount( indentationCharArray.GetArrayElementCount() - indentationLength );
+
+            sink.Write( indentationCharArray.begin(), uint64( indentationCharArray.GetArrayElementCount() ) );
+            sink << "}";
+
+            return Status::kOk;
+        }
+
+        namespace Detail
+        {
+            // Counts the lines and the characters of the first line from the first character of the document to the
+            // character where parsing stopped.
+            void LocateParseError( const char* start, const char* text, int32* errorLine, int32* errorColumn ) noexcept
+            {
+                *errorLine   = 1;
+                *errorColumn = 1;
+
+                while ( text != start )
+                {
+                    if ( ( --text )[ 0 ] == '\n' )
+                    {
+                        ( *errorLine )++;
+                    }
+                    *errorColumn += ( ( *errorLine ) == 1 ) ? 1 : 0;
+                }
+            }
+        } // namespace Detail
+
+        // Parses the single value of a document, surrounded by optional whitespace, with parseValue. If parsing fails,
+        // the line and column of the character where it stopped are reported.
+        template <class ParseValueFunction>
+        Status ParseDocument( const char* nullTerminatedText, int32* errorLine, int32* errorColumn, ParseValueFunction&& parseValue ) noexcept
+        {
+            const char* text = nullTerminatedText;
+            text += ComputeWhitespaceLength( text );
+
+            const char* start = text;
+
+            Status status = parseValue( text );
+
+            text += ComputeWhitespaceLength( text );
+            if ( status == Status::kOk && text[ 0 ] != 0 )
+            {
+                status = Status::kExpectedEndOfFile;
+            }
+
+            if ( status != Status::kOk )
+            {
+                Detail::LocateParseError( start, text, errorLine, errorColumn );
+            }
+
+            return status;
+        }
+
+        Status ParseJsonRoot( Value*& jsonRoot, const char* nullTerminatedText, int32* errorLine, int32* errorColumn, ParseContext& context ) noexcept
+        {
+            return ParseDocument( nullTerminatedText, errorLine, errorColumn, [ & ]( const char*& text ) { return ParseAnyValue( jsonRoot, text, context ); } );
+        }
+
+        // Checks the syntax of a value with the event parser, which handles no events, so nothing is built or decoded.
+        // The parser follows the grammar of ParseAnyValue without recursion, and leaves text where parsing would leave
+        // it, so errors are reported at the same positions.
+        Status CheckAnyValue( const char*& text ) noexcept
+        {
+            EventHandler handler;
+            Array<char>  buffer;
+
+            return MayThrow( [ & ]() { return Detail::ParseEventValue<Grammar::kParse>( text, handler, buffer ); } );
+        }
+
+        inline bool IsStructuralCharacter( uint32 c ) noexcept
+        {
+            return c == '"' || c == '\\' || ( c | 0x20 ) == '{' || ( c | 0x20 ) == '}' || c == 0;
+        }
+
+        // Skips a value by finding its end without checking its syntax. A string or a container ends at the quote
+        // or bracket that balances its first character, and only double quotes, backslashes, brackets, and braces
+        // are looked at to find it, a block at a time. Any other value ends at the next whitespace, comma, bracket,
+        // or brace. The null terminator is never passed, and reaching it inside a string or a container is
+        // reported as Status::kPrematureNullTerminator there. Mismatched brackets and malformed literals are not.
+        Status SkipTrustedValue( const char*& text ) noexcept
+        {
+            const uint8* byte = reinterpret_cast<const uint8*>( text );
+            uint32       c    = byte[ 0 ];
+
+            if ( valueTypeTable.type[ c ] == kValueTypeInvalid )
+            {
+                return Status::kExpectedJsonValue;
+            }
+
+            if ( c != '"' && c != '[' && c != '{' )
+            {
+                while ( !IsWhitespace( c ) && c != ',' && ( c | 0x20 ) != '}' && c != 0 )
+                {
+                    c = *++byte;
+                }
+
+                text = reinterpret_cast<const char*>( byte );
+
+                return Status::kOk;
+            }
+
+            const uint8* escaped  = byte;
+            int32        depth    = 0;
+            bool         inString = false;
+
+#ifdef JSON4C4_SIMD
+
+            // As for whitespace, blocks are loaded from aligned addresses, and the null terminator is in the mask,
+            // so no block past the end of the text is read.
+            const uint8* block = reinterpret_cast<const uint8*>( machine_address( byte ) & ~( kSimdBlockSize - 1 ) );
+            uint64       mask  = ComputeStructuralMask( block ) & ( ~uint64( 0 ) << ( uint32( byte - block ) * kSimdMaskBitsPerByte ) );
+
+#endif
+
+            for ( ;; )
+            {
+#ifdef JSON4C4_SIMD
+
+                while ( mask == 0 )
+                {
+                    block += kSimdBlockSize;
+                    mask = ComputeStructuralMask( block );
+                }
+
+                uint32 bit = CountTrailingZeros( mask );
+
+                byte = block + bit / kSimdMaskBitsPerByte;
+                mask &= ~( ( ( uint64( 1 ) << kSimdMaskBitsPerByte ) - 1 ) << ( bit & ~( kSimdMaskBitsPerByte - 1 ) ) );
+
+#else
+
+                while ( !IsStructuralCharacter( byte[ 0 ] ) )
+                {
+                    byte++;
+                }
+
+#endif
+
+                c = byte[ 0 ];
+
+                // The character after a backslash in a string is part of its escape sequence.
+                if ( byte < escaped )
+                {
+#ifndef JSON4C4_SIMD
+                    byte++;
+#endif
+                    continue;
+                }
+
+                if ( c == 0 )
+                {
+                    text = reinterpret_cast<const char*>( byte );
+
+                    return Status::kPrematureNullTerminator;
+                }
+
+                if ( inString )
+                {
+                    if ( c == '"' )
+                    {
+                        inString = false;
+
+                        if ( depth == 0 )
+                        {
+                            break;
+                        }
+                    }
+                    else if ( c == '\\' && byte[ 1 ] != 0 )
+                    {
+                        escaped = byte + 2;
+                    }
+                }
+                else if ( c == '"' )
+                {
+                    inString = true;
+                }
+                else if ( c == '[' || c == '{' )
+                {
+                    depth++;
+                }
+                else if ( ( c == ']' || c == '}' ) && --depth == 0 )
+                {
+                    break;
+                }
+
+#ifndef JSON4C4_SIMD
+                byte++;
+#endif
+            }
+
+            text = reinterpret_cast<const char*>( byte + 1 );
+
+            return Status::kOk;
+        }
+
+        // Holds the null-terminated contents of a file for the duration of a parse. On Linux, regular files are
+        // memory mapped on top of a reserved anonymous region one byte larger than the file, so the terminator
+        // comes either from the zero-filled remainder of the last file page or from the anonymous page after it.
+        // Files that cannot be mapped (pipes, procfs, empty or special files) are read in chunks instead.
+        class TextFile
+        {
+        private:
+            const char* text       = nullptr;
+            uint64      textLength = 0;
+            char*       heapBuffer = nullptr;
+
+#if defined( JSON4C4_LINUX ) && !defined( C4_ENGINE_MODULE )
+
+            void*  mappedAddress = nullptr;
+            size_t mappedLength  = 0;
+
+            Status MapFile( int fileDescriptor, uint64 fileSize ) noexcept
+            {
+                const uint64 pageSize = uint64( sysconf( _SC_PAGESIZE ) );
+                const uint64 pageMask = pageSize - 1;
+
+                const uint64 regionLength   = ( fileSize + 1 + pageMask ) & ~pageMask;
+                const uint64 fileViewLength = ( fileSize + pageMask ) & ~pageMask;
+
+                if ( regionLength > uint64( size_t( -1 ) ) )
+                {
+                    return Status::KFileTooLarge;
+                }
+
+                void* region = mmap( nullptr, size_t( regionLength ), PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+
+                if ( region == MAP_FAILED )
+                {
+                    return Status::KFileReadError;
+                }
+
+                void* fileView = mmap( region, size_t( fileViewLength ), PROT_READ, MAP_PRIVATE | MAP_FIXED, fileDescriptor, 0 );
+
+                if ( fileView == MAP_FAILED )
+                {
+                    munmap( region, size_t( regionLength ) );
+
+                    return Status::KFileReadError;
+                }
+
+                madvise( fileView, size_t( fileViewLength ), MADV_SEQUENTIAL );
+
+                mappedAddress = region;
+                mappedLength  = size_t( regionLength );
+                text          = static_cast<const char*>( region );
+                textLength    = fileSize;
+
+                return Status::kOk;
+            }
+
+            Status ReadStream( int fileDescriptor, uint64 sizeHint ) noexcept
+            {
+                constexpr uint64 minimumCapacity = 0x10000;
+
+                uint64 capacity = ( sizeHint + 1 > minimumCapacity ) ? sizeHint + 1 : minimumCapacity;
+                uint64 size     = 0;
+
+                for ( ;; )
+                {
+                    if ( size + 1 >= capacity || heapBuffer == nullptr )
+                    {
+                        uint64 newCapacity = ( heapBuffer == nullptr ) ? capacity : capacity * 2;
+
+                        if ( newCapacity > uint64( size_t( -1 ) ) )
+                        {
+                            return Status::KFileTooLarge;
+                        }
+
+                        char* newBuffer = nullptr;
+
+                        Status status = MayThrow(
+                            [ & ]()
+                            {
+                                newBuffer = new char[ size_t( newCapacity ) ];
+                                return Status::kOk;
+                            } );
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+
+                        if ( heapBuffer != nullptr )
+                        {
+                            memcpy( newBuffer, heapBuffer, size_t( size ) );
+                            delete[] heapBuffer;
+                        }
+
+                        heapBuffer = newBuffer;
+                        capacity   = newCapacity;
+                    }
+
+                    ssize_t numberOfBytesRead = read( fileDescriptor, heapBuffer + size, size_t( capacity - size - 1 ) );
+
+                    if ( numberOfBytesRead == -1 )
+                    {
+                        if ( errno == EINTR )
+                        {
+                            continue;
+                        }
+
+                        return Status::KFileReadError;
+                    }
+
+                    if ( numberOfBytesRead == 0 )
+                    {
+                        break;
+                    }
+
+                    size += uint64( numberOfBytesRead );
+                }
+
+                heapBuffer[ size ] = 0;
+
+                text       = heapBuffer;
+                textLength = size;
+
+                return Status::kOk;
+            }
+
+#endif
+
+        public:
+            TextFile() = default;
+
+            TextFile( const TextFile& )         = delete;
+            void operator=( const TextFile& ) = delete;
+
+            ~TextFile()
+            {
+#if defined( JSON4C4_LINUX ) && !defined( C4_ENGINE_MODULE )
+
+                if ( mappedAddress != nullptr )
+                {
+                    munmap( mappedAddress, mappedLength );
+                }
+
+#endif
+
+                if ( heapBuffer != nullptr )
+                {
+                    delete[] heapBuffer;
+                }
+            }
+
+            const char* GetText() const noexcept
+            {
+                return text;
+            }
+
+            uint64 GetTextLength() const noexcept
+            {
+                return textLength;
+            }
+
+            Status LoadFile( const char* fileName ) noexcept
+            {
+#if defined( JSON4C4_LINUX ) && !defined( C4_ENGINE_MODULE )
+
+                int fileDescriptor = open( fileName, O_RDONLY | O_CLOEXEC );
+
+                if ( fileDescriptor == -1 )
+                {
+                    return Status::KFileOpenError;
+                }
+
+                struct stat statBuffer;
+
+                if ( fstat( fileDescriptor, &statBuffer ) != 0 )
+                {
+                    close( fileDescriptor );
+
+                    return Status::KFileReadError;
+                }
+
+                const bool   regularFile = S_ISREG( statBuffer.st_mode );
+                const uint64 fileSize    = regularFile ? uint64( statBuffer.st_size ) : 0;
+
+                if ( fileSize != 0 && MapFile( fileDescriptor, fileSize ) == Status::kOk )
+                {
+                    close( fileDescriptor );
+
+                    return Status::kOk;
+                }
+
+                // procfs and sysfs report a zero size for files that do have contents, so
+                // anything that could not be mapped is read until the end of the stream.
+                Status status = ReadStream( fileDescriptor, fileSize );
+
+                close( fileDescriptor );
+
+                return status;
+
+#else
+
+                File file;
+
+                if ( file.OpenFile( fileName, kFileReadOnly ) != kFileOkay )
+                {
+                    return Status::KFileOpenError;
+                }
+
+                uint64 fileSize = file.GetFileSize();
+
+                if ( fileSize >= uint64( size_t( -1 ) ) )
+                {
+                    return Status::KFileTooLarge;
+                }
+
+                Status status = MayThrow(
+                    [ & ]()
+                    {
+                        heapBuffer = new char[ size_t( fileSize + 1 ) ];
+                        return Status::kOk;
+                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                if ( file.ReadFile( heapBuffer, fileSize ) != kFileOkay )
+                {
+                    return Status::KFileReadError;
+                }
+
+                heapBuffer[ fileSize ] = 0;
+
+                text       = heapBuffer;
+                textLength = fileSize;
+
+                return Status::kOk;
+
+#endif
+            }
+        };
+
+        StructuredData::StructuredData( void* initialBlock, uint64 initialBlockSize ) noexcept : arena( initialBlock, initialBlockSize )
+        {
+        }
+
+        StructuredData::~StructuredData() noexcept
+        {
+            ReleaseRoot();
+        }
+
+        void StructuredData::ReleaseRoot() noexcept
+        {
+            if ( rootJsonValue && ( !rootInArena || arena.IsModified() ) )
+            {
+                delete rootJsonValue;
+            }
+
+            rootJsonValue = nullptr;
+            rootInArena   = false;
+
+            keyTable.Clear();
+            arena.Rewind();
+        }
+
+        void StructuredData::Reset() noexcept
+        {
+            ReleaseRoot();
+        }
+
+        void StructuredData::Purge() noexcept
+        {
+            ReleaseRoot();
+
+            arena.Release();
+            parseStack.PurgeArray();
+            memberStack.PurgeArray();
+            keyTable.Purge();
+            keyBuffer.PurgeArray();
+            numberBuffer.PurgeArray();
+            boolBuffer.PurgeArray();
+            escapedStrings.PurgeArray();
+        }
+
+        Status LoadTextFile( TextFile& textFile, const char* fileName ) noexcept
+        {
+            Status status = textFile.LoadFile( fileName );
+
+            if ( status != Status::kOk )
+            {
+                return status;
+            }
+
+            if ( textFile.GetTextLength() < 2 )
+            {
+                return Status::kTextBufferContentsInvalid;
+            }
+
+            return Status::kOk;
+        }
+
+        namespace Detail
+        {
+            Status CheckTextBuffer( const char* nullTerminatedText, size_t length ) noexcept
+            {
+                if ( length < 3 )
+                {
+                    return Status::kTextBufferContentsInvalid;
+                }
+
+                if ( nullTerminatedText[ length - 1 ] != 0 )
+                {
+                    return Status::kUnterminatedTextBuffer;
+                }
+
+                return Status::kOk;
+            }
+
+            ParseResult ParseTextFile( const char* fileName, ParseResult ( *parseText )( const char*, void* ), void* cookie ) noexcept
+            {
+                TextFile textFile;
+
+                Status status = LoadTextFile( textFile, fileName );
+
+                if ( status != Status::kOk )
+                {
+                    return ParseResult { status, 0, 0 };
+                }
+
+                return parseText( textFile.GetText(), cookie );
+            }
+        } // namespace Detail
+
+        Status CheckTextBuffer( const Array<char>& nullTerminatedTextBuffer ) noexcept
+        {
+            return Detail::CheckTextBuffer( nullTerminatedTextBuffer.begin(), size_t( nullTerminatedTextBuffer.GetArrayElementCount() ) );
+        }
+
+        // The event parser decodes nothing for a handler that handles no events, so it only checks the syntax.
+        ParseResult CheckSyntax( const char* nullTerminatedText, size_t length, Grammar grammar ) noexcept
+        {
+            Status status = Detail::CheckTextBuffer( nullTerminatedText, length );
+
+            if ( status != Status::kOk )
+            {
+                return ParseResult { status, 0, 0 };
+            }
+
+            EventHandler handler;
+
+            if ( grammar == Grammar::kRfc8259 )
+            {
+                return Detail::ParseEventDocument<Grammar::kRfc8259>( nullTerminatedText, handler );
+            }
+
+            return Detail::ParseEventDocument<Grammar::kParse>( nullTerminatedText, handler );
+        }
+
+        Status Reader::Fail( Status failure, const char* position ) noexcept
+        {
+            if ( status == Status::kOk )
+            {
+                status    = failure;
+                errorText = position;
+            }
+
+            return status;
+        }
+
+        Status Reader::Open( const char* nullTerminatedText, size_t length ) noexcept
+        {
+            containerStack.ClearArray();
+
+            key          = StringView();
+            errorText    = nullptr;
+            valuePending = false;
+            status       = Detail::CheckTextBuffer( nullTerminatedText, length );
+
+            if ( status == Status::kOk )
+            {
+                text         = nullTerminatedText + ComputeWhitespaceLength( nullTerminatedText );
+                start        = text;
+                valuePending = true;
+            }
+
+            return status;
+        }
+
+        Status Reader::Open( const Array<char>& nullTerminatedTextBuffer ) noexcept
+        {
+            return Open( nullTerminatedTextBuffer.begin(), size_t( nullTerminatedTextBuffer.GetArrayElementCount() ) );
+        }
+
+        NodeType Reader::PeekType() noexcept
+        {
+            if ( status == Status::kOk && valuePending )
+            {
+                switch ( valueTypeTable.type[ uint8( text[ 0 ] ) ] )
+                {
+                case kValueTypeString:
+                    return NodeType::kString;
+                case kValueTypeNumber:
+                    return NodeType::kNumber;
+                case kValueTypeBool:
+                    return NodeType::kBool;
+                case kValueTypeArray:
+                    return NodeType::kArray;
+                case kValueTypeObject:
+                    return NodeType::kObject;
+                }
+            }
+
+            return NodeType::kNull;
+        }
+
+        // Checks that a value of the given type is next. A character that cannot begin a value is reported as Parse
+        // reports it.
+        Status Reader::BeginValue( NodeType type ) noexcept
+        {
+            if ( status != Status::kOk )
+            {
+                return status;
+            }
+
+            if ( !valuePending )
+            {
+                return Fail( Status::kInvalidStructuredData, text );
+            }
+
+            if ( valueTypeTable.type[ uint8( text[ 0 ] ) ] == kValueTypeInvalid )
+            {
+                return Fail( Status::kExpectedJsonValue, text );
+            }
+
+            if ( PeekType() != type )
+            {
+                return Fail( Status::kInvalidValueType, text );
+            }
+
+            valuePending = false;
+
+            return Status::kOk;
+        }
+
+        Status Reader::EnterContainer( NodeType type, uint8 container ) noexcept
+        {
+            if ( BeginValue( type ) != Status::kOk )
+            {
+                return status;
+            }
+
+            Status pushStatus = MayThrow(
+                [ & ]()
+                {
+                    containerStack.AppendArrayElement( container );
+                    return Status::kOk;
+                } );
+
+            if ( pushStatus != Status::kOk )
+            {
+                return Fail( pushStatus, text );
+            }
+
+            text++;
+
+            return Status::kOk;
+        }
+
+        Status Reader::EnterObject() noexcept
+        {
+            return EnterContainer( NodeType::kObject, kContainerObject );
+        }
+
+        Status Reader::EnterArray() noexcept
+        {
+            return EnterContainer( NodeType::kArray, 0 );
+        }
+
+        // Follows the loops of ArrayValue::Parse and ObjectValue::Parse, one member or element at a time.
+        bool Reader::Next() noexcept
+        {
+            if ( valuePending && SkipValue() != Status::kOk )
+            {
+                return false;
+            }
+
+            if ( status != Status::kOk || containerStack.Empty() )
+            {
+                Fail( Status::kInvalidStructuredData, text );
+                return false;
+            }
+
+            uint8& container = containerStack[ containerStack.GetArrayElementCount() - 1 ];
+            bool   isObject  = ( container & kContainerObject ) != 0;
+
+            text += ComputeWhitespaceLength( text );
+
+            if ( container & kContainerStarted )
+            {
+                if ( text[ 0 ] != ',' )
+                {
+                    if ( text[ 0 ] != ( isObject ? '}' : ']' ) )
+                    {
+                        Fail( isObject ? Status::kExpectedClosingCurlyBracesOrComma : Status::kExpectedClosingSquareBracketsOrComma, text );
+                        return false;
+                    }
+
+                    text++;
+                    containerStack.RemoveArrayElement( containerStack.GetArrayElementCount() - 1 );
+
+                    return false;
+                }
+
+                text++;
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] == ( isObject ? '}' : ']' ) )
+                {
+                    Fail( Status::kExpectedJsonValue, text );
+                    return false;
+                }
+            }
+            else if ( text[ 0 ] == ( isObject ? '}' : ']' ) )
+            {
+                text++;
+                containerStack.RemoveArrayElement( containerStack.GetArrayElementCount() - 1 );
+
+                return false;
+            }
+
+            container |= kContainerStarted;
+
+            if ( isObject )
+            {
+                Status keyStatus = Detail::ReadEventString( text, keyBuffer, &key.text, &key.length );
+                if ( keyStatus != Status::kOk )
+                {
+                    Fail( keyStatus, text );
+                    return false;
+                }
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] != ':' )
+                {
+                    Fail( Status::kExpectedColon, text );
+                    return false;
+                }
+
+                text++;
+                text += ComputeWhitespaceLength( text );
+            }
+
+            valuePending = true;
+
+            return true;
+        }
+
+        Status Reader::ReadString( StringView& string ) noexcept
+        {
+            if ( BeginValue( NodeType::kString ) != Status::kOk )
+            {
+                return status;
+            }
+
+            Status stringStatus = Detail::ReadEventString( text, stringBuffer, &string.text, &string.length );
+            if ( stringStatus != Status::kOk )
+            {
+                return Fail( stringStatus, text );
+            }
+
+            return Status::kOk;
+        }
+
+        Status Reader::ReadNumber( Number& number ) noexcept
+        {
+            if ( BeginValue( NodeType::kNumber ) != Status::kOk )
+            {
+                return status;
+            }
+
+            const char* value = text;
+
+            Status numberStatus = Detail::ReadEventNumber( text, &number );
+            if ( numberStatus == Status::kNumbersCannotHaveLeadingZeros )
+            {
+                return Fail( numberStatus, text );
+            }
+
+            if ( numberStatus != Status::kOk )
+            {
+                return Fail( Status::kExpectedJsonValue, value );
+            }
+
+            return Status::kOk;
+        }
+
+        Status Reader::ReadDouble( double& value ) noexcept
+        {
+            Number number;
+
+            if ( ReadNumber( number ) == Status::kOk )
+            {
+                value = number.data;
+            }
+
+            return status;
+        }
+
+        template <class T>
+        Status Reader::ReadNumberAs( T& value ) noexcept
+        {
+            const char* position = text;
+            Number      number;
+
+            if ( ReadNumber( number ) != Status::kOk )
+            {
+                return status;
+            }
+
+            T      integer;
+            Status conversionStatus = ConvertNumberToInteger( number.type, number.integer, number.data, &integer );
+
+            if ( conversionStatus != Status::kOk )
+            {
+                return Fail( conversionStatus, position );
+            }
+
+            value = integer;
+
+            return Status::kOk;
+        }
+
+        Status Reader::ReadInteger( int32& value ) noexcept
+        {
+            return ReadNumberAs( value );
+        }
+
+        Status Reader::ReadInteger( int64& value ) noexcept
+        {
+            return ReadNumberAs( value );
+        }
+
+        Status Reader::ReadInteger( uint32& value ) noexcept
+        {
+            return ReadNumberAs( value );
+        }
+
+        Status Reader::ReadInteger( uint64& value ) noexcept
+        {
+            return ReadNumberAs( value );
+        }
+
+        Status Reader::ReadBool( bool& value ) noexcept
+        {
+            if ( BeginValue( NodeType::kBool ) != Status::kOk )
+            {
+                return status;
+            }
+
+            if ( MatchLiteral4( text, "true" ) )
+            {
+                value = true;
+                text += 4;
+
+                return Status::kOk;
+            }
+
+            if ( text[ 0 ] == 'f' && MatchLiteral4( text + 1, "alse" ) )
+            {
+                value = false;
+                text += 5;
+
+                return Status::kOk;
+            }
+
+            return Fail( Status::kExpectedJsonValue, text );
+        }
+
+        Status Reader::ReadNull() noexcept
+        {
+            if ( BeginValue( NodeType::kNull ) != Status::kOk )
+            {
+                return status;
+            }
+
+            if ( MatchLiteral4( text, "null" ) )
+            {
+                text += 4;
+
+                return Status::kOk;
+            }
+
+            return Fail( Status::kExpectedJsonValue, text );
+        }
+
+        Status Reader::SkipValue() noexcept
+        {
+            if ( status != Status::kOk )
+            {
+                return status;
+            }
+
+            if ( !valuePending )
+            {
+                return Fail( Status::kInvalidStructuredData, text );
+            }
+
+            valuePending = false;
+
+            Status skipStatus = trustedSkipping ? SkipTrustedValue( text ) : CheckAnyValue( text );
+            if ( skipStatus != Status::kOk )
+            {
+                return Fail( skipStatus, text );
+            }
 
-#else
-            const uint8* byte = reinterpret_cast<const uint8*>( text );
+            return Status::kOk;
+        }
 
-            double v               = 0.0F;
-            bool   digitFlag       = false;
-            bool   wholeFlag       = false;
-            bool   leadingZeroFlag = ( byte[ 0 ] == '0' );
+        Status Reader::Seek( const CompiledPointer& pointer ) noexcept
+        {
+            if ( !pointer.IsCompiled() )
+            {
+                return Fail( Status::kInvalidPointer, text );
+            }
 
-            for ( ;; byte++ )
+            for ( int32 a = 0; a != pointer.GetTokenCount() && status == Status::kOk; a++ )
             {
-                uint32 x = byte[ 0 ] - '0';
-                if ( x < 10U )
+                const CompiledPointer::Token& token    = pointer.GetToken( a );
+                const char*                   position = text;
+                NodeType                      type     = PeekType();
+                bool                          found    = false;
+
+                if ( type == NodeType::kObject )
                 {
-                    if ( digitFlag && leadingZeroFlag )
+                    EnterObject();
+
+                    while ( !found && Next() )
                     {
-                        return ( Status::kNumbersCannotHaveLeadingZeros );
+                        found = ( key.length == token.key.length && memcmp( key.text, token.key.name, size_t( key.length ) ) == 0 );
                     }
-
-                    v         = v * 10.0F + double( x );
-                    digitFlag = true;
-                    wholeFlag = true;
                 }
-                else if ( x == 47 )
+                else if ( type == NodeType::kArray && token.index >= 0 )
                 {
-                    if ( !digitFlag )
+                    EnterArray();
+
+                    for ( int32 index = 0; !found && Next(); index++ )
                     {
-                        return ( Status::kFloatInvalid );
+                        found = ( index == token.index );
                     }
-
-                    digitFlag = false;
                 }
                 else
                 {
-                    break;
+                    // Other values are skipped first, so that a syntax error in them is reported as such.
+                    SkipValue();
                 }
+
+                if ( !found )
+                {
+                    return Fail( Status::kPointerNotFound, position );
+                }
+            }
+
+            return status;
+        }
+
+        Status Reader::Finish() noexcept
+        {
+            if ( status != Status::kOk )
+            {
+                return status;
             }
 
-            if ( wholeFlag && !digitFlag )
+            if ( valuePending || !containerStack.Empty() )
             {
-                return ( Status::kFloatInvalid );
+                return Fail( Status::kInvalidStructuredData, text );
             }
 
-            bool fractionFlag = false;
+            text += ComputeWhitespaceLength( text );
 
-            uint32 c = byte[ 0 ];
-            if ( c == '.' )
+            if ( text[ 0 ] != 0 )
             {
-                digitFlag      = false;
-                double decimal = 10.0F;
-                for ( ++byte;; byte++ )
-                {
-                    uint32 x = byte[ 0 ] - '0';
-                    if ( x < 10U )
-                    {
-                        v += double( x ) / decimal;
-                        digitFlag    = true;
-                        fractionFlag = true;
-                        decimal *= 10.0F;
-                    }
-                    else if ( x == 47 )
-                    {
-                        if ( !digitFlag )
-                        {
-                            return ( Status::kFloatInvalid );
-                        }
+                return Fail( Status::kExpectedEndOfFile, text );
+            }
 
-                        digitFlag = false;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+            return Status::kOk;
+        }
 
-                if ( fractionFlag && !digitFlag )
-                {
-                    return ( Status::kFloatInvalid );
-                }
+        Status Reader::Fail( Status failure ) noexcept
+        {
+            return Fail( failure, text );
+        }
 
-                c = byte[ 0 ];
-            }
+        ParseResult Reader::GetParseResult() const noexcept
+        {
+            ParseResult parseResult;
 
-            if ( !( wholeFlag || fractionFlag ) )
+            parseResult.status = status;
+
+            // The error is located as ParseDocument locates it, after any whitespace at the position where reading stopped.
+            if ( status != Status::kOk && errorText )
             {
-                return ( Status::kFloatInvalid );
+                Detail::LocateParseError( start, errorText + ComputeWhitespaceLength( errorText ), &parseResult.errorLine, &parseResult.errorColumn );
             }
 
-            if ( ( c == 'e' ) || ( c == 'E' ) )
+            return parseResult;
+        }
+
+        Status Deserialize( Reader& reader, String<>& data ) noexcept
+        {
+            StringView string;
+
+            if ( reader.ReadString( string ) != Status::kOk )
             {
-                bool negative = false;
+                return reader.GetStatus();
+            }
 
-                c = ( ++byte )[ 0 ];
-                if ( c == '-' )
-                {
-                    negative = true;
-                    byte++;
-                }
-                else if ( c == '+' )
+            return MayThrow(
+                [ & ]()
                 {
-                    byte++;
-                }
+                    data.Set( string.text, string.length );
 
-                int32 exponent = 0;
-                digitFlag      = false;
-                for ( ;; byte++ )
-                {
-                    uint32 x = byte[ 0 ] - '0';
-                    if ( x < 10U )
-                    {
-                        exponent  = Min( exponent * 10 + x, 65535 );
-                        digitFlag = true;
-                    }
-                    else if ( x == 47 )
-                    {
-                        if ( !digitFlag )
-                        {
-                            return ( Status::kFloatInvalid );
-                        }
+                    return Status::kOk;
+                } );
+        }
 
-                        digitFlag = false;
-                    }
-                    else
-                    {
-                        break;
-                    }
-                }
+        Status Deserialize( Reader& reader, double& data ) noexcept
+        {
+            return reader.ReadDouble( data );
+        }
 
-                if ( !digitFlag )
-                {
-                    return ( Status::kFloatInvalid );
-                }
+        Status Deserialize( Reader& reader, bool& data ) noexcept
+        {
+            return reader.ReadBool( data );
+        }
 
-                if ( negative )
-                {
-                    v *= minusPower10[ MaxZero( 309 - exponent ) ];
-                }
-                else
-                {
-                    v *= plusPower10[ Min( exponent, 309 ) ];
-                }
+        Status Deserialize( Reader& reader, Null& /*data*/ ) noexcept
+        {
+            return reader.ReadNull();
+        }
+
+        Status Deserialize( Reader& reader, int32& data ) noexcept
+        {
+            return reader.ReadInteger( data );
+        }
+
+        Status Deserialize( Reader& reader, int64& data ) noexcept
+        {
+            return reader.ReadInteger( data );
+        }
+
+        Status Deserialize( Reader& reader, uint32& data ) noexcept
+        {
+            return reader.ReadInteger( data );
+        }
+
+        Status Deserialize( Reader& reader, uint64& data ) noexcept
+        {
+            return reader.ReadInteger( data );
+        }
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+        Status Deserialize( Reader& reader, std::string& data ) noexcept
+        {
+            StringView string;
+
+            if ( reader.ReadString( string ) != Status::kOk )
+            {
+                return reader.GetStatus();
             }
 
-            *value      = v;
-            *textLength = int32( reinterpret_cast<const char*>( byte ) - text );
+            return MayThrow(
+                [ & ]()
+                {
+                    data.assign( string.text, std::size_t( string.length ) );
+
+                    return Status::kOk;
+                } );
+        }
 
-            return ( Status::kOk );
 #endif
+
+        ParseResult StructuredData::Parse( const char* fileName ) noexcept
+        {
+            TextFile textFile;
+
+            Status status = LoadTextFile( textFile, fileName );
+
+            if ( status != Status::kOk )
+            {
+                return ParseResult { status, 0, 0 };
+            }
+
+            return ParseNullTerminatedText( textFile.GetText() );
         }
 
-        bool ParseSign( const char*& text ) noexcept
+        ParseResult StructuredData::Parse( const Array<char>& nullTerminatedTextBuffer ) noexcept
         {
-            char c = text[ 0 ];
+            Status status = CheckTextBuffer( nullTerminatedTextBuffer );
 
-            if ( c == '-' )
+            if ( status != Status::kOk )
             {
-                text++;
-                text += ComputeWhitespaceLength( text );
-                return ( true );
+                return ParseResult { status, 0, 0 };
             }
 
-            if ( c == '+' )
+            return ParseNullTerminatedText( nullTerminatedTextBuffer.begin() );
+        }
+
+        ParseResult StructuredData::ParseInSitu( Array<char>& nullTerminatedTextBuffer ) noexcept
+        {
+            Status status = CheckTextBuffer( nullTerminatedTextBuffer );
+
+            if ( status != Status::kOk )
             {
-                text++;
-                text += ComputeWhitespaceLength( text );
+                return ParseResult { status, 0, 0 };
             }
 
-            return ( false );
+            return ParseNullTerminatedText( nullTerminatedTextBuffer.begin(), true );
         }
 
-        template <class T>
-        Status ParseValue( Value*& value, const char*& text ) noexcept
+        // The state of a parse of selected paths. Each path is a bit in the masks. A path is unresolved until its
+        // value has been parsed, or the object or array that would hold its value has been found to lack it. Once no
+        // path is unresolved, the open objects and arrays are closed where they are and the rest of the text is left.
+        struct PathSelection
+        {
+            const CompiledPointer* paths;
+            uint64                 unresolved;
+            bool                   stopped;
+        };
+
+        Status ParseSelectedObject( ObjectValue* jsonObject, const char*& text, ParseContext& context, PathSelection& selection, uint64 live,
+                                    int32 depth ) noexcept;
+        Status ParseSelectedArray( ArrayValue* jsonArray, const char*& text, ParseContext& context, PathSelection& selection, uint64 live,
+                                   int32 depth ) noexcept;
+
+        inline Status SkipUnselectedValue( const char*& text, const ParseContext& context ) noexcept
+        {
+            return context.trustedSkipping ? SkipTrustedValue( text ) : CheckAnyValue( text );
+        }
+
+        template <class T, class ParseSelected>
+        Status ParseSelectedContainer( Value*& value, ParseContext& context, ParseSelected&& parseSelected ) noexcept
         {
             T* jsonValue = nullptr;
 
             Status status = MayThrow(
                 [ & ]()
                 {
-                    jsonValue = new T;
+                    jsonValue = new ( context.arena ) T;
                     return Status::kOk;
                 } );
 
-            if ( status != Status::kOk )
+            if ( status == Status::kOk )
             {
-                return status;
+                status = parseSelected( jsonValue );
             }
 
-            status = MayThrow( [ & ]() { return T::Parse( jsonValue, text ); } );
-
             if ( status == Status::kOk )
             {
                 value = jsonValue;
+            }
 
-                return status;
+            return status;
+        }
+
+        // Parses a value that the live paths pass through, after depth of their tokens. A value at the end of a path
+        // is parsed whole, which also resolves the paths that go on into it. Objects and arrays that the paths go on
+        // into are parsed with only their selected members and elements. Other values cannot hold the rest of the
+        // paths, so they are skipped, and value is left nullptr.
+        Status ParseSelectedValue( Value*& value, const char*& text, ParseContext& context, PathSelection& selection, uint64 live, int32 depth ) noexcept
+        {
+            for ( uint64 rest = live; rest != 0; rest &= rest - 1 )
+            {
+                if ( selection.paths[ CountTrailingZeros( rest ) ].GetTokenCount() == depth )
+                {
+                    selection.unresolved &= ~live;
+                    return ParseAnyValue( value, text, context );
+                }
             }
 
-            delete jsonValue;
+            if ( text[ 0 ] == '{' )
+            {
+                return ParseSelectedContainer<ObjectValue>(
+                    value, context, [ & ]( ObjectValue* jsonObject ) { return ParseSelectedObject( jsonObject, text, context, selection, live, depth ); } );
+            }
 
-            return status;
-        };
+            if ( text[ 0 ] == '[' )
+            {
+                return ParseSelectedContainer<ArrayValue>(
+                    value, context, [ & ]( ArrayValue* jsonArray ) { return ParseSelectedArray( jsonArray, text, context, selection, live, depth ); } );
+            }
+
+            selection.unresolved &= ~live;
+
+            return SkipUnselectedValue( text, context );
+        }
 
-        Status ParseAnyValue( Value*& value, const char*& text ) noexcept
+        // Follows ObjectValue::Parse, and keeps only the members whose key is the next token of an unresolved path.
+        Status ParseSelectedObject( ObjectValue* jsonObject, const char*& text, ParseContext& context, PathSelection& selection, uint64 live,
+                                    int32 depth ) noexcept
         {
-            const char* start = text;
+            int32 stackBase   = context.memberStack.GetArrayElementCount();
+            bool  emptyObject = true;
 
-            Status status = ParseValue<StringValue>( value, text );
-            if ( status == Status::kOk || status != Status::kExpectedBeginingDoubleQuotes )
+            for ( ;; )
             {
-                return status;
+                text++;
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] == '}' )
+                {
+                    if ( !emptyObject )
+                    {
+                        return Status::kExpectedJsonValue;
+                    }
+
+                    break;
+                }
+
+                int32  memberIndex = context.memberStack.GetArrayElementCount();
+                uint64 matched     = 0;
+                Status status      = MayThrow(
+                    [ & ]()
+                    {
+                        context.memberStack.AppendArrayElement();
+                        return Status::kOk;
+                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                status = ReadKeyIf( text, context.memberStack[ memberIndex ].key, context,
+                                    [ & ]( const char* name, int32 length )
+                                    {
+                                        for ( uint64 rest = live & selection.unresolved; rest != 0; rest &= rest - 1 )
+                                        {
+                                            const Key& key = selection.paths[ CountTrailingZeros( rest ) ].GetToken( depth ).key;
+
+                                            if ( key.length == length && memcmp( key.name, name, size_t( length ) ) == 0 )
+                                            {
+                                                matched |= rest & ( ~rest + 1 );
+                                            }
+                                        }
+
+                                        return matched != 0;
+                                    } );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] != ':' )
+                {
+                    return Status::kExpectedColon;
+                }
+
+                text++;
+                text += ComputeWhitespaceLength( text );
+
+                Value* jsonValue = nullptr;
+
+                status = ( matched != 0 ) ? ParseSelectedValue( jsonValue, text, context, selection, matched, depth + 1 )
+                                          : SkipUnselectedValue( text, context );
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                if ( jsonValue )
+                {
+                    context.memberStack[ memberIndex ].value = jsonValue;
+                }
+                else
+                {
+                    context.memberStack.SetArrayElementCount( memberIndex );
+                }
+
+                emptyObject = false;
+
+                if ( selection.unresolved == 0 )
+                {
+                    selection.stopped = true;
+                    break;
+                }
+
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] != ',' )
+                {
+                    break;
+                }
             }
-            text = start;
 
-            status = ParseValue<NumberValue>( value, text );
-            if ( status == Status::kOk || status == Status::kNumbersCannotHaveLeadingZeros )
+            if ( !selection.stopped )
             {
-                return status;
-            }
-            text = start;
+                if ( text[ 0 ] != '}' )
+                {
+                    return Status::kExpectedClosingCurlyBracesOrComma;
+                }
 
-            if ( ParseValue<BoolValue>( value, text ) == Status::kOk )
-            {
-                return Status::kOk;
+                text++;
             }
-            text = start;
 
-            if ( ParseValue<NullValue>( value, text ) == Status::kOk )
-            {
-                return Status::kOk;
-            }
-            text = start;
+            selection.unresolved &= ~live;
+
+            return ObjectValue::FinishParse( jsonObject, stackBase, context );
+        }
 
-            status = ParseValue<ArrayValue>( value, text );
-            if ( status == Status::kOk || status != Status::kExpectedOpeningSquareBrackets )
+        // Follows ArrayValue::Parse, and keeps the elements at the next token of an unresolved path. The elements
+        // before a kept element are kept as nulls, so that the kept elements keep their indices, and the elements
+        // after the last one are left out.
+        Status ParseSelectedArray( ArrayValue* jsonArray, const char*& text, ParseContext& context, PathSelection& selection, uint64 live,
+                                   int32 depth ) noexcept
+        {
+            // Paths whose next token is not an index refer to no element.
+            for ( uint64 rest = live; rest != 0; rest &= rest - 1 )
             {
-                return status;
+                if ( selection.paths[ CountTrailingZeros( rest ) ].GetToken( depth ).index < 0 )
+                {
+                    selection.unresolved &= ~( rest & ( ~rest + 1 ) );
+                }
             }
 
-            status = ParseValue<ObjectValue>( value, text );
-            if ( status == Status::kOk || status != Status::kExpectedOpeningCurlyBraces || status == Status::kNumbersCannotHaveLeadingZeros )
+            int32 stackBase  = context.elementStack.GetArrayElementCount();
+
+            if ( selection.unresolved == 0 )
             {
-                return status;
+                selection.stopped = true;
+                return ArrayValue::FinishParse( jsonArray, stackBase, context );
             }
 
-            return Status::kExpectedJsonValue;
-        }
+            bool  emptyArray = true;
 
-        class StringValue final : public Value
-        {
-        public:
-            static Status Parse( StringValue* jsonStringValue, const char*& text ) noexcept
+            for ( int32 index = 0;; index++ )
             {
-                if ( text[ 0 ] != '"' )
+                text++;
+                text += ComputeWhitespaceLength( text );
+
+                if ( text[ 0 ] == ']' )
                 {
-                    return ( Status::kExpectedBeginingDoubleQuotes );
+                    if ( !emptyArray )
+                    {
+                        return Status::kExpectedJsonValue;
+                    }
+
+                    break;
                 }
 
-                int32 textLength;
-                int32 stringLength;
+                uint64 matched = 0;
 
-                text++;
+                for ( uint64 rest = live & selection.unresolved; rest != 0; rest &= rest - 1 )
+                {
+                    if ( selection.paths[ CountTrailingZeros( rest ) ].GetToken( depth ).index == index )
+                    {
+                        matched |= rest & ( ~rest + 1 );
+                    }
+                }
 
-                Status status = ReadStringLiteral( text, &textLength, &stringLength );
+                Value* jsonValue = nullptr;
+                Status status    = ( matched != 0 ) ? ParseSelectedValue( jsonValue, text, context, selection, matched, depth + 1 )
+                                                    : SkipUnselectedValue( text, context );
                 if ( status != Status::kOk )
                 {
-                    return ( status );
+                    return status;
                 }
 
-                if ( jsonStringValue )
+                if ( jsonValue || ( live & selection.unresolved ) != 0 )
                 {
                     status = MayThrow(
                         [ & ]()
                         {
-                            jsonStringValue->data.SetStringLength( stringLength );
+                            context.elementStack.AppendArrayElement( jsonValue ? jsonValue : new ( context.arena ) NullValue );
                             return Status::kOk;
                         } );
 
@@ -1119,249 +6333,370 @@ namespace C4
                     {
                         return status;
                     }
+                }
+
+                emptyArray = false;
 
-                    ReadStringLiteral( text, &textLength, &stringLength, jsonStringValue->data );
+                if ( selection.unresolved == 0 )
+                {
+                    selection.stopped = true;
+                    break;
                 }
 
-                text += textLength;
+                text += ComputeWhitespaceLength( text );
 
-                if ( text[ 0 ] != '"' )
+                if ( text[ 0 ] != ',' )
                 {
-                    return ( Status::kExpectedEndingDoubleQuotes );
+                    break;
                 }
+            }
 
-                text++;
+            if ( !selection.stopped )
+            {
+                if ( text[ 0 ] != ']' )
+                {
+                    return Status::kExpectedClosingSquareBracketsOrComma;
+                }
 
-                return ( Status::kOk );
+                text++;
             }
 
-        public:
-            using DataType = String<>;
+            selection.unresolved &= ~live;
 
-            DataType data;
-            ~StringValue() noexcept override {};
+            return ArrayValue::FinishParse( jsonArray, stackBase, context );
+        }
 
-            String<>* GetStringData() noexcept override
+        ParseResult StructuredData::ParsePaths( const Array<char>& nullTerminatedTextBuffer, const CompiledPointer* paths, int32 pathCount ) noexcept
+        {
+            Status status = CheckTextBuffer( nullTerminatedTextBuffer );
+
+            if ( status != Status::kOk )
             {
-                return &data;
+                return ParseResult { status, 0, 0 };
             }
 
-            const String<>* GetStringData() const noexcept override
+            if ( pathCount > kMaxParsePathCount )
             {
-                return &data;
+                return ParseResult { Status::kInvalidPointer, 0, 0 };
             }
 
-            Status Write( File& file, uint32 /*indentationLength*/, const char /*indentationChar*/, Array<char>& /*indentationCharArray*/ ) const override
+            for ( int32 a = 0; a != pathCount; a++ )
             {
-                file << '\"' << data << '\"';
-
-                return Status::kOk;
+                if ( !paths[ a ].IsCompiled() )
+                {
+                    return ParseResult { Status::kInvalidPointer, 0, 0 };
+                }
             }
-        };
 
-        class NumberValue final : public Value
+            ReleaseRoot();
+
+            ParseContext  context { arena, parseStack, memberStack, keyTable, keyBuffer, numberBuffer, boolBuffer, escapedStrings, arrayPacking,
+                                    lazyNumbers, false, nullptr, 0, trustedSkipping };
+            uint64        live = ( pathCount == 64 ) ? ~uint64( 0 ) : ( uint64( 1 ) << pathCount ) - 1;
+            PathSelection selection { paths, live, false };
+            ParseResult   parseResult;
+
+            // A document that is stopped early is given the end of the buffer as its end, so the rest is not read.
+            const char* end = nullTerminatedTextBuffer.begin() + nullTerminatedTextBuffer.GetArrayElementCount() - 1;
+
+            parseStack.ClearArray();
+            memberStack.ClearArray();
+            escapedStrings.ClearArray();
+
+            parseResult.status = ParseDocument( nullTerminatedTextBuffer.begin(), &parseResult.errorLine, &parseResult.errorColumn,
+                                                [ & ]( const char*& text )
+                                                {
+                                                    Status valueStatus = ParseSelectedValue( rootJsonValue, text, context, selection, live, 0 );
+
+                                                    if ( valueStatus == Status::kOk && selection.stopped )
+                                                    {
+                                                        text = end;
+                                                    }
+
+                                                    return valueStatus;
+                                                } );
+            rootInArena        = true;
+
+            return parseResult;
+        }
+
+        ParseResult StructuredData::ParsePaths( const Array<char>& nullTerminatedTextBuffer, const char* const* paths, int32 pathCount ) noexcept
         {
-        public:
-            static Status Parse( NumberValue* value, const char*& text ) noexcept
+            if ( pathCount > kMaxParsePathCount )
             {
-                int32  length;
-                double doubleData;
+                return ParseResult { Status::kInvalidPointer, 0, 0 };
+            }
 
-                bool negative = ParseSign( text );
+            CompiledPointer compiledPaths[ kMaxParsePathCount ];
 
-                Status status = MayThrow( [ & ]() { return ReadDoubleLiteral( text, &length, &doubleData ); } );
+            for ( int32 a = 0; a != pathCount; a++ )
+            {
+                Status status = compiledPaths[ a ].Compile( paths[ a ] );
 
                 if ( status != Status::kOk )
                 {
-                    return ( status );
-                }
-
-                if ( negative )
-                {
-                    doubleData = -doubleData;
+                    return ParseResult { status, 0, 0 };
                 }
+            }
 
-                if ( value )
-                {
-                    value->data = doubleData;
-                }
+            return ParsePaths( nullTerminatedTextBuffer, compiledPaths, pathCount );
+        }
 
-                text += length;
-                text += ComputeWhitespaceLength( text );
+        ParseResult StructuredData::ParseNullTerminatedText( const char* text, bool inSitu ) noexcept
+        {
+            ReleaseRoot();
 
-                return ( Status::kOk );
-            }
+            ParseContext context { arena, parseStack, memberStack, keyTable, keyBuffer, numberBuffer, boolBuffer, escapedStrings, arrayPacking,
+                                   lazyNumbers, inSitu, projectionKeys, projectionKeyCount, trustedSkipping };
+            ParseResult  parseResult;
 
-        public:
-            using DataType = double;
-            DataType data  = 0;
+            parseStack.ClearArray();
+            memberStack.ClearArray();
+            escapedStrings.ClearArray();
 
-            ~NumberValue() override {};
+            parseResult.status = ParseJsonRoot( rootJsonValue, text, &parseResult.errorLine, &parseResult.errorColumn, context );
+            rootInArena        = true;
 
-            double* GetDoubleData() noexcept override
+            if ( parseResult.status == Status::kOk )
             {
-                return &data;
+                for ( const EscapedString& escapedString : escapedStrings )
+                {
+                    DecodeStringInPlace( escapedString.literal, escapedString.textLength );
+                }
             }
 
-            const double* GetDoubleData() const noexcept override
+            return parseResult;
+        }
+
+        TERATHON_API Status StructuredData::Write( const char* fileName, const uint32 indentationLength, const char indentationChar ) noexcept
+        {
+            if ( !rootJsonValue )
             {
-                return &data;
+                return Status::kInvalidStructuredData;
             }
 
-            Status Write( File& file, uint32 /*indentationLength*/, const char /*indentationChar*/, Array<char>& /*indentationCharArray*/ ) const override
+            File file;
+            if ( file.OpenFile( fileName, kFileCreate ) != kFileOkay )
             {
+                return Status::KFileOpenError;
+            }
 
-#ifdef JSON4C4_USE_SYSTEM_DOUBLE_STRING_CONVERSIONS
-
-                constexpr int maxDoubleDigits = 32;
-                char          output[ maxDoubleDigits ];
+            FileOutputSink sink( file );
 
-                snprintf( output, maxDoubleDigits, "%.17g", data );
+            Status status = Write( sink, indentationLength, indentationChar );
 
-                file << output;
+            file.CloseFile();
 
-#else
+            return status;
+        }
 
-                file << Text::FloatToString( data );
+        TERATHON_API Status StructuredData::WriteToBuffer( Array<char>& buffer, const uint32 indentationLength, const char indentationChar ) noexcept
+        {
+            buffer.ClearArray();
 
-#endif
+            ArrayOutputSink sink( buffer );
 
-                return Status::kOk;
-            }
-        };
+            return Write( sink, indentationLength, indentationChar );
+        }
 
-        class BoolValue final : public Value
+        TERATHON_API Status StructuredData::Write( OutputSink& sink, const uint32 indentationLength, const char indentationChar ) noexcept
         {
-        public:
-            static Status Parse( BoolValue* value, const char*& text ) noexcept
+            if ( !rootJsonValue )
             {
-                if ( text[ 0 ] == 't' && text[ 1 ] == 'r' && text[ 2 ] == 'u' && text[ 3 ] == 'e' )
+                return Status::kInvalidStructuredData;
+            }
+
+            Status status = MayThrow(
+                [ & ]()
                 {
-                    value->data = true;
-                    text += 4;
+                    Array<char> indentCharArray;
 
-                    return Status::kOk;
-                }
+                    return rootJsonValue->Write( sink, indentationLength, indentationChar, indentCharArray );
+                } );
 
-                if ( text[ 0 ] == 'f' && text[ 1 ] == 'a' && text[ 2 ] == 'l' && text[ 3 ] == 's' && text[ 4 ] == 'e' )
-                {
-                    value->data = false;
-                    text += 5;
+            Status flushStatus = sink.Flush();
 
-                    return Status::kOk;
-                }
+            return ( status != Status::kOk ) ? status : flushStatus;
+        }
 
-                return Status::kExpectedTrueOrFalse;
-            }
+        const Value* StructuredData::GetRootJsonValue() const noexcept
+        {
+            return rootJsonValue;
+        }
 
-        public:
-            using DataType = bool;
-            DataType data  = true;
+        const Key* StructuredData::FindKey( const char* name ) const noexcept
+        {
+            return keyTable.Find( Key( name ) );
+        }
 
-            ~BoolValue() override {};
+        const Key* StructuredData::FindKey( const Key& key ) const noexcept
+        {
+            return keyTable.Find( key );
+        }
 
-            bool* GetBoolData() noexcept override
-            {
-                return &data;
-            }
+        const Value* StructuredData::FindPointer( const char* pointer ) const noexcept
+        {
+            return rootJsonValue ? rootJsonValue->FindPointer( pointer ) : nullptr;
+        }
 
-            const bool* GetBoolData() const noexcept override
+        const Value* StructuredData::FindPointer( const CompiledPointer& pointer ) const noexcept
+        {
+            return rootJsonValue ? rootJsonValue->FindPointer( pointer ) : nullptr;
+        }
+
+        Value* StructuredData::GetRootJsonValue() noexcept
+        {
+            return rootJsonValue;
+        }
+
+        // State shared by the parse of one compact document. The nodes of a container are collected on nodeStack
+        // while the container is open and copied to arena storage of the exact size when it closes.
+        struct NodeParseContext
+        {
+            Arena&       arena;
+            Array<Node>& nodeStack;
+            bool         stringBorrowing;
+        };
+
+        const Node* MoveNodesToArena( NodeParseContext& context, int32 stackBase ) noexcept( false )
+        {
+            int32 count   = context.nodeStack.GetArrayElementCount() - stackBase;
+            Node* storage = static_cast<Node*>( context.arena.Allocate( sizeof( Node ) * uint64( count ), alignof( Node ) ) );
+
+            memcpy( static_cast<void*>( storage ), &context.nodeStack[ stackBase ], sizeof( Node ) * size_t( count ) );
+            context.nodeStack.SetArrayElementCount( stackBase );
+
+            return storage;
+        }
+
+        static_assert( sizeof( Node ) == 16, "Json4C4: A Node must stay 16 bytes." );
+
+        Status Node::Parse( Node* node, const char*& text, NodeParseContext& context ) noexcept
+        {
+            const char* start = text;
+
+            switch ( valueTypeTable.type[ uint8( text[ 0 ] ) ] )
             {
-                return &data;
-            }
+            case kValueTypeString:
+                return ParseString( node, text, context );
 
-            Status Write( File& file, uint32, const char, Array<char>& ) const override
+            case kValueTypeNumber:
             {
+                NumberType type;
+                uint64     integer;
+                double     doubleData;
 
-                if ( data )
+                Status status = ReadNumberLiteral( text, &type, &integer, &doubleData );
+                if ( status == Status::kOk )
                 {
-                    file << "true";
+                    node->type       = NodeType::kNumber;
+                    node->numberType = uint8( type );
+
+                    if ( type == NumberType::kDouble )
+                    {
+                        node->doubleData = doubleData;
+                    }
+                    else
+                    {
+                        node->integer = integer;
+                    }
+
+                    return status;
                 }
-                else
+
+                if ( status == Status::kNumbersCannotHaveLeadingZeros )
                 {
-                    file << "false";
+                    return status;
                 }
-
-                return Status::kOk;
+                break;
             }
-        };
 
-        class NullValue final : public Value
-        {
-        public:
-            static Status Parse( NullValue* /*JsonNullValue*/, const char*& text ) noexcept
-            {
-                if ( text[ 0 ] == 'n' && text[ 1 ] == 'u' && text[ 2 ] == 'l' && text[ 3 ] == 'l' )
+            case kValueTypeBool:
+                if ( MatchLiteral4( text, "true" ) )
                 {
+                    node->type     = NodeType::kBool;
+                    node->boolData = true;
                     text += 4;
 
                     return Status::kOk;
                 }
 
-                return Status::kExpectedNull;
-            }
+                if ( text[ 0 ] == 'f' && MatchLiteral4( text + 1, "alse" ) )
+                {
+                    node->type     = NodeType::kBool;
+                    node->boolData = false;
+                    text += 5;
 
-        public:
-            using DataType = Null;
-            DataType data;
+                    return Status::kOk;
+                }
+                break;
 
-            ~NullValue() override {};
+            case kValueTypeNull:
+                if ( MatchLiteral4( text, "null" ) )
+                {
+                    node->type = NodeType::kNull;
+                    text += 4;
 
-            Null* GetJsonNullData() noexcept override
-            {
-                return &data;
-            }
+                    return Status::kOk;
+                }
+                break;
 
-            const Null* GetJsonNullData() const noexcept override
-            {
-                return &data;
-            }
+            case kValueTypeArray:
+                return ParseElements( node, text, context );
 
-            Status Write( File& file, uint32 /*indentationLength*/, const char /*indentationChar*/, Array<char>& /*indentationCharArray*/ ) const override
-            {
+            case kValueTypeObject:
+                return ParseMembers( node, text, context );
+            }
 
-                file << "null";
+            text = start;
 
-                return Status::kOk;
-            }
-        };
+            return Status::kExpectedJsonValue;
+        }
 
-        namespace Detail
+        // Strings are decoded into the node or the arena. When the document borrows its strings, a string longer than
+        // the inline buffer that has no escape sequences refers to its characters in the text instead.
+        Status Node::ParseString( Node* node, const char*& text, NodeParseContext& context ) noexcept
         {
-            template <>
-            Value* CreateValueFor( const String<>& ) noexcept( false )
-            {
-                return new StringValue;
-            }
+            node->type = NodeType::kString;
 
-            template <>
-            Value* CreateValueFor( const double& ) noexcept( false )
-            {
-                return new NumberValue;
-            }
+            return ReadStringLiteralValue(
+                text,
+                [ & ]( int32 stringLength )
+                {
+                    node->length = stringLength;
 
-            template <>
-            Value* CreateValueFor( const bool& ) noexcept( false )
-            {
-                return new BoolValue;
-            }
+                    if ( stringLength <= kInlineStringLength )
+                    {
+                        return static_cast<char*>( node->inlineString );
+                    }
 
-            template <>
-            Value* CreateValueFor( const Null& ) noexcept( false )
-            {
-                return new NullValue;
-            }
+                    char* storage    = static_cast<char*>( context.arena.Allocate( uint64( stringLength ) + 1, 1 ) );
+                    node->stringData = storage;
 
-        } // namespace Detail
+                    return storage;
+                },
+                [ & ]( const char* string, int32 stringLength )
+                {
+                    if ( !context.stringBorrowing || stringLength <= kInlineStringLength )
+                    {
+                        return false;
+                    }
+
+                    node->length     = stringLength;
+                    node->stringData = string;
+
+                    return true;
+                } );
+        }
 
-        Status ArrayValue::Parse( ArrayValue* jsonArray, const char*& text ) noexcept
+        Status Node::ParseElements( Node* node, const char*& text, NodeParseContext& context ) noexcept
         {
-            if ( text[ 0 ] != '[' )
-            {
-                return Status::kExpectedOpeningSquareBrackets;
-            }
+            int32 stackBase  = context.nodeStack.GetArrayElementCount();
+            bool  emptyArray = true;
 
-            bool emptyArray = true;
+            node->type        = NodeType::kArray;
+            node->length      = 0;
+            node->elementData = nullptr;
 
             for ( ;; )
             {
@@ -1380,8 +6715,8 @@ namespace C4
                     return Status::kOk;
                 }
 
-                Value* jsonValue = nullptr;
-                Status status    = ParseAnyValue( jsonValue, text );
+                Node   element;
+                Status status = Parse( &element, text, context );
                 if ( status != Status::kOk )
                 {
                     return status;
@@ -1390,7 +6725,7 @@ namespace C4
                 status = MayThrow(
                     [ & ]()
                     {
-                        jsonArray->data.AppendArrayElement( jsonValue );
+                        context.nodeStack.AppendArrayElement( element );
                         return Status::kOk;
                     } );
 
@@ -1416,74 +6751,24 @@ namespace C4
 
             text++;
 
-            return Status::kOk;
-        }
-
-        ArrayValue::~ArrayValue()
-        {
-            for ( auto pointer : data )
-            {
-                delete pointer;
-            }
-        };
-
-        Array<Value*>* ArrayValue::GetJsonValueArrayData() noexcept
-        {
-            return &data;
-        }
-
-        const Array<Value*>* ArrayValue::GetJsonValueArrayData() const noexcept
-        {
-            return &data;
-        }
-
-        Status ArrayValue::Write( File& file, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const
-        {
-            file << "[\n";
-
-            ExpandArray( indentationCharArray, indentationChar, indentationLength );
-            for ( int32 a = 0; a != data.GetArrayElementCount(); a++ )
-            {
-                const Value* value = data[ a ];
-
-                file.WriteFile( indentationCharArray.begin(), indentationCharArray.GetArrayElementCount() );
-
-                Status status = value->Write( file, indentationLength, indentationChar, indentationCharArray );
-                if ( status != Status::kOk )
+            return MayThrow(
+                [ & ]()
                 {
-                    return status;
-                }
-
-                file << ( a < data.GetArrayElementCount() - 1 ? "," : "" ) << '\n';
-            }
-
-            indentationCharArray.SetArrayElementCount( indentationCharArray.GetArrayElementCount() - indentationLength );
-
-            file.WriteFile( indentationCharArray.begin(), indentationCharArray.GetArrayElementCount() );
-            file << "]";
-
-            return Status::kOk;
-        }
-
-        Value::~Value() noexcept
-        {
-        }
-
-        bool ObjectValue::InsertAccountedMapElement( Value* element )
-        {
-            insertionOrder.AppendArrayElement( element->name );
+                    node->length      = context.nodeStack.GetArrayElementCount() - stackBase;
+                    node->elementData = MoveNodesToArena( context, stackBase );
 
-            return this->InsertMapElement( element );
+                    return Status::kOk;
+                } );
         }
 
-        Status ObjectValue::Parse( ObjectValue* jsonObject, const char*& text ) noexcept
+        Status Node::ParseMembers( Node* node, const char*& text, NodeParseContext& context ) noexcept
         {
-            if ( text[ 0 ] != '{' )
-            {
-                return Status::kExpectedOpeningCurlyBraces;
-            }
+            int32 stackBase   = context.nodeStack.GetArrayElementCount();
+            bool  emptyObject = true;
 
-            bool emptyObject = true;
+            node->type        = NodeType::kObject;
+            node->length      = 0;
+            node->elementData = nullptr;
 
             for ( ;; )
             {
@@ -1502,8 +6787,8 @@ namespace C4
                     return Status::kOk;
                 }
 
-                StringValue name;
-                Status      status = StringValue::Parse( &name, text );
+                Node   key;
+                Status status = ParseString( &key, text, context );
                 if ( status != Status::kOk )
                 {
                     return status;
@@ -1519,9 +6804,9 @@ namespace C4
                 text++;
                 text += ComputeWhitespaceLength( text );
 
-                Value* jsonValue = nullptr;
+                Node value;
 
-                status = ParseAnyValue( jsonValue, text );
+                status = Parse( &value, text, context );
                 if ( status != Status::kOk )
                 {
                     return status;
@@ -1530,8 +6815,8 @@ namespace C4
                 status = MayThrow(
                     [ & ]()
                     {
-                        jsonValue->name = name.data;
-                        jsonObject->InsertAccountedMapElement( jsonValue );
+                        context.nodeStack.AppendArrayElement( key );
+                        context.nodeStack.AppendArrayElement( value );
 
                         return Status::kOk;
                     } );
@@ -1545,315 +6830,569 @@ namespace C4
 
                 text += ComputeWhitespaceLength( text );
 
-                if ( text[ 0 ] != ',' )
-                {
-                    break;
-                }
-            }
+                if ( text[ 0 ] != ',' )
+                {
+                    break;
+                }
+            }
+
+            if ( text[ 0 ] != '}' )
+            {
+                return Status::kExpectedClosingCurlyBracesOrComma;
+            }
+
+            text++;
+
+            return MayThrow(
+                [ & ]()
+                {
+                    node->length      = ( context.nodeStack.GetArrayElementCount() - stackBase ) / 2;
+                    node->elementData = MoveNodesToArena( context, stackBase );
+
+                    return Status::kOk;
+                } );
+        }
+
+        bool Node::GetNumber( double* value ) const noexcept
+        {
+            if ( type != NodeType::kNumber )
+            {
+                return false;
+            }
+
+            switch ( NumberType( numberType ) )
+            {
+            case NumberType::kInt64:
+                *value = double( int64( integer ) );
+                break;
+
+            case NumberType::kUInt64:
+                *value = double( integer );
+                break;
+
+            default:
+                *value = doubleData;
+                break;
+            }
+
+            return true;
+        }
+
+        template <class T>
+        Status Node::GetInteger( T* result ) const noexcept
+        {
+            if ( type != NodeType::kNumber )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            if ( NumberType( numberType ) == NumberType::kDouble )
+            {
+                return ConvertNumberToInteger( NumberType::kDouble, 0, doubleData, result );
+            }
+
+            return ConvertNumberToInteger( NumberType( numberType ), integer, 0.0, result );
+        }
+
+        template TERATHON_API Status Node::GetInteger( int32* result ) const noexcept;
+        template TERATHON_API Status Node::GetInteger( int64* result ) const noexcept;
+        template TERATHON_API Status Node::GetInteger( uint32* result ) const noexcept;
+        template TERATHON_API Status Node::GetInteger( uint64* result ) const noexcept;
+
+        const Node* Node::FindMember( const char* name, int32 nameLength ) const noexcept
+        {
+            if ( type != NodeType::kObject )
+            {
+                return nullptr;
+            }
+
+            // Keys are compared by length first, so most mismatches cost one compare.
+            const Node* key = elementData;
+            for ( const Node* end = key + length * 2; key != end; key += 2 )
+            {
+                if ( key->length == nameLength && memcmp( key->GetString(), name, size_t( nameLength ) ) == 0 )
+                {
+                    return key + 1;
+                }
+            }
+
+            return nullptr;
+        }
+
+        const Node* Node::FindMember( const char* name ) const noexcept
+        {
+            return FindMember( name, Text::GetTextLength( name ) );
+        }
+
+        const char* Node::FindString( const char* name ) const noexcept
+        {
+            if ( const Node* node = FindMember( name ) )
+            {
+                return node->GetString();
+            }
+
+            return nullptr;
+        }
+
+        bool Node::FindNumber( const char* name, double* value ) const noexcept
+        {
+            if ( const Node* node = FindMember( name ) )
+            {
+                return node->GetNumber( value );
+            }
+
+            return false;
+        }
+
+        const bool* Node::FindBool( const char* name ) const noexcept
+        {
+            if ( const Node* node = FindMember( name ) )
+            {
+                return node->GetBool();
+            }
+
+            return nullptr;
+        }
+
+        bool Node::FindJsonNull( const char* name ) const noexcept
+        {
+            const Node* node = FindMember( name );
+
+            return node && node->IsNull();
+        }
+
+        const Node* Node::FindJsonArray( const char* name ) const noexcept
+        {
+            const Node* node = FindMember( name );
+
+            return ( node && node->type == NodeType::kArray ) ? node : nullptr;
+        }
+
+        const Node* Node::FindJsonObject( const char* name ) const noexcept
+        {
+            const Node* node = FindMember( name );
+
+            return ( node && node->type == NodeType::kObject ) ? node : nullptr;
+        }
+
+        Status Node::Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const
+        {
+            switch ( type )
+            {
+            case NodeType::kNull:
+                sink << "null";
+                break;
+
+            case NodeType::kBool:
+                sink << ( boolData ? "true" : "false" );
+                break;
+
+            case NodeType::kNumber:
+                if ( NumberType( numberType ) == NumberType::kDouble )
+                {
+                    WriteNumber( sink, NumberType::kDouble, 0, doubleData );
+                }
+                else
+                {
+                    WriteNumber( sink, NumberType( numberType ), integer, 0.0 );
+                }
+                break;
+
+            case NodeType::kString:
+                WriteStringLiteral( sink, GetString(), length );
+                break;
+
+            case NodeType::kArray:
+            case NodeType::kObject:
+            {
+                const bool object = ( type == NodeType::kObject );
+
+                sink << ( object ? "{\n" : "[\n" );
+
+                ExpandArray( indentationCharArray, indentationChar, indentationLength );
+
+                const Node* element = elementData;
+                for ( int32 a = 0; a != length; a++ )
+                {
+                    sink.Write( indentationCharArray.begin(), uint64( indentationCharArray.GetArrayElementCount() ) );
+
+                    if ( object )
+                    {
+                        WriteStringLiteral( sink, element->GetString(), element->length );
+                        sink << " : ";
+                        element++;
+                    }
+
+                    Status status = element->Write( sink, indentationLength, indentationChar, indentationCharArray );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+
+                    element++;
+
+                    sink << ( a < length - 1 ? "," : "" ) << '\n';
+                }
+
+                indentationCharArray.SetArrayElementCount( indentationCharArray.GetArrayElementCount() - indentationLength );
+
+                sink.Write( indentationCharArray.begin(), uint64( indentationCharArray.GetArrayElementCount() ) );
+                sink << ( object ? "}" : "]" );
+                break;
+            }
+            }
+
+            return Status::kOk;
+        }
+
+        Status Validate( const Node* node, const String<>& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kString ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Validate( const Node* node, const double& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kNumber ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Validate( const Node* node, const bool& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kBool ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Validate( const Node* node, const Null& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kNull ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Validate( const Node* node, const int32& /*data*/ ) noexcept
+        {
+            int32 temp;
+
+            return node->GetInteger( &temp );
+        }
+
+        Status Validate( const Node* node, const int64& /*data*/ ) noexcept
+        {
+            int64 temp;
+
+            return node->GetInteger( &temp );
+        }
+
+        Status Validate( const Node* node, const uint32& /*data*/ ) noexcept
+        {
+            uint32 temp;
+
+            return node->GetInteger( &temp );
+        }
+
+        Status Validate( const Node* node, const uint64& /*data*/ ) noexcept
+        {
+            uint64 temp;
+
+            return node->GetInteger( &temp );
+        }
+
+        Status Validate( const Node* node, const StringView& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kString ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Deserialize( const Node* node, String<>& data ) noexcept
+        {
+            const char* string = node->GetString();
+
+            if ( !string )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    data.Set( string, node->GetLength() );
+
+                    return Status::kOk;
+                } );
+        }
+
+        Status Deserialize( const Node* node, double& data ) noexcept
+        {
+            return node->GetNumber( &data ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Deserialize( const Node* node, bool& data ) noexcept
+        {
+            const bool* boolData = node->GetBool();
 
-            if ( text[ 0 ] != '}' )
+            if ( !boolData )
             {
-                return Status::kExpectedClosingCurlyBracesOrComma;
+                return Status::kInvalidValueType;
             }
 
-            text++;
+            data = *boolData;
 
             return Status::kOk;
         }
 
-        ObjectValue::~ObjectValue() noexcept
+        Status Deserialize( const Node* node, Null& /*data*/ ) noexcept
         {
+            return node->IsNull() ? Status::kOk : Status::kInvalidValueType;
         }
 
-        ObjectValue* ObjectValue::AsJsonObjectValue() noexcept
+        Status Deserialize( const Node* node, int32& data ) noexcept
         {
-            return this;
+            return node->GetInteger( &data );
         }
 
-        const ObjectValue* ObjectValue::AsJsonObjectValue() const noexcept
+        Status Deserialize( const Node* node, int64& data ) noexcept
         {
-            return this;
+            return node->GetInteger( &data );
         }
 
-        const String<>* ObjectValue::FindString( const char* name ) const noexcept
+        Status Deserialize( const Node* node, uint32& data ) noexcept
         {
-            if ( Value* jsonValue = FindMapElement( name ) )
-            {
-                if ( const String<>* data = jsonValue->GetDataAsPointerTo<String<>>() )
-                {
-                    return data;
-                }
-            }
+            return node->GetInteger( &data );
+        }
 
-            return nullptr;
+        Status Deserialize( const Node* node, uint64& data ) noexcept
+        {
+            return node->GetInteger( &data );
         }
 
-        const double* ObjectValue::FindNumber( const char* name ) const noexcept
+        Status Deserialize( const Node* node, StringView& data ) noexcept
         {
-            if ( Value* jsonValue = FindMapElement( name ) )
+            if ( node->GetNodeType() != NodeType::kString )
             {
-                if ( const double* data = jsonValue->GetDataAsPointerTo<double>() )
-                {
-                    return data;
-                }
+                return Status::kInvalidValueType;
             }
 
-            return nullptr;
+            data = node->GetStringView();
+
+            return Status::kOk;
         }
 
-        const bool* ObjectValue::FindBool( const char* name ) const noexcept
+        CompactStructuredData::CompactStructuredData( void* initialBlock, uint64 initialBlockSize ) noexcept : arena( initialBlock, initialBlockSize )
         {
-            if ( Value* jsonValue = FindMapElement( name ) )
-            {
-                if ( const bool* data = jsonValue->GetDataAsPointerTo<bool>() )
-                {
-                    return data;
-                }
-            }
+        }
 
-            return nullptr;
+        CompactStructuredData::~CompactStructuredData() noexcept
+        {
+            delete sourceFile;
         }
 
-        const Null* ObjectValue::FindJsonNull( const char* name ) const noexcept
+        void CompactStructuredData::Reset() noexcept
         {
-            if ( Value* jsonValue = FindMapElement( name ) )
-            {
-                if ( const Null* data = jsonValue->GetDataAsPointerTo<Null>() )
-                {
-                    return data;
-                }
-            }
+            rootNode = nullptr;
 
-            return nullptr;
+            delete sourceFile;
+            sourceFile = nullptr;
+
+            arena.Rewind();
         }
 
-        const Array<Value*>* ObjectValue::FindJsonValueArray( const char* name ) const noexcept
+        void CompactStructuredData::Purge() noexcept
         {
-            if ( Value* jsonValue = FindMapElement( name ) )
-            {
-                if ( const Array<Value*>* data = jsonValue->GetDataAsPointerTo<Array<Value*>>() )
-                {
-                    return data;
-                }
-            }
+            Reset();
 
-            return nullptr;
+            arena.Release();
+            parseStack.PurgeArray();
         }
 
-        const ObjectValue* ObjectValue::FindJsonObjectValue( const char* name ) const noexcept
+        ParseResult CompactStructuredData::Parse( const char* fileName ) noexcept
         {
-            if ( Value* jsonValue = FindMapElement( name ) )
+            if ( stringBorrowing )
             {
-                if ( const ObjectValue* value = jsonValue->AsJsonObjectValue() )
-                {
-                    return value;
-                }
+                return ParseBorrowedFile( fileName );
             }
 
-            return nullptr;
-        }
-
-        Status ObjectValue::Write( File& file, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const
-        {
-            file << "{\n";
+            TextFile textFile;
 
-            ExpandArray( indentationCharArray, indentationChar, indentationLength );
+            Status status = LoadTextFile( textFile, fileName );
 
-            for ( int32 a = 0; a != insertionOrder.GetArrayElementCount(); a++ )
+            if ( status != Status::kOk )
             {
+                return ParseResult { status, 0, 0 };
+            }
 
-                Value* value = this->FindMapElement( insertionOrder[ a ] );
-
-                if ( !value )
-                {
-                    return Status::kMissingObjectElement;
-                }
+            return ParseNullTerminatedText( textFile.GetText() );
+        }
 
-                file.WriteFile( indentationCharArray.begin(), indentationCharArray.GetArrayElementCount() );
+        // A document that borrows its strings refers to the text of the file, so the file stays loaded until the
+        // document is discarded.
+        ParseResult CompactStructuredData::ParseBorrowedFile( const char* fileName ) noexcept
+        {
+            TextFile* textFile = nullptr;
 
-                file << '"' << value->name << "\" : ";
+            Reset();
 
-                Status status = value->Write( file, indentationLength, indentationChar, indentationCharArray );
-                if ( status != Status::kOk )
+            Status status = MayThrow(
+                [ & ]()
                 {
-                    return status;
-                }
-
-                file << ( a < insertionOrder.GetArrayElementCount() - 1 ? "," : "" ) << '\n';
-            }
+                    textFile = new TextFile;
 
-            indentationCharArray.SetArrayElementCount( indentationCharArray.GetArrayElementCount() - indentationLength );
-
-            file.WriteFile( indentationCharArray.begin(), indentationCharArray.GetArrayElementCount() );
-            file << "}";
-
-            return Status::kOk;
-        }
+                    return Status::kOk;
+                } );
 
-        Status ParseJsonRoot( Value*& jsonRoot, const Array<char>& nullTerminatedCharArray, int32* errorLine, int32* errorColumn ) noexcept
-        {
-            if ( nullTerminatedCharArray.GetArrayElementCount() < 3 )
+            if ( status == Status::kOk )
             {
-                return Status::kTextBufferContentsInvalid;
+                status = LoadTextFile( *textFile, fileName );
             }
 
-            if ( *( nullTerminatedCharArray.end() - 1 ) != 0 )
+            if ( status != Status::kOk )
             {
-                return Status::kUnterminatedTextBuffer;
-            }
+                delete textFile;
 
-            const char* text = &nullTerminatedCharArray[ 0 ];
-            text += ComputeWhitespaceLength( text );
-
-            const char* start = text;
+                return ParseResult { status, 0, 0 };
+            }
 
-            Status status = ParseAnyValue( jsonRoot, text );
+            ParseResult parseResult = ParseNullTerminatedText( textFile->GetText() );
 
-            text += ComputeWhitespaceLength( text );
-            if ( status == Status::kOk && text[ 0 ] != 0 )
+            if ( parseResult.status == Status::kOk )
             {
-                status = Status::kExpectedEndOfFile;
+                sourceFile = textFile;
             }
-
-            if ( status != Status::kOk )
+            else
             {
-                *errorLine   = 1;
-                *errorColumn = 1;
-
-                while ( text != start )
-                {
-                    if ( ( --text )[ 0 ] == '\n' )
-                    {
-                        ( *errorLine )++;
-                    }
-                    *errorColumn += ( ( *errorLine ) == 1 ) ? 1 : 0;
-                }
+                delete textFile;
             }
 
-            return status;
+            return parseResult;
         }
 
-        StructuredData::~StructuredData() noexcept
+        ParseResult CompactStructuredData::Parse( const Array<char>& nullTerminatedTextBuffer ) noexcept
         {
-            if ( rootJsonValue )
+            Status status = CheckTextBuffer( nullTerminatedTextBuffer );
+
+            if ( status != Status::kOk )
             {
-                delete rootJsonValue;
+                return ParseResult { status, 0, 0 };
             }
+
+            return ParseNullTerminatedText( nullTerminatedTextBuffer.begin() );
         }
 
-        ParseResult StructuredData::Parse( const char* fileName ) noexcept
+        ParseResult CompactStructuredData::ParseNullTerminatedText( const char* text ) noexcept
         {
+            Reset();
 
-            File file;
+            NodeParseContext context { arena, parseStack, stringBorrowing };
+            ParseResult      parseResult;
+            Node             root;
 
-            if ( file.OpenFile( fileName, kFileReadOnly ) != kFileOkay )
+            parseStack.ClearArray();
+
+            parseResult.status = ParseDocument( text, &parseResult.errorLine, &parseResult.errorColumn,
+                                                [ & ]( const char*& valueText ) { return Node::Parse( &root, valueText, context ); } );
+
+            if ( parseResult.status == Status::kOk )
             {
-                return ParseResult { Status::KFileOpenError, 0, 0 };
+                parseResult.status = MayThrow(
+                    [ & ]()
+                    {
+                        Node* storage = static_cast<Node*>( arena.Allocate( sizeof( Node ), alignof( Node ) ) );
+
+                        memcpy( static_cast<void*>( storage ), &root, sizeof( Node ) );
+                        rootNode = storage;
+
+                        return Status::kOk;
+                    } );
             }
 
-            Terathon::uint64 fileSize = file.GetFileSize();
+            return parseResult;
+        }
 
-            if ( fileSize > MAX_FILE_SIZE )
+        Status CompactStructuredData::Write( OutputSink& sink, const uint32 indentationLength, const char indentationChar ) const noexcept
+        {
+            if ( !rootNode )
             {
-                return ParseResult { Status::KFileTooLarge, 0, 0 };
+                return Status::kInvalidStructuredData;
             }
 
-            Array<char> nullTerminatedText;
-
             Status status = MayThrow(
                 [ & ]()
                 {
-                    nullTerminatedText.SetArrayElementCount( fileSize + 1, 0 );
+                    Array<char> indentCharArray;
 
-                    return Status::kOk;
+                    return rootNode->Write( sink, indentationLength, indentationChar, indentCharArray );
                 } );
 
-            if ( status != Status::kOk )
-            {
-                return ParseResult { status, 0, 0 };
-            }
+            Status flushStatus = sink.Flush();
 
-            if ( file.ReadFile( nullTerminatedText.begin(), fileSize ) != kFileOkay )
-            {
-                return ParseResult { Status::KFileReadError, 0, 0 };
-            }
+            return ( status != Status::kOk ) ? status : flushStatus;
+        }
 
-            file.CloseFile();
+        Status CompactStructuredData::WriteToBuffer( Array<char>& buffer, const uint32 indentationLength, const char indentationChar ) const noexcept
+        {
+            buffer.ClearArray();
 
-            return Parse( nullTerminatedText );
+            ArrayOutputSink sink( buffer );
+
+            return Write( sink, indentationLength, indentationChar );
         }
 
-        ParseResult StructuredData::Parse( const Array<char>& nullTerminatedTextBuffer ) noexcept
+        String<256> ParseResultToString( const ParseResult& parseResult ) noexcept
         {
-            if ( nullTerminatedTextBuffer.GetArrayElementCount() < 3 )
-            {
-                return ParseResult { Status::kTextBufferContentsInvalid, 0, 0 };
-            }
+            String<256> string = StatusToString( parseResult.status );
 
-            if ( *( nullTerminatedTextBuffer.end() - 1 ) != 0 )
+            if ( parseResult.errorLine != 0 && parseResult.status != Status::kException )
             {
-                return ParseResult { Status::kUnterminatedTextBuffer, 0, 0 };
+                string += String<24>( ". Line: " ) + String<24>( parseResult.errorLine ) + String<24>( ", column: " ) + String<24>( parseResult.errorColumn );
             }
 
-            if ( rootJsonValue )
-            {
-                delete rootJsonValue;
-                rootJsonValue = nullptr;
-            }
+            return string;
+        }
 
-            ParseResult parseResult;
-            parseResult.status = ParseJsonRoot( rootJsonValue, nullTerminatedTextBuffer, &parseResult.errorLine, &parseResult.errorColumn );
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
 
-            return parseResult;
+        StringOutputSink::StringOutputSink( std::string& string ) noexcept : string( string )
+        {
         }
 
-        TERATHON_API Status StructuredData::Write( const char* fileName, const uint32 indentationLength, const char indentationChar ) noexcept
+        Status StringOutputSink::WriteOverflow( const char* data, uint64 size )
         {
+            // The window is the string's full capacity, as with ArrayOutputSink.
+            size_t writtenLength  = ( cursor != nullptr ) ? size_t( cursor - &string[ 0 ] ) : string.size();
+            size_t requiredLength = writtenLength + size_t( size );
 
-            File file;
-            if ( file.OpenFile( fileName, kFileCreate ) != kFileOkay )
+            if ( string.capacity() < requiredLength )
             {
-                return Status::KFileOpenError;
+                string.reserve( ( requiredLength < string.capacity() * 2 ) ? string.capacity() * 2 : requiredLength );
             }
 
-            Array<char> indentCharArray;
-
-            if ( rootJsonValue )
-            {
-                Status status = rootJsonValue->Write( file, indentationLength, indentationChar, indentCharArray );
+            string.resize( string.capacity() );
 
-                file.CloseFile();
+            cursor = &string[ 0 ] + writtenLength;
+            limit  = &string[ 0 ] + string.size();
 
-                return status;
-            }
+            memcpy( cursor, data, size_t( size ) );
+            cursor += size;
 
-            return Status::kInvalidStructuredData;
+            return Status::kOk;
         }
 
-        const Value* StructuredData::GetRootJsonValue() const noexcept
+        Status StringOutputSink::Flush()
         {
-            return rootJsonValue;
-        }
+            if ( cursor != nullptr )
+            {
+                string.resize( size_t( cursor - &string[ 0 ] ) );
+            }
 
-        Value* StructuredData::GetRootJsonValue() noexcept
-        {
-            return rootJsonValue;
+            cursor = nullptr;
+            limit  = nullptr;
+
+            return status;
         }
 
-        String<256> ParseResultToString( const ParseResult& parseResult ) noexcept
+        TERATHON_API Status StructuredData::WriteToBuffer( std::string& buffer, const uint32 indentationLength, const char indentationChar ) noexcept
         {
-            String<256> string = StatusToString( parseResult.status );
+            buffer.clear();
 
-            if ( parseResult.errorLine != 0 && parseResult.status != Status::kException )
-            {
-                string += String<24>( ". Line: " ) + String<24>( parseResult.errorLine ) + String<24>( ", column: " ) + String<24>( parseResult.errorColumn );
-            }
+            StringOutputSink sink( buffer );
 
-            return string;
+            return Write( sink, indentationLength, indentationChar );
         }
 
-#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
-
         namespace Detail
         {
             template <>
@@ -1861,6 +7400,12 @@ namespace C4
             {
                 return new StringValue;
             }
+
+            template <>
+            Value* CreateValueFor( const std::string_view& )
+            {
+                return new StringValue;
+            }
         } // namespace Detail
 
         template <>
@@ -1895,6 +7440,29 @@ namespace C4
                 } );
         }
 
+        Status Validate( const Node* node, const std::string& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kString ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Deserialize( const Node* node, std::string& data ) noexcept
+        {
+            const char* string = node->GetString();
+
+            if ( !string )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    data.assign( string, std::size_t( node->GetLength() ) );
+
+                    return Status::kOk;
+                } );
+        }
+
         template <>
         TERATHON_API Status Serialize( Value* value, const std::string& data ) noexcept
         {
@@ -1914,6 +7482,65 @@ namespace C4
                 } );
         }
 
+        template <>
+        TERATHON_API Status Validate( const Value* value, const std::string_view& /*data*/ ) noexcept
+        {
+            return value->GetDataAsPointerTo<String<>>() ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, std::string_view& data ) noexcept
+        {
+            const String<>* valueData = value->GetDataAsPointerTo<String<>>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            data = std::string_view( *valueData, std::size_t( valueData->GetStringLength() ) );
+
+            return Status::kOk;
+        }
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const std::string_view& data ) noexcept
+        {
+            String<>* valueData = value->GetDataAsPointerTo<String<>>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    valueData->Set( data.data(), int32( data.size() ) );
+
+                    return Status::kOk;
+                } );
+        }
+
+        Status Validate( const Node* node, const std::string_view& /*data*/ ) noexcept
+        {
+            return ( node->GetNodeType() == NodeType::kString ) ? Status::kOk : Status::kInvalidValueType;
+        }
+
+        Status Deserialize( const Node* node, std::string_view& data ) noexcept
+        {
+            const char* string = node->GetString();
+
+            if ( !string )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            data = std::string_view( string, std::size_t( node->GetLength() ) );
+
+            return Status::kOk;
+        }
+
 #endif
 
     } // namespace Json
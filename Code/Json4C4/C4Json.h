@@ -62,10 +62,27 @@
 
 #    include <map>
 #    include <string>
+#    include <string_view>
 #    include <vector>
 
 #endif
 
+// The block loads of the scanner may read past the terminating null character, up to the end of the page that holds
+// it. Such a read cannot fault, but AddressSanitizer reports it, so the functions that make one are not instrumented.
+#if defined( _MSC_VER )
+
+#    define JSON4C4_NO_SANITIZE_ADDRESS __declspec( no_sanitize_address )
+
+#elif defined( __GNUC__ ) || defined( __clang__ )
+
+#    define JSON4C4_NO_SANITIZE_ADDRESS __attribute__( ( no_sanitize_address ) )
+
+#else
+
+#    define JSON4C4_NO_SANITIZE_ADDRESS
+
+#endif
+
 namespace C4
 {
     class File;
@@ -156,7 +173,12 @@ namespace C4
             kMissingObjectElement,
             kException,
             kInvalidValueType,
-            kNameNotPresent
+            kNameNotPresent,
+            kFileWriteError,
+            kNumberOutOfRange,
+            kStoppedByHandler,
+            kInvalidPointer,
+            kPointerNotFound
         };
 
         TERATHON_API String<256> StatusToString( const Status& parseResult ) noexcept;
@@ -170,6 +192,71 @@ namespace C4
 
         inline const Detail::Optional optional;
 
+        // Hashes a key the way Text::Hash does, over an explicit length so that keys may contain null characters.
+        constexpr uint32 HashKey( const char* key, int32 length ) noexcept
+        {
+            uint32 hash = 0;
+
+            for ( int32 a = 0; a != length; a++ )
+            {
+                hash = ( hash ^ uint8( key[ a ] ) ) * 0x6B84DF47U + 1;
+            }
+
+            return hash;
+        }
+
+        constexpr int32 GetKeyLength( const char* key ) noexcept
+        {
+            int32 length = 0;
+
+            while ( key[ length ] != 0 )
+            {
+                length++;
+            }
+
+            return length;
+        }
+
+        // An object key with its length and hash computed once, for looking it up in many objects. A Key declared
+        // constexpr is computed at compile time. The name must outlive the Key.
+        struct Key
+        {
+            const char* name   = "";
+            int32       length = 0;
+            uint32      hash   = 0;
+
+            constexpr Key() noexcept = default;
+
+            constexpr explicit Key( const char* keyName ) noexcept
+                : Key( keyName, GetKeyLength( keyName ) )
+            {
+            }
+
+            constexpr Key( const char* keyName, int32 keyLength ) noexcept
+                : name( keyName )
+                , length( keyLength )
+                , hash( HashKey( keyName, keyLength ) )
+            {
+            }
+        };
+
+        // A string that is referenced rather than owned. The characters are not necessarily followed by a null
+        // character. Deserializing into a StringView borrows the string from the document instead of copying it, so
+        // the view is only valid while the document holds it.
+        struct StringView
+        {
+            const char* text   = nullptr;
+            int32       length = 0;
+
+            constexpr StringView() noexcept = default;
+
+            constexpr StringView( const char* viewText, int32 viewLength ) noexcept
+                : text( viewText )
+                , length( viewLength )
+            {
+            }
+        };
+
         template <class Func>
         Status MayThrow( Func&& func ) noexcept
         {
@@ -195,18 +282,303 @@ namespace C4
         // Basic Types :
         // String<>
         // double
+        // int32, int64, uint32, uint64
         // bool
         // and:
         struct Null
         {
         };
 
+        // The kind of literal a number was parsed from or serialized with. Integer literals that fit in 64 bits are
+        // stored exactly, as int64 when they fit and as uint64 above that, and are written back without conversion.
+        enum class NumberType : unsigned int
+        {
+            kDouble = 0,
+            kInt64,
+            kUInt64
+        };
+
+        // Destination of StructuredData::Write. Characters are stored in the window between cursor and limit, and the
+        // derived class is only called once the window is exhausted, so most writes cost a compare and a copy. The
+        // first error is latched and returned by Flush.
+        class OutputSink
+        {
+        protected:
+            char*  cursor = nullptr;
+            char*  limit  = nullptr;
+            Status status = Status::kOk;
+
+            virtual Status WriteOverflow( const char* data, uint64 size ) = 0;
+
+        public:
+            OutputSink() = default;
+
+            OutputSink( const OutputSink& )     = delete;
+            void operator=( const OutputSink& ) = delete;
+
+            TERATHON_API virtual ~OutputSink();
+
+            TERATHON_API virtual Status Flush();
+
+            Status GetStatus() const noexcept
+            {
+                return status;
+            }
+
+            void Write( const char* data, uint64 size ) noexcept
+            {
+                if ( size <= uint64( limit - cursor ) )
+                {
+                    if ( size != 0 )
+                    {
+                        memcpy( cursor, data, size_t( size ) );
+                        cursor += size;
+                    }
+                }
+                else if ( status == Status::kOk )
+                {
+                    status = MayThrow( [ & ]() { return WriteOverflow( data, size ); } );
+                }
+            }
+
+            OutputSink& operator<<( char c ) noexcept
+            {
+                if ( cursor != limit )
+                {
+                    *cursor++ = c;
+                }
+                else
+                {
+                    Write( &c, 1 );
+                }
+
+                return *this;
+            }
+
+            OutputSink& operator<<( const char* text ) noexcept
+            {
+                Write( text, uint64( Text::GetTextLength( text ) ) );
+
+                return *this;
+            }
+        };
+
+        // An output sink that collects characters in a buffer of a fixed, user-selected size and hands them to
+        // Consume in large blocks. The buffer is allocated on first use and kept for the lifetime of the sink, so
+        // a sink can be reused for any number of writes.
+        class BufferedOutputSink : public OutputSink
+        {
+        private:
+            Array<char> buffer;
+            uint32      bufferSize;
+
+        protected:
+            virtual Status Consume( const char* data, uint64 size ) = 0;
+
+            TERATHON_API Status WriteOverflow( const char* data, uint64 size ) override;
+
+        public:
+            static constexpr uint32 kDefaultBufferSize = 0x10000;
+
+            TERATHON_API explicit BufferedOutputSink( uint32 bufferSize = kDefaultBufferSize ) noexcept;
+
+            TERATHON_API Status Flush() override;
+        };
+
+        class FileOutputSink final : public BufferedOutputSink
+        {
+        private:
+            File& file;
+
+        protected:
+            TERATHON_API Status Consume( const char* data, uint64 size ) override;
+
+        public:
+            TERATHON_API explicit FileOutputSink( File& file, uint32 bufferSize = kDefaultBufferSize ) noexcept;
+        };
+
+        using OutputCallback = Status( const char* data, uint64 size, void* cookie );
+
+        class CallbackOutputSink final : public BufferedOutputSink
+        {
+        private:
+            OutputCallback* callback;
+            void*           cookie;
+
+        protected:
+            TERATHON_API Status Consume( const char* data, uint64 size ) override;
+
+        public:
+            TERATHON_API CallbackOutputSink( OutputCallback* callback, void* cookie, uint32 bufferSize = kDefaultBufferSize ) noexcept;
+        };
+
+        // Appends to an Array<char>. The window is the unused tail of the array itself, so no intermediate copy
+        // is made. Flush trims the array to the characters actually written.
+        class ArrayOutputSink final : public OutputSink
+        {
+        private:
+            Array<char>& array;
+
+        protected:
+            TERATHON_API Status WriteOverflow( const char* data, uint64 size ) override;
+
+        public:
+            TERATHON_API explicit ArrayOutputSink( Array<char>& array ) noexcept;
+
+            TERATHON_API Status Flush() override;
+        };
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+        // Appends to a std::string, using its capacity as the window in the same way as ArrayOutputSink.
+        class StringOutputSink final : public OutputSink
+        {
+        private:
+            std::string& string;
+
+        protected:
+            TERATHON_API Status WriteOverflow( const char* data, uint64 size ) override;
+
+        public:
+            TERATHON_API explicit StringOutputSink( std::string& string ) noexcept;
+
+            TERATHON_API Status Flush() override;
+        };
+
+#endif
+
+        // A monotonic allocator that the nodes, keys, and string bytes of a parsed document are carved from. Memory
+        // is handed out from chunks that grow geometrically and is only returned when the whole arena is released,
+        // so freeing a document costs one free per chunk. An optional initial block supplied by the user is used
+        // before any chunk is allocated, which lets small documents be parsed without touching the heap. Rewinding
+        // keeps the chunks, so the next document of a similar size is parsed without allocating.
+        class Arena
+        {
+        private:
+            struct Chunk
+            {
+                Chunk* next;
+                uint64 size;
+            };
+
+            // Chunks stay in the order they were first used, and current is the last one used since the arena was
+            // rewound, so a repeated sequence of requests is served by the same chunks.
+            struct ChunkList
+            {
+                Chunk* first   = nullptr;
+                Chunk* current = nullptr;
+            };
+
+            char*     cursor           = nullptr;
+            char*     limit            = nullptr;
+            ChunkList chunkList;
+            ChunkList largeChunkList;
+            char*     initialBlock     = nullptr;
+            uint64    initialBlockSize = 0;
+            uint64    nextChunkSize    = kMinChunkSize;
+            bool      modified         = false;
+
+            static void FreeChunks( ChunkList& list ) noexcept;
+
+            TERATHON_API void* AllocateChunk( uint64 size, uint64 alignment ) noexcept( false );
+
+        public:
+            static constexpr uint64 kMinChunkSize = 0x4000;
+            static constexpr uint64 kMaxChunkSize = 0x100000;
+
+            Arena() = default;
+            TERATHON_API Arena( void* initialBlock, uint64 initialBlockSize ) noexcept;
+            TERATHON_API ~Arena() noexcept;
+
+            Arena( const Arena& )          = delete;
+            void operator=( const Arena& ) = delete;
+
+            // Returns size bytes aligned to alignment, which must be a power of two. Allocation only fails if a
+            // new chunk cannot be allocated, in which case the global operator new reports the failure.
+            void* Allocate( uint64 size, uint64 alignment ) noexcept( false )
+            {
+                machine_address address      = ( machine_address( cursor ) + machine_address( alignment - 1 ) ) & ~machine_address( alignment - 1 );
+                machine_address limitAddress = machine_address( limit );
+
+                if ( address <= limitAddress && size <= limitAddress - address )
+                {
+                    cursor = reinterpret_cast<char*>( address + size );
+                    return reinterpret_cast<void*>( address );
+                }
+
+                return AllocateChunk( size, alignment );
+            }
+
+            // Records that something allocated from the arena may have been given memory outside it, so that it has
+            // to be destroyed before the arena is rewound. Rewinding clears the record.
+            void MarkModified() noexcept
+            {
+                modified = true;
+            }
+
+            bool IsModified() const noexcept
+            {
+                return modified;
+            }
+
+            // Makes all memory available again without freeing any chunk. Memory previously returned by Allocate
+            // must no longer be used.
+            TERATHON_API void Rewind() noexcept;
+
+            // Frees every chunk and makes the initial block available again. Memory previously returned by
+            // Allocate must no longer be used.
+            TERATHON_API void Release() noexcept;
+        };
+
+        // The distinct keys of a parsed document. Each key is copied into the arena of the document once, and every
+        // member with that key refers to the copy, so a document made of many objects of the same shape holds one
+        // copy of each of their keys. Keys are kept in an open-addressing table whose capacity is a power of two, and
+        // an empty slot has a null name.
+        class KeyTable
+        {
+        private:
+            Array<Key> slots;
+            int32      keyCount = 0;
+
+            void Grow() noexcept( false );
+
+        public:
+            // Returns the stored copy of the key, copying it into the arena the first time it is seen. The copy is
+            // null-terminated.
+            TERATHON_API Key Intern( const char* name, int32 length, Arena& arena ) noexcept( false );
+
+            // Returns the stored copy of the key, or nullptr if the table does not hold it.
+            TERATHON_API const Key* Find( const Key& key ) const noexcept;
+
+            int32 GetKeyCount() const noexcept
+            {
+                return keyCount;
+            }
+
+            // Empties the table and keeps its memory, for when the arena holding the keys is rewound.
+            TERATHON_API void Clear() noexcept;
+
+            // Empties the table and frees its memory.
+            TERATHON_API void Purge() noexcept;
+        };
+
+        // A string literal with escape sequences in a buffer parsed in situ. Its decoded string is written over it
+        // once the whole buffer has parsed, so that a syntax error is reported at its position in the original text.
+        struct EscapedString
+        {
+            char* literal;
+            int32 textLength;
+        };
+
+        struct ParseContext;
+
         class StringValue;
         class NumberValue;
         class NullValue;
         class BoolValue;
         class ArrayValue;
         class ObjectValue;
+        class Node;
 
         template <class ValueType>
         class ObjectMapElement : public Terathon::MapElement<ObjectMapElement<ValueType>>
@@ -230,7 +602,56 @@ namespace C4
             using ElementType = ObjectMapElement<ValueType>;
         };
 
-        class Value : public Terathon::MapElement<Value>
+        // A JSON Pointer, as defined by RFC 6901, split into its reference tokens once so that it can be looked up in
+        // many documents without being parsed again. Each token is unescaped and kept as a Key with its hash, and a
+        // token that is an array index, a run of digits without a leading zero, also keeps its value. The empty
+        // pointer refers to the whole document. A pointer that has not been compiled refers to no value.
+        class CompiledPointer
+        {
+        public:
+            struct Token
+            {
+                Key   key;
+                int32 index = -1;
+            };
+
+        private:
+            Array<Token> tokens;
+            Array<char>  names;
+            bool         compiled = false;
+
+        public:
+            TERATHON_API CompiledPointer() noexcept = default;
+
+            CompiledPointer( const CompiledPointer& ) = delete;
+            void operator=( const CompiledPointer& )  = delete;
+
+            // Returns kInvalidPointer if the pointer does not begin with a slash or holds a tilde that is not
+            // followed by 0 or 1.
+            TERATHON_API Status Compile( const char* pointer, int32 length ) noexcept;
+
+            Status Compile( const char* pointer ) noexcept
+            {
+                return Compile( pointer, GetKeyLength( pointer ) );
+            }
+
+            bool IsCompiled() const noexcept
+            {
+                return compiled;
+            }
+
+            int32 GetTokenCount() const noexcept
+            {
+                return tokens.GetArrayElementCount();
+            }
+
+            const Token& GetToken( int32 index ) const noexcept
+            {
+                return tokens[ index ];
+            }
+        };
+
+        class Value
         {
         private:
             inline virtual String<>* GetStringData() noexcept
@@ -283,18 +704,37 @@ namespace C4
                 return nullptr;
             };
 
-        public:
-            using KeyType = String<>;
+            inline virtual Array<double>* GetNumberArrayData() noexcept
+            {
+                return nullptr;
+            };
+
+            inline virtual const Array<double>* GetNumberArrayData() const noexcept
+            {
+                return nullptr;
+            };
 
-            String<> name;
+            inline virtual Array<bool>* GetBoolArrayData() noexcept
+            {
+                return nullptr;
+            };
 
-            TERATHON_API inline const KeyType& GetKey() const noexcept
+            inline virtual const Array<bool>* GetBoolArrayData() const noexcept
             {
-                return name;
+                return nullptr;
             };
 
+        public:
             TERATHON_API virtual ~Value() noexcept;
 
+            // Values created with a plain new expression live on the heap, and values created by the parser live
+            // in the arena of their StructuredData. A word in front of each value points to its arena, or is null
+            // for a heap value, so deleting an arena value only runs its destructor.
+            TERATHON_API static void* operator new( size_t size ) noexcept( false );
+            TERATHON_API static void* operator new( size_t size, Arena& arena ) noexcept( false );
+            TERATHON_API static void  operator delete( void* pointer ) noexcept;
+            TERATHON_API static void  operator delete( void* pointer, Arena& arena ) noexcept;
+
             inline virtual ObjectValue* AsJsonObjectValue() noexcept
             {
                 return nullptr;
@@ -305,7 +745,28 @@ namespace C4
                 return nullptr;
             }
 
-            virtual Status Write( File& file, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const = 0;
+            inline virtual NumberValue* AsJsonNumberValue() noexcept
+            {
+                return nullptr;
+            }
+
+            inline virtual const NumberValue* AsJsonNumberValue() const noexcept
+            {
+                return nullptr;
+            }
+
+            inline virtual NumberType GetNumberType() const noexcept
+            {
+                return NumberType::kDouble;
+            }
+
+            virtual Status Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const = 0;
+
+            // Returns the value that a JSON Pointer refers to within this value, or nullptr if the pointer is
+            // malformed or refers to no value. Tokens are looked up as keys in objects and as indices in arrays, so
+            // the elements of packed arrays are not reached. Looking up a pointer given as text allocates nothing.
+            TERATHON_API const Value* FindPointer( const char* pointer ) const noexcept;
+            TERATHON_API const Value* FindPointer( const CompiledPointer& pointer ) const noexcept;
 
             template <class T>
             T* GetDataAsPointerTo() noexcept
@@ -384,6 +845,31 @@ namespace C4
             return this->GetJsonValueArrayData();
         }
 
+        // Arrays packed by a StructuredData with array packing enabled.
+        template <>
+        inline Array<double>* Value::GetDataAsPointerTo<Array<double>>() noexcept
+        {
+            return this->GetNumberArrayData();
+        }
+
+        template <>
+        inline const Array<double>* Value::GetDataAsPointerTo<Array<double>>() const noexcept
+        {
+            return this->GetNumberArrayData();
+        }
+
+        template <>
+        inline Array<bool>* Value::GetDataAsPointerTo<Array<bool>>() noexcept
+        {
+            return this->GetBoolArrayData();
+        }
+
+        template <>
+        inline const Array<bool>* Value::GetDataAsPointerTo<Array<bool>>() const noexcept
+        {
+            return this->GetBoolArrayData();
+        }
+
         namespace Detail
         {
             template <class T>
@@ -456,25 +942,179 @@ namespace C4
             template <class T>
             using HasSerializeMember = IsDetectedExact<Status, SerializeMemberOperator, T>;
 
-            template <class T, int32 baseCount>
-            void PurgePointerArray( Array<T*, baseCount>& array )
-            {
-                for ( T* elem : array )
-                {
-                    delete elem;
-                }
+            template <class T>
+            using NodeValidateMemberOperator = decltype( DeclVal<T&>().Validate( DeclVal<const Node*>() ) );
 
-                array.PurgeArray();
-            }
-        } // namespace Detail
+            template <class T>
+            using NodeDeserializeMemberOperator = decltype( DeclVal<T&>().Deserialize( DeclVal<const Node*>() ) );
 
-        class ArrayValue final : public Value
-        {
-        public:
-            static Status Parse( ArrayValue* jsonArray, const char*& text ) noexcept;
+            template <class T>
+            using HasNodeDeserializeMember = IsDetectedExact<Status, NodeDeserializeMemberOperator, T>;
 
-        public:
-            using DataType = Array<Value*>;
+            template <class T>
+            using HasNodeValidateMember = IsDetectedExact<Status, NodeValidateMemberOperator, T>;
+
+            // Tells whether deserializing into an object that already holds a value can leave part of the old value in
+            // place. Numbers, strings, and arrays are overwritten entirely. A type with a prototype keeps old values only
+            // in optional fields, in maps, and in fields of types that keep them, and the functions that
+            // DEFINE_JSON4C4_FUNCTIONS and DEFINE_JSON4C4_MEMBER_FUNCTIONS declare for it tell which. Any other type is
+            // assumed to keep them.
+            template <class T>
+            using StaleValueOperator = decltype( KeepsStaleJsonValue( DeclVal<const T&>() ) );
+
+            template <class T>
+            using StaleValueMemberOperator = decltype( DeclVal<const T&>().KeepsStaleJsonValue() );
+
+            template <class T, class = void>
+            struct KeepsStaleValue : TrueType
+            {
+            };
+
+            template <class T>
+            struct KeepsStaleValue<T, VoidType<StaleValueOperator<T>>> : StaleValueOperator<T>
+            {
+            };
+
+            template <class T>
+            struct KeepsStaleValue<T, VoidType<StaleValueMemberOperator<T>>> : StaleValueMemberOperator<T>
+            {
+            };
+
+            template <int32 len>
+            struct KeepsStaleValue<String<len>, void> : FalseType
+            {
+            };
+
+            template <class T, int32 baseCount>
+            struct KeepsStaleValue<Array<T, baseCount>, void> : FalseType
+            {
+            };
+
+            template <>
+            struct KeepsStaleValue<bool, void> : FalseType
+            {
+            };
+
+            template <>
+            struct KeepsStaleValue<double, void> : FalseType
+            {
+            };
+
+            template <>
+            struct KeepsStaleValue<int32, void> : FalseType
+            {
+            };
+
+            template <>
+            struct KeepsStaleValue<int64, void> : FalseType
+            {
+            };
+
+            template <>
+            struct KeepsStaleValue<uint32, void> : FalseType
+            {
+            };
+
+            template <>
+            struct KeepsStaleValue<uint64, void> : FalseType
+            {
+            };
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+            template <>
+            struct KeepsStaleValue<std::string, void> : FalseType
+            {
+            };
+
+            template <class T>
+            struct KeepsStaleValue<std::vector<T>, void> : FalseType
+            {
+            };
+
+#endif
+
+            template <class T>
+            using MoveAssignOperator = decltype( DeclVal<T&>() = DeclVal<T&&>() );
+
+            template <class T>
+            using IsMoveAssignable = IsDetectedExact<T&, MoveAssignOperator, T>;
+
+            // Makes an array element that is reused for a new message the same as a new element, for a type that could
+            // otherwise keep part of the old message. The new element is built before the old one is touched, so an
+            // exception thrown by a constructor leaves the old element in place for the array to destroy. A type that
+            // cannot be assigned is moved into the place of the old element.
+            template <class T>
+            void ResetElement( T& element ) noexcept( false )
+            {
+                T fresh = T();
+
+                if constexpr ( IsMoveAssignable<T>::Value )
+                {
+                    element = static_cast<T&&>( fresh );
+                }
+                else
+                {
+                    element.~T();
+                    new ( &element ) T( static_cast<T&&>( fresh ) );
+                }
+            }
+
+            // Resets the elements of an array that are reused when it is resized to count elements for a new message.
+            template <class T, int32 baseCount>
+            void ResetReusedElements( Array<T, baseCount>& data, int32 count ) noexcept( false )
+            {
+                if constexpr ( KeepsStaleValue<T>::Value )
+                {
+                    int32 reusedCount = ( count < data.GetArrayElementCount() ) ? count : data.GetArrayElementCount();
+
+                    for ( int32 a = 0; a != reusedCount; a++ )
+                    {
+                        ResetElement( data[ a ] );
+                    }
+                }
+            }
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+            template <class T>
+            void ResetReusedElements( std::vector<T>& data, std::size_t count ) noexcept( false )
+            {
+                if constexpr ( KeepsStaleValue<T>::Value )
+                {
+                    std::size_t reusedCount = ( count < data.size() ) ? count : data.size();
+
+                    for ( std::size_t a = 0; a != reusedCount; a++ )
+                    {
+                        ResetElement( data[ a ] );
+                    }
+                }
+            }
+
+#endif
+
+            template <class T, int32 baseCount>
+            void PurgePointerArray( Array<T*, baseCount>& array )
+            {
+                for ( T* elem : array )
+                {
+                    delete elem;
+                }
+
+                array.PurgeArray();
+            }
+        } // namespace Detail
+
+        class ArrayValue final : public Value
+        {
+        public:
+            static Status Parse( ArrayValue* jsonArray, const char*& text, ParseContext& context ) noexcept;
+
+            // Moves the elements collected on the element stack of the context above stackBase into the array.
+            static Status FinishParse( ArrayValue* jsonArray, int32 stackBase, ParseContext& context ) noexcept;
+
+        public:
+            using DataType = Array<Value*>;
 
             DataType data;
 
@@ -484,21 +1124,42 @@ namespace C4
 
             TERATHON_API const Array<Value*>* GetJsonValueArrayData() const noexcept override;
 
-            TERATHON_API Status Write( File& file, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const override;
+            TERATHON_API Status Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const override;
+        };
+
+        // The key of a parsed member refers to the copy held by the KeyTable of its document, and the key of an
+        // added member to storage owned by its object. Keys are null-terminated.
+        struct ObjectMember
+        {
+            Key    key;
+            Value* value = nullptr;
         };
 
-        class ObjectValue final : public Value, public Map<Value>
+        // The members of an object are kept in insertion order in one array, so iterating and writing them is
+        // sequential. Small objects are searched linearly, comparing key lengths first. Objects with more than
+        // kObjectHashThreshold members also get an open-addressing table of member indices, built when an
+        // object first grows past the threshold and kept up to date as members are added. Members keep the hash
+        // of their key, so keys are compared by address, then by hash, before their characters are compared.
+        class ObjectValue final : public Value
         {
         private:
-            Array<String<>> insertionOrder;
+            Array<ObjectMember> members;
+            Array<int32>        hashIndex;
+            Array<char*>        ownedKeys;
 
-        public:
-            using Map<Value>::RemoveAllMapElements;
-            using Map<Value>::begin;
-            using Map<Value>::end;
+            int32 SearchMembers( const char* name, int32 length ) const noexcept;
+            int32 SearchMembers( const Key& key ) const noexcept;
+            int32 ProbeHashIndex( const Key& key ) const noexcept;
+            void  InsertIntoHashIndex( int32 memberIndex ) noexcept;
+            void  FillHashIndex() noexcept;
 
         public:
-            static Status Parse( ObjectValue* jsonObjectValue, const char*& text ) noexcept;
+            static Status Parse( ObjectValue* jsonObjectValue, const char*& text, ParseContext& context ) noexcept;
+
+            // Moves the members collected on the member stack of the context above stackBase into the object.
+            static Status FinishParse( ObjectValue* jsonObjectValue, int32 stackBase, ParseContext& context ) noexcept;
+
+            static constexpr int32 kObjectHashThreshold = 16;
 
         public:
             TERATHON_API ~ObjectValue() noexcept override;
@@ -506,6 +1167,85 @@ namespace C4
             TERATHON_API ObjectValue*       AsJsonObjectValue() noexcept override;
             TERATHON_API const ObjectValue* AsJsonObjectValue() const noexcept override;
 
+            int32 GetMemberCount() const noexcept
+            {
+                return members.GetArrayElementCount();
+            }
+
+            const ObjectMember& GetMember( int32 index ) const noexcept
+            {
+                return members[ index ];
+            }
+
+            const ObjectMember* begin() const noexcept
+            {
+                return members.begin();
+            }
+
+            const ObjectMember* end() const noexcept
+            {
+                return members.end();
+            }
+
+            // Return the index of the first member with the given name, or -1. Nothing is allocated. The hash of
+            // a name is only computed for objects that have an index, and a Key brings its own. A Key returned by
+            // StructuredData::FindKey matches the members of its document by address.
+            TERATHON_API int32 FindMemberIndex( const char* name, int32 length ) const noexcept;
+            TERATHON_API int32 FindMemberIndex( const Key& key ) const noexcept;
+
+            // Return the value of the first member with the given name, or nullptr.
+            Value* FindMember( const char* name ) noexcept
+            {
+                return FindMember( name, GetKeyLength( name ) );
+            }
+
+            const Value* FindMember( const char* name ) const noexcept
+            {
+                return FindMember( name, GetKeyLength( name ) );
+            }
+
+            Value* FindMember( const char* name, int32 length ) noexcept
+            {
+                int32 index = FindMemberIndex( name, length );
+                return ( index >= 0 ) ? members[ index ].value : nullptr;
+            }
+
+            const Value* FindMember( const char* name, int32 length ) const noexcept
+            {
+                int32 index = FindMemberIndex( name, length );
+                return ( index >= 0 ) ? members[ index ].value : nullptr;
+            }
+
+            Value* FindMember( const Key& key ) noexcept
+            {
+                int32 index = FindMemberIndex( key );
+                return ( index >= 0 ) ? members[ index ].value : nullptr;
+            }
+
+            const Value* FindMember( const Key& key ) const noexcept
+            {
+                int32 index = FindMemberIndex( key );
+                return ( index >= 0 ) ? members[ index ].value : nullptr;
+            }
+
+            // The names used while objects were stored in a Map.
+            Value* FindMapElement( const char* name ) noexcept
+            {
+                return FindMember( name );
+            }
+
+            const Value* FindMapElement( const char* name ) const noexcept
+            {
+                return FindMember( name );
+            }
+
+            // Appends a member and takes ownership of the value. Throws if memory cannot be allocated, in which
+            // case the value is still owned by the caller.
+            TERATHON_API void AddMember( const char* name, Value* value ) noexcept( false );
+
+            // Deletes all members.
+            TERATHON_API void RemoveAllMembers() noexcept;
+
             TERATHON_API const String<>* FindString( const char* name ) const noexcept;
             TERATHON_API const double*   FindNumber( const char* name ) const noexcept;
             TERATHON_API const bool*     FindBool( const char* name ) const noexcept;
@@ -513,9 +1253,14 @@ namespace C4
             TERATHON_API const Array<Value*>* FindJsonValueArray( const char* name ) const noexcept;
             TERATHON_API const ObjectValue*   FindJsonObjectValue( const char* name ) const noexcept;
 
-            TERATHON_API bool InsertAccountedMapElement( Value* element );
+            TERATHON_API const String<>* FindString( const Key& key ) const noexcept;
+            TERATHON_API const double*   FindNumber( const Key& key ) const noexcept;
+            TERATHON_API const bool*     FindBool( const Key& key ) const noexcept;
+            TERATHON_API const Null*     FindJsonNull( const Key& key ) const noexcept;
+            TERATHON_API const Array<Value*>* FindJsonValueArray( const Key& key ) const noexcept;
+            TERATHON_API const ObjectValue*   FindJsonObjectValue( const Key& key ) const noexcept;
 
-            TERATHON_API Status Write( File& file, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const override;
+            TERATHON_API Status Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const override;
         };
 
         namespace Detail
@@ -545,17 +1290,117 @@ namespace C4
             template <>
             TERATHON_API Value* CreateValueFor( const Null& ) noexcept( false );
 
+            template <>
+            TERATHON_API Value* CreateValueFor( const int32& ) noexcept( false );
+
+            template <>
+            TERATHON_API Value* CreateValueFor( const int64& ) noexcept( false );
+
+            template <>
+            TERATHON_API Value* CreateValueFor( const uint32& ) noexcept( false );
+
+            template <>
+            TERATHON_API Value* CreateValueFor( const uint64& ) noexcept( false );
+
         } // namespace Detail
 
+        // Parsed documents are allocated from the arena, and a parsed tree is freed without visiting its nodes. The
+        // calls that can give a value memory outside the arena, adding a member and handing out a mutable string or
+        // array, mark the arena of the value as modified, and the tree of a modified arena is destroyed node by node
+        // before the arena is rewound. Reading a document through the non-const accessors keeps the fast teardown.
+        //
+        // Discarding a document keeps the arena chunks and the parse stack, so a StructuredData that parses one
+        // message after another stops allocating once it has seen a message of the largest size.
         class StructuredData
         {
         private:
-            Value* rootJsonValue = nullptr;
+            Value*               rootJsonValue = nullptr;
+            Arena                arena;
+            Array<Value*>        parseStack;
+            Array<ObjectMember>  memberStack;
+            KeyTable             keyTable;
+            Array<char>          keyBuffer;
+            Array<double>        numberBuffer;
+            Array<bool>          boolBuffer;
+            Array<EscapedString> escapedStrings;
+            const Key*           projectionKeys     = nullptr;
+            int32                projectionKeyCount = 0;
+            bool                 rootInArena        = false;
+            bool                 arrayPacking       = false;
+            bool                 lazyNumbers        = false;
+            bool                 trustedSkipping    = false;
+
+            ParseResult ParseNullTerminatedText( const char* text, bool inSitu = false ) noexcept;
+
+            TERATHON_API void ReleaseRoot() noexcept;
 
         public:
             TERATHON_API StructuredData() = default;
             TERATHON_API ~StructuredData() noexcept;
 
+            // Parses into the given block before allocating arena chunks from the heap. The block must outlive
+            // the StructuredData and must not be shared with another one.
+            TERATHON_API StructuredData( void* initialBlock, uint64 initialBlockSize ) noexcept;
+
+            // Discards the document and keeps the memory it used for the next one.
+            TERATHON_API void Reset() noexcept;
+
+            // Discards the document and frees all memory except the initial block.
+            TERATHON_API void Purge() noexcept;
+
+            // When enabled, arrays whose elements are all numbers or all bools are parsed into packed storage
+            // instead of one value per element. They are read through GetDataAsPointerTo<Array<double>> and
+            // GetDataAsPointerTo<Array<bool>>, and they are not reported as Array<Value*>. Deserializing one into
+            // an Array or a std::vector of the same type is a single copy. Numbers are stored as doubles, so an
+            // array holding an integer that a double cannot represent exactly is not packed, and a packed array is
+            // written with its numbers as integers only if all of them were. Off by default.
+            void SetArrayPacking( bool enable ) noexcept
+            {
+                arrayPacking = enable;
+            }
+
+            bool GetArrayPacking() const noexcept
+            {
+                return arrayPacking;
+            }
+
+            // When enabled, numbers are only checked against the grammar while parsing, and each one is converted
+            // the first time it is read, through GetDataAsPointerTo, a Find accessor, Deserialize, or Write, so
+            // numbers that are never read are never converted. Reading a number writes its converted value, so a
+            // document parsed this way must not be read from several threads at once. Arrays packed by array
+            // packing are converted while parsing. Off by default.
+            void SetLazyNumbers( bool enable ) noexcept
+            {
+                lazyNumbers = enable;
+            }
+
+            bool GetLazyNumbers() const noexcept
+            {
+                return lazyNumbers;
+            }
+
+            // When keys are given, only the members whose key is in the list are parsed, in objects at any depth, so
+            // the ancestors of a wanted member must be listed as well. The values of other members are skipped
+            // without being stored, and their keys are not stored. The list is not copied and must stay valid while
+            // documents are parsed. A count of zero parses every member, which is the default.
+            void SetProjection( const Key* keys, int32 keyCount ) noexcept
+            {
+                projectionKeys     = keys;
+                projectionKeyCount = keyCount;
+            }
+
+            // When enabled, values skipped by a projection are only scanned for their end, without checking their
+            // syntax, so a malformed skipped value may go unreported. Off by default.
+            void SetTrustedSkipping( bool enable ) noexcept
+            {
+                trustedSkipping = enable;
+            }
+
+            bool GetTrustedSkipping() const noexcept
+            {
+                return trustedSkipping;
+            }
+
             StructuredData( const StructuredData& ) = delete;
             StructuredData( StructuredData& )       = delete;
             void operator=( const StructuredData& ) = delete;
@@ -564,24 +1409,67 @@ namespace C4
             TERATHON_API ParseResult Parse( const char* fileName ) noexcept;
             TERATHON_API ParseResult Parse( const Array<char>& nullTerminatedTextBuffer ) noexcept;
 
+            // Parses a buffer that the caller gives up: escape sequences are decoded and strings are terminated in
+            // place, and strings longer than fifteen characters refer to the buffer instead of being copied. The
+            // buffer must not be modified or freed while the document is in use.
+            TERATHON_API ParseResult ParseInSitu( Array<char>& nullTerminatedTextBuffer ) noexcept;
+
+            static constexpr int32 kMaxParsePathCount = 64;
+
+            // Parses only the values that JSON Pointers refer to, with the objects and arrays that hold them, and
+            // skips the other members and elements as a projection skips them. The elements of an array before a
+            // selected element are kept as nulls, so that pointers and indices still refer to the same elements. Once
+            // every path has been parsed or found missing, the parse stops, and the rest of the text is not read or
+            // checked. Paths that refer to no value are not an error. Up to kMaxParsePathCount paths can be given,
+            // and paths given as text are compiled for each parse.
+            TERATHON_API ParseResult ParsePaths( const Array<char>& nullTerminatedTextBuffer, const CompiledPointer* paths, int32 pathCount ) noexcept;
+            TERATHON_API ParseResult ParsePaths( const Array<char>& nullTerminatedTextBuffer, const char* const* paths, int32 pathCount ) noexcept;
+
+            template <int32 pathCount>
+            ParseResult ParsePaths( const Array<char>& nullTerminatedTextBuffer, const char* const ( &paths )[ pathCount ] ) noexcept
+            {
+                return ParsePaths( nullTerminatedTextBuffer, paths, pathCount );
+            }
+
             TERATHON_API Status Write( const char* fileName, const uint32 indentationLength = 2, const char indentationChar = ' ' ) noexcept;
+            TERATHON_API Status Write( OutputSink& sink, const uint32 indentationLength = 2, const char indentationChar = ' ' ) noexcept;
+
+            // Replaces the contents of the buffer with the JSON text, without a terminating null character. The
+            // buffer's storage is reused, so writing messages of similar size into the same buffer does not allocate.
+            TERATHON_API Status WriteToBuffer( Array<char>& buffer, const uint32 indentationLength = 2, const char indentationChar = ' ' ) noexcept;
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+            TERATHON_API Status WriteToBuffer( std::string& buffer, const uint32 indentationLength = 2, const char indentationChar = ' ' ) noexcept;
+#endif
 
             TERATHON_API Value*       GetRootJsonValue() noexcept;
             TERATHON_API const Value* GetRootJsonValue() const noexcept;
 
+            // Returns the key as stored by the parsed document, or nullptr if no object in the document has a
+            // member with that name. Looking the returned key up in the objects of the document compares member
+            // keys by address. It is valid until the document is discarded.
+            TERATHON_API const Key* FindKey( const char* name ) const noexcept;
+            TERATHON_API const Key* FindKey( const Key& key ) const noexcept;
+
+            // Returns the value that a JSON Pointer refers to in the document, or nullptr, as Value::FindPointer does.
+            TERATHON_API const Value* FindPointer( const char* pointer ) const noexcept;
+            TERATHON_API const Value* FindPointer( const CompiledPointer& pointer ) const noexcept;
+
             template <class T>
             Status DeserializeTo( T& data ) noexcept
             {
                 return MayThrow(
                     [ & ]()
                     {
+                        const Value* root = rootJsonValue;
+
                         if constexpr ( Detail::HasDeserializeMember<T>::Value )
                         {
-                            return data.Deserialize( this->GetRootJsonValue() );
+                            return data.Deserialize( root );
                         }
                         else
                         {
-                            return Deserialize( this->GetRootJsonValue(), data );
+                            return Deserialize( root, data );
                         }
                     } );
             }
@@ -589,10 +1477,7 @@ namespace C4
             template <class T>
             Status SerializeFrom( const T& data ) noexcept
             {
-                if ( rootJsonValue != nullptr )
-                {
-                    delete rootJsonValue;
-                }
+                ReleaseRoot();
 
                 Status status = MayThrow(
                     [ & ]()
@@ -640,64 +1525,595 @@ namespace C4
 
         TERATHON_API String<256> ParseResultToString( const ParseResult& parseResult ) noexcept;
 
-        template <class T>
-        Status Validate( const Value* value, const char* name, const T& data ) noexcept
+        // The grammars that CheckSyntax checks a document against.
+        //
+        // kRfc8259 is the grammar of RFC 8259.
+        //
+        // kParse is the grammar of StructuredData::Parse, which differs from RFC 8259 in these ways:
+        // - A number may start with a plus sign, have whitespace after its minus sign, and omit the digits before or
+        //   after its decimal point, so .5, 1., +1, - 1, and 1.e5 are accepted.
+        // - The delete character 0x7F must be escaped in a string.
+        // - The escape sequence \u0000 is rejected.
+        enum class Grammar : uint8
         {
-            const ObjectValue* objectValue = value->AsJsonObjectValue();
+            kRfc8259,
+            kParse
+        };
 
-            if ( !objectValue )
+        // Checks that a text is a document in a grammar without building its values. With Grammar::kParse, the status
+        // and error position are those that Parse would report for the text. As for a buffer passed to Parse, length
+        // counts the terminating null character. Nothing is allocated unless arrays and objects are nested more than 32
+        // deep, and the depth of nesting is only limited by memory.
+        TERATHON_API ParseResult CheckSyntax( const char* nullTerminatedText, size_t length, Grammar grammar = Grammar::kRfc8259 ) noexcept;
+
+        // A number reported to an event handler. For kInt64 and kUInt64 numbers, integer holds the exact value, as the
+        // bits of an int64 or a uint64, and data holds the nearest double.
+        struct Number
+        {
+            NumberType type    = NumberType::kDouble;
+            uint64     integer = 0;
+            double     data    = 0.0;
+        };
+
+        // The events that ParseEvents reports to a handler, in document order. A handler derives from EventHandler and
+        // hides the functions of the events it handles. Strings and keys are only valid during the call and are not
+        // null-terminated. Returning false from an event stops the parse with Status::kStoppedByHandler.
+        struct EventHandler
+        {
+            bool OnStartObject() noexcept
             {
-                return Status::kInvalidValueType;
+                return true;
             }
 
-            const Value* associateValue = objectValue->FindMapElement( name );
+            bool OnKey( const char* /*name*/, int32 /*length*/ ) noexcept
+            {
+                return true;
+            }
 
-            if ( !associateValue )
+            bool OnEndObject( int32 /*memberCount*/ ) noexcept
             {
-                return Status::kNameNotPresent;
+                return true;
             }
 
-            return MayThrow( [ & ]() { return Validate( associateValue, data ); } );
-        }
+            bool OnStartArray() noexcept
+            {
+                return true;
+            }
 
-        template <class T>
-        Status Deserialize( const Value* value, const char* name, T& data ) noexcept
-        {
-            const ObjectValue* objectValue = value->AsJsonObjectValue();
+            bool OnEndArray( int32 /*elementCount*/ ) noexcept
+            {
+                return true;
+            }
 
-            if ( !objectValue )
+            bool OnString( const char* /*string*/, int32 /*length*/ ) noexcept
             {
-                return Status::kInvalidValueType;
+                return true;
             }
 
-            const Value* associateValue = objectValue->FindMapElement( name );
+            bool OnNumber( const Number& /*number*/ ) noexcept
+            {
+                return true;
+            }
 
-            if ( !associateValue )
+            bool OnBool( bool /*value*/ ) noexcept
             {
-                return Status::kNameNotPresent;
+                return true;
             }
 
-            return MayThrow( [ & ]() { return Deserialize( associateValue, data ); } );
-        }
+            bool OnNull() noexcept
+            {
+                return true;
+            }
+        };
 
-        template <class T>
-        Status Serialize( Value* value, const char* name, const T& data ) noexcept
+        namespace Detail
         {
-            ObjectValue* objectValue = value->AsJsonObjectValue();
-
-            if ( objectValue )
+            enum : uint8
             {
+                kValueTypeInvalid,
+                kValueTypeString,
+                kValueTypeNumber,
+                kValueTypeBool,
+                kValueTypeNull,
+                kValueTypeArray,
+                kValueTypeObject
+            };
 
-                Value* associateValue = nullptr;
+            // Maps the first character of a value to the only value type that can begin with it.
+            struct ValueTypeTable
+            {
+                uint8 type[ 256 ];
 
-                Status status = MayThrow(
-                    [ & ]()
+                constexpr ValueTypeTable() : type {}
+                {
+                    type[ uint8( '"' ) ] = kValueTypeString;
+                    type[ uint8( '-' ) ] = kValueTypeNumber;
+                    type[ uint8( '+' ) ] = kValueTypeNumber;
+                    type[ uint8( '.' ) ] = kValueTypeNumber;
+                    type[ uint8( 't' ) ] = kValueTypeBool;
+                    type[ uint8( 'f' ) ] = kValueTypeBool;
+                    type[ uint8( 'n' ) ] = kValueTypeNull;
+                    type[ uint8( '[' ) ] = kValueTypeArray;
+                    type[ uint8( '{' ) ] = kValueTypeObject;
+
+                    for ( int32 c = '0'; c <= '9'; c++ )
                     {
-                        associateValue       = Detail::CreateValueFor( data );
-                        associateValue->name = name;
-                        Serialize( associateValue, data );
-
-                        objectValue->InsertAccountedMapElement( associateValue );
+                        type[ c ] = kValueTypeNumber;
+                    }
+                }
+            };
+
+            alignas( 64 ) inline constexpr ValueTypeTable valueTypeTable;
+
+            // Compares four characters with a single load. The load may extend past the terminating null character, so
+            // it is only made when it stays within one page of memory. Otherwise the characters are compared one at a
+            // time.
+            JSON4C4_NO_SANITIZE_ADDRESS inline bool MatchLiteral4( const char* text, const char* literal ) noexcept
+            {
+                if ( ( machine_address( text ) & 4095 ) <= 4092 )
+                {
+                    uint32 textWord;
+                    uint32 literalWord;
+
+                    memcpy( &textWord, text, 4 );
+                    memcpy( &literalWord, literal, 4 );
+
+                    return textWord == literalWord;
+                }
+
+                return text[ 0 ] == literal[ 0 ] && text[ 1 ] == literal[ 1 ] && text[ 2 ] == literal[ 2 ] && text[ 3 ] == literal[ 3 ];
+            }
+
+            // The parts of the grammar that ParseEvents shares with the parser of StructuredData. The Skip functions
+            // check a string or a number without decoding it, and with Grammar::kParse, as the Read functions do.
+            TERATHON_API int32  ComputeTextWhitespaceLength( const char* text ) noexcept;
+            TERATHON_API Status ReadEventString( const char*& text, Array<char>& buffer, const char** string, int32* length ) noexcept;
+            TERATHON_API Status ReadEventNumber( const char*& text, Number* number ) noexcept;
+            TERATHON_API Status SkipEventString( const char*& text, Grammar grammar ) noexcept;
+            TERATHON_API Status SkipEventNumber( const char*& text, Grammar grammar ) noexcept;
+            TERATHON_API Status CheckTextBuffer( const char* nullTerminatedText, size_t length ) noexcept;
+            TERATHON_API void   LocateParseError( const char* start, const char* text, int32* errorLine, int32* errorColumn ) noexcept;
+
+            // Loads a file as for StructuredData::Parse and passes its null-terminated contents to parseText.
+            TERATHON_API ParseResult ParseTextFile( const char* fileName, ParseResult ( *parseText )( const char*, void* ), void* cookie ) noexcept;
+
+            // Whether a handler hides the function of EventHandler for an event. Strings, keys, and numbers are only
+            // decoded for a handler that handles them.
+            template <class Handler>
+            using HandlesStrings = IntegralConstant<bool, !IsSame<decltype( &Handler::OnString ), decltype( &EventHandler::OnString )>::Value>;
+
+            template <class Handler>
+            using HandlesKeys = IntegralConstant<bool, !IsSame<decltype( &Handler::OnKey ), decltype( &EventHandler::OnKey )>::Value>;
+
+            template <class Handler>
+            using HandlesNumbers = IntegralConstant<bool, !IsSame<decltype( &Handler::OnNumber ), decltype( &EventHandler::OnNumber )>::Value>;
+
+            // Values are only decoded with the grammar of Parse, and only CheckSyntax, which decodes nothing, uses
+            // another grammar.
+            template <Grammar grammar, class Handler>
+            Status ParseEventString( const char*& text, Handler& handler, Array<char>& buffer )
+            {
+                if constexpr ( HandlesStrings<Handler>::Value )
+                {
+                    static_assert( grammar == Grammar::kParse, "Strings are only decoded with the grammar of Parse" );
+
+                    const char* string;
+                    int32       length;
+
+                    Status status = ReadEventString( text, buffer, &string, &length );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+
+                    return handler.OnString( string, length ) ? Status::kOk : Status::kStoppedByHandler;
+                }
+                else
+                {
+                    return SkipEventString( text, grammar );
+                }
+            }
+
+            template <Grammar grammar, class Handler>
+            Status ParseEventNumber( const char*& text, Handler& handler )
+            {
+                if constexpr ( HandlesNumbers<Handler>::Value )
+                {
+                    static_assert( grammar == Grammar::kParse, "Numbers are only decoded with the grammar of Parse" );
+
+                    Number number;
+
+                    Status status = ReadEventNumber( text, &number );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+
+                    return handler.OnNumber( number ) ? Status::kOk : Status::kStoppedByHandler;
+                }
+                else
+                {
+                    return SkipEventNumber( text, grammar );
+                }
+            }
+
+            // Reads the key of a member and the colon after it, and leaves text at the value of the member.
+            template <Grammar grammar, class Handler>
+            Status ParseEventKey( const char*& text, Handler& handler, Array<char>& buffer )
+            {
+                if constexpr ( HandlesKeys<Handler>::Value )
+                {
+                    static_assert( grammar == Grammar::kParse, "Keys are only decoded with the grammar of Parse" );
+
+                    const char* name;
+                    int32       length;
+
+                    Status status = ReadEventString( text, buffer, &name, &length );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+
+                    if ( !handler.OnKey( name, length ) )
+                    {
+                        return Status::kStoppedByHandler;
+                    }
+                }
+                else
+                {
+                    Status status = SkipEventString( text, grammar );
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+                }
+
+                text += ComputeTextWhitespaceLength( text );
+
+                if ( text[ 0 ] != ':' )
+                {
+                    return Status::kExpectedColon;
+                }
+
+                text++;
+                text += ComputeTextWhitespaceLength( text );
+
+                return Status::kOk;
+            }
+
+            // Follows ParseAnyValue, ArrayValue::Parse, and ObjectValue::Parse. The open arrays and objects are kept
+            // on a stack rather than in recursive calls, so the depth of nesting is only limited by memory. A value
+            // that cannot be read is reported where it begins, except for a number with leading zeros.
+            template <Grammar grammar, class Handler>
+            Status ParseEventValue( const char*& text, Handler& handler, Array<char>& buffer )
+            {
+                // Each open container holds the count of its values shifted left by one, with the low bit set for an
+                // object.
+                Array<uint32, 32> containerStack;
+
+                for ( ;; )
+                {
+                    const char* start  = text;
+                    Status      status = Status::kExpectedJsonValue;
+
+                    switch ( valueTypeTable.type[ uint8( text[ 0 ] ) ] )
+                    {
+                    case kValueTypeString:
+                        status = ParseEventString<grammar>( text, handler, buffer );
+                        break;
+
+                    case kValueTypeNumber:
+                        status = ParseEventNumber<grammar>( text, handler );
+                        if ( status != Status::kOk && status != Status::kStoppedByHandler && status != Status::kNumbersCannotHaveLeadingZeros )
+                        {
+                            text   = start;
+                            status = Status::kExpectedJsonValue;
+                        }
+                        break;
+
+                    case kValueTypeBool:
+                        if ( MatchLiteral4( text, "true" ) )
+                        {
+                            text += 4;
+                            status = handler.OnBool( true ) ? Status::kOk : Status::kStoppedByHandler;
+                        }
+                        else if ( text[ 0 ] == 'f' && MatchLiteral4( text + 1, "alse" ) )
+                        {
+                            text += 5;
+                            status = handler.OnBool( false ) ? Status::kOk : Status::kStoppedByHandler;
+                        }
+                        break;
+
+                    case kValueTypeNull:
+                        if ( MatchLiteral4( text, "null" ) )
+                        {
+                            text += 4;
+                            status = handler.OnNull() ? Status::kOk : Status::kStoppedByHandler;
+                        }
+                        break;
+
+                    case kValueTypeArray:
+                        if ( !handler.OnStartArray() )
+                        {
+                            return Status::kStoppedByHandler;
+                        }
+
+                        text++;
+                        text += ComputeTextWhitespaceLength( text );
+
+                        if ( text[ 0 ] != ']' )
+                        {
+                            containerStack.AppendArrayElement( 0 );
+                            continue;
+                        }
+
+                        text++;
+                        status = handler.OnEndArray( 0 ) ? Status::kOk : Status::kStoppedByHandler;
+                        break;
+
+                    case kValueTypeObject:
+                        if ( !handler.OnStartObject() )
+                        {
+                            return Status::kStoppedByHandler;
+                        }
+
+                        text++;
+                        text += ComputeTextWhitespaceLength( text );
+
+                        if ( text[ 0 ] != '}' )
+                        {
+                            containerStack.AppendArrayElement( 1 );
+
+                            status = ParseEventKey<grammar>( text, handler, buffer );
+                            if ( status != Status::kOk )
+                            {
+                                return status;
+                            }
+
+                            continue;
+                        }
+
+                        text++;
+                        status = handler.OnEndObject( 0 ) ? Status::kOk : Status::kStoppedByHandler;
+                        break;
+                    }
+
+                    if ( status != Status::kOk )
+                    {
+                        return status;
+                    }
+
+                    // The value is complete. It is followed by the next value of its container, or closes the
+                    // container, and possibly the containers around it.
+                    for ( ;; )
+                    {
+                        int32 depth = containerStack.GetArrayElementCount();
+                        if ( depth == 0 )
+                        {
+                            return Status::kOk;
+                        }
+
+                        uint32 container = containerStack[ depth - 1 ] + 2;
+                        bool   object    = ( ( container & 1 ) != 0 );
+
+                        text += ComputeTextWhitespaceLength( text );
+
+                        if ( text[ 0 ] == ',' )
+                        {
+                            containerStack[ depth - 1 ] = container;
+
+                            text++;
+                            text += ComputeTextWhitespaceLength( text );
+
+                            if ( object )
+                            {
+                                if ( text[ 0 ] == '}' )
+                                {
+                                    return Status::kExpectedJsonValue;
+                                }
+
+                                status = ParseEventKey<grammar>( text, handler, buffer );
+                                if ( status != Status::kOk )
+                                {
+                                    return status;
+                                }
+                            }
+
+                            break;
+                        }
+
+                        if ( object )
+                        {
+                            if ( text[ 0 ] != '}' )
+                            {
+                                return Status::kExpectedClosingCurlyBracesOrComma;
+                            }
+                        }
+                        else if ( text[ 0 ] != ']' )
+                        {
+                            return Status::kExpectedClosingSquareBracketsOrComma;
+                        }
+
+                        text++;
+                        containerStack.SetArrayElementCount( depth - 1 );
+
+                        int32 count = int32( container >> 1 );
+                        if ( !( object ? handler.OnEndObject( count ) : handler.OnEndArray( count ) ) )
+                        {
+                            return Status::kStoppedByHandler;
+                        }
+                    }
+                }
+            }
+
+            // Follows ParseDocument.
+            template <Grammar grammar, class Handler>
+            ParseResult ParseEventDocument( const char* nullTerminatedText, Handler& handler ) noexcept
+            {
+                ParseResult parseResult;
+                const char* text  = nullTerminatedText + ComputeTextWhitespaceLength( nullTerminatedText );
+                const char* start = text;
+
+                parseResult.status = MayThrow(
+                    [ & ]()
+                    {
+                        Array<char> buffer;
+
+                        return ParseEventValue<grammar>( text, handler, buffer );
+                    } );
+
+                if ( parseResult.status == Status::kException )
+                {
+                    return parseResult;
+                }
+
+                text += ComputeTextWhitespaceLength( text );
+                if ( parseResult.status == Status::kOk && text[ 0 ] != 0 )
+                {
+                    parseResult.status = Status::kExpectedEndOfFile;
+                }
+
+                if ( parseResult.status != Status::kOk )
+                {
+                    LocateParseError( start, text, &parseResult.errorLine, &parseResult.errorColumn );
+                }
+
+                return parseResult;
+            }
+        } // namespace Detail
+
+        // Parses a document without building its values and reports each value to handler as it is read, as described
+        // for EventHandler. The grammar, and the status and error position reported for a document that is not valid,
+        // are those of StructuredData::Parse. As for a buffer passed to Parse, length counts the terminating null
+        // character. Memory is only allocated to decode strings and keys that contain escape sequences, and for arrays
+        // and objects nested more than 32 deep.
+        template <class Handler>
+        ParseResult ParseEvents( const char* nullTerminatedText, size_t length, Handler& handler ) noexcept
+        {
+            Status status = Detail::CheckTextBuffer( nullTerminatedText, length );
+
+            if ( status != Status::kOk )
+            {
+                return ParseResult { status, 0, 0 };
+            }
+
+            return Detail::ParseEventDocument<Grammar::kParse>( nullTerminatedText, handler );
+        }
+
+        template <class Handler>
+        ParseResult ParseEvents( const Array<char>& nullTerminatedTextBuffer, Handler& handler ) noexcept
+        {
+            return ParseEvents( nullTerminatedTextBuffer.begin(), size_t( nullTerminatedTextBuffer.GetArrayElementCount() ), handler );
+        }
+
+        // Parses a file as above. Where possible, the file is memory mapped rather than read, so documents larger than
+        // the available memory can be processed.
+        template <class Handler>
+        ParseResult ParseEventsFromFile( const char* fileName, Handler& handler ) noexcept
+        {
+            return Detail::ParseTextFile(
+                fileName,
+                []( const char* text, void* cookie ) { return Detail::ParseEventDocument<Grammar::kParse>( text, *static_cast<Handler*>( cookie ) ); },
+                &handler );
+        }
+
+        template <class T>
+        Status Validate( const Value* value, const char* name, const T& data ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            const Value* associateValue = objectValue->FindMember( name );
+
+            if ( !associateValue )
+            {
+                return Status::kNameNotPresent;
+            }
+
+            return MayThrow( [ & ]() { return Validate( associateValue, data ); } );
+        }
+
+        template <class T>
+        Status Validate( const Value* value, const Key& key, const T& data ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            const Value* associateValue = objectValue->FindMember( key );
+
+            if ( !associateValue )
+            {
+                return Status::kNameNotPresent;
+            }
+
+            return MayThrow( [ & ]() { return Validate( associateValue, data ); } );
+        }
+
+        template <class T>
+        Status Deserialize( const Value* value, const char* name, T& data ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            const Value* associateValue = objectValue->FindMember( name );
+
+            if ( !associateValue )
+            {
+                return Status::kNameNotPresent;
+            }
+
+            return MayThrow( [ & ]() { return Deserialize( associateValue, data ); } );
+        }
+
+        template <class T>
+        Status Deserialize( const Value* value, const Key& key, T& data ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            const Value* associateValue = objectValue->FindMember( key );
+
+            if ( !associateValue )
+            {
+                return Status::kNameNotPresent;
+            }
+
+            return MayThrow( [ & ]() { return Deserialize( associateValue, data ); } );
+        }
+
+        template <class T>
+        Status Serialize( Value* value, const char* name, const T& data ) noexcept
+        {
+            ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( objectValue )
+            {
+
+                Value* associateValue = nullptr;
+
+                Status status = MayThrow(
+                    [ & ]()
+                    {
+                        associateValue = Detail::CreateValueFor( data );
+                        Serialize( associateValue, data );
+
+                        objectValue->AddMember( name, associateValue );
 
                         return Status::kOk;
                     } );
@@ -776,11 +2192,738 @@ namespace C4
         }
 
         template <class T>
-        Status Serialize( Value* value, const T& data ) noexcept
+        Status Serialize( Value* value, const T& data ) noexcept
+        {
+            T* valueData = value->GetDataAsPointerTo<T>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    if constexpr ( Detail::HasSerializeMember<T>::Value )
+                    {
+                        return data.Serialize( value );
+                    }
+                    else
+                    {
+                        *valueData = data;
+
+                        return Status::kOk;
+                    }
+                } );
+        }
+
+        // Integers are read from and written to the exact integer storage of a number. Reading a number that does not
+        // fit in the destination fails with kNumberOutOfRange, and reading a non-integral double fails with
+        // kInvalidValueType.
+        template <>
+        TERATHON_API Status Validate( const Value* value, const int32& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, int32& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const int32& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const int64& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, int64& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const int64& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const uint32& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, uint32& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const uint32& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const uint64& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, uint64& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const uint64& data ) noexcept;
+
+        // A StringView deserialized from a Value refers to the string stored in the value.
+        namespace Detail
+        {
+            template <>
+            TERATHON_API Value* CreateValueFor( const StringView& ) noexcept( false );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const StringView& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, StringView& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const StringView& data ) noexcept;
+
+        namespace Detail
+        {
+            // Converts an element of a packed number array the way Deserialize converts a number to an integer.
+            TERATHON_API Status ConvertPackedNumber( double number, int32* result ) noexcept;
+            TERATHON_API Status ConvertPackedNumber( double number, int64* result ) noexcept;
+            TERATHON_API Status ConvertPackedNumber( double number, uint32* result ) noexcept;
+            TERATHON_API Status ConvertPackedNumber( double number, uint64* result ) noexcept;
+
+            template <class T>
+            struct IsPackedInteger
+            {
+                static constexpr bool Value = IsSame<T, int32>::Value || IsSame<T, int64>::Value || IsSame<T, uint32>::Value || IsSame<T, uint64>::Value;
+            };
+
+            // Packed numbers can be read as doubles and integers, and packed bools as bools.
+            template <class Element, class T>
+            struct CanReadPacked
+            {
+                static constexpr bool Value = IsSame<Element, T>::Value || ( IsSame<Element, double>::Value && IsPackedInteger<T>::Value );
+            };
+
+            // Calls read with the elements of a packed array whose elements can be read as T, and fails with
+            // kInvalidValueType for any other value.
+            template <class T, class Read>
+            Status ReadPackedArray( const Value* value, Read&& read ) noexcept
+            {
+                if ( const Array<double>* numbers = value->GetDataAsPointerTo<Array<double>>() )
+                {
+                    if constexpr ( CanReadPacked<double, T>::Value )
+                    {
+                        return read( *numbers );
+                    }
+                }
+                else if ( const Array<bool>* bools = value->GetDataAsPointerTo<Array<bool>>() )
+                {
+                    if constexpr ( CanReadPacked<bool, T>::Value )
+                    {
+                        return read( *bools );
+                    }
+                }
+
+                return Status::kInvalidValueType;
+            }
+
+            template <class T, class Element>
+            Status ValidatePackedElements( const Array<Element>& elements ) noexcept
+            {
+                if constexpr ( !IsSame<Element, T>::Value )
+                {
+                    T converted;
+
+                    for ( Element element : elements )
+                    {
+                        Status status = ConvertPackedNumber( element, &converted );
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+                }
+
+                return Status::kOk;
+            }
+
+            // Elements of the destination type are copied in one block.
+            template <class T, class Element>
+            Status ReadPackedElements( const Array<Element>& elements, T* data ) noexcept
+            {
+                int32 count = elements.GetArrayElementCount();
+
+                if constexpr ( IsSame<Element, T>::Value )
+                {
+                    if ( count != 0 )
+                    {
+                        memcpy( data, elements.begin(), sizeof( T ) * size_t( count ) );
+                    }
+                }
+                else
+                {
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        Status status = ConvertPackedNumber( elements[ a ], &data[ a ] );
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+                }
+
+                return Status::kOk;
+            }
+        } // namespace Detail
+
+        template <class T>
+        Status Validate( const Value* value, const Array<T>& /*data*/ ) noexcept
+        {
+            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !valueData )
+            {
+                return Detail::ReadPackedArray<T>( value, []( const auto& elements ) { return Detail::ValidatePackedElements<T>( elements ); } );
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    const T temp = T();
+
+                    Status status;
+
+                    for ( Value* valueElement : *valueData )
+                    {
+                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        {
+
+                            status = temp.Validate( valueElement );
+                        }
+                        else
+                        {
+                            status = Validate( valueElement, temp );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Deserialize( const Value* value, Array<T>& data ) noexcept
+        {
+            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !valueData )
+            {
+                return Detail::ReadPackedArray<T>( value,
+                                                   [ & ]( const auto& elements )
+                                                   {
+                                                       return MayThrow(
+                                                           [ & ]()
+                                                           {
+                                                               data.SetArrayElementCount( elements.GetArrayElementCount() );
+                                                               return Detail::ReadPackedElements( elements, data.begin() );
+                                                           } );
+                                                   } );
+            }
+
+            // Elements are deserialized in place, so an array that is filled from one message after another reuses its
+            // storage and the storage held by its elements. Elements of a type that could keep part of the old message,
+            // such as an optional field that the new one leaves out, are reset first.
+            return MayThrow(
+                [ & ]()
+                {
+                    int32 count = valueData->GetArrayElementCount();
+
+                    Detail::ResetReusedElements( data, count );
+                    data.SetArrayElementCount( count );
+
+                    Status status;
+
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        {
+                            status = data[ a ].Deserialize( ( *valueData )[ a ] );
+                        }
+                        else
+                        {
+                            status = Deserialize( ( *valueData )[ a ], data[ a ] );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Serialize( Value* value, const Array<T>& data ) noexcept
+        {
+            Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    Detail::PurgePointerArray( *valueData );
+                    valueData->ReserveArrayElementCount( data.GetArrayElementCount() );
+
+                    for ( const T& element : data )
+                    {
+                        Value* value = nullptr;
+
+                        Status status = MayThrow(
+                            [ & ]()
+                            {
+                                value = Detail::CreateValueFor( element );
+                                return Status::kOk;
+                            } );
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+
+                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                        {
+                            status = element.Serialize( value );
+                        }
+                        else
+                        {
+                            status = Serialize( value, element );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            delete value;
+                            return status;
+                        }
+
+                        valueData->AppendArrayElement( value );
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Validate( const Value* value, const ObjectMap<T>& /*data*/ ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    Status status;
+                    T      temp;
+
+                    for ( const ObjectMember& member : *objectValue )
+                    {
+                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        {
+                            status = temp.Validate( member.value );
+                        }
+                        else
+                        {
+                            status = Validate( member.value, temp );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Deserialize( const Value* value, ObjectMap<T>& data ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    using DataMapElementType = typename ObjectMap<T>::ElementType;
+
+                    Status status;
+
+                    for ( const ObjectMember& member : *objectValue )
+                    {
+                        const char* key = member.key.name;
+
+                        DataMapElementType* dataMapElement = data.FindMapElement( key );
+
+                        const bool addedNew = ( dataMapElement == nullptr );
+
+                        if ( addedNew )
+                        {
+                            status = MayThrow(
+                                [ & ]()
+                                {
+                                    dataMapElement = new DataMapElementType;
+                                    return Status::kOk;
+                                } );
+
+                            if ( status != Status::kOk )
+                            {
+                                return status;
+                            }
+
+                            dataMapElement->name = key;
+                        }
+
+                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        {
+                            status = dataMapElement->data.Deserialize( member.value );
+                        }
+                        else
+                        {
+                            status = Deserialize( member.value, dataMapElement->data );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            if ( addedNew )
+                            {
+                                delete dataMapElement;
+                            }
+
+                            return status;
+                        }
+
+                        if ( addedNew )
+                        {
+                            status = MayThrow(
+                                [ & ]()
+                                {
+                                    data.InsertMapElement( dataMapElement );
+                                    return Status::kOk;
+                                } );
+
+                            if ( status != Status::kOk )
+                            {
+                                delete dataMapElement;
+                                return status;
+                            }
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Serialize( Value* value, const ObjectMap<T>& data ) noexcept
+        {
+            ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    objectValue->RemoveAllMembers();
+
+                    T      temp;
+                    Status status;
+
+                    for ( const auto* dataMapElement : data )
+                    {
+                        Value* elem = Detail::CreateValueFor( temp );
+
+                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                        {
+                            status = dataMapElement->data.Serialize( elem );
+                        }
+                        else
+                        {
+                            status = Serialize( elem, dataMapElement->data );
+                        }
+
+                        if ( status == Status::kOk )
+                        {
+                            status = MayThrow(
+                                [ & ]()
+                                {
+                                    objectValue->AddMember( dataMapElement->name, elem );
+                                    return Status::kOk;
+                                } );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            delete elem;
+                            return status;
+                        }
+                    }
+                    return Status::kOk;
+                } );
+        }
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+        namespace Detail
+        {
+            template <>
+            TERATHON_API Value* CreateValueFor( const std::string& );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const std::string& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, std::string& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const std::string& data ) noexcept;
+
+        namespace Detail
+        {
+            template <>
+            TERATHON_API Value* CreateValueFor( const std::string_view& );
+        }
+
+        template <>
+        TERATHON_API Status Validate( const Value* value, const std::string_view& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Deserialize( const Value* value, std::string_view& data ) noexcept;
+
+        template <>
+        TERATHON_API Status Serialize( Value* value, const std::string_view& data ) noexcept;
+
+        template <class T>
+        Status Validate( const Value* value, const std::vector<T>& /*data*/ ) noexcept
+        {
+            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !valueData )
+            {
+                return Detail::ReadPackedArray<T>( value, []( const auto& elements ) { return Detail::ValidatePackedElements<T>( elements ); } );
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    const T temp = T();
+                    Status  status;
+
+                    for ( Value* value : *valueData )
+                    {
+                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        {
+                            status = temp.Validate( value );
+                        }
+                        else
+                        {
+                            status = Validate( value, temp );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Deserialize( const Value* value, std::vector<T>& data ) noexcept
+        {
+            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !valueData )
+            {
+                return Detail::ReadPackedArray<T>( value,
+                                                   [ & ]( const auto& elements )
+                                                   {
+                                                       return MayThrow(
+                                                           [ & ]()
+                                                           {
+                                                               int32 count = elements.GetArrayElementCount();
+
+                                                               data.resize( std::size_t( count ) );
+
+                                                               if constexpr ( Detail::IsSame<T, bool>::Value )
+                                                               {
+                                                                   // std::vector<bool> stores bits.
+                                                                   for ( int32 a = 0; a != count; a++ )
+                                                                   {
+                                                                       data[ std::size_t( a ) ] = elements[ a ];
+                                                                   }
+
+                                                                   return Status::kOk;
+                                                               }
+                                                               else
+                                                               {
+                                                                   return Detail::ReadPackedElements( elements, data.data() );
+                                                               }
+                                                           } );
+                                                   } );
+            }
+
+            // Elements are deserialized in place, as for Array.
+            return MayThrow(
+                [ & ]()
+                {
+                    int32 count = valueData->GetArrayElementCount();
+
+                    Detail::ResetReusedElements( data, std::size_t( count ) );
+                    data.resize( std::size_t( count ) );
+
+                    if ( data.size() != std::size_t( count ) )
+                    {
+                        return Status::kException;
+                    }
+
+                    Status status;
+
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        {
+                            status = data[ std::size_t( a ) ].Deserialize( ( *valueData )[ a ] );
+                        }
+                        else if constexpr ( Detail::IsSame<T, bool>::Value )
+                        {
+                            // std::vector<bool> hands out proxies instead of references.
+                            bool element             = false;
+                            status                   = Deserialize( ( *valueData )[ a ], element );
+                            data[ std::size_t( a ) ] = element;
+                        }
+                        else
+                        {
+                            status = Deserialize( ( *valueData )[ a ], data[ std::size_t( a ) ] );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Serialize( Value* value, const std::vector<T>& data ) noexcept
+        {
+            Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+
+            if ( !valueData )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    Detail::PurgePointerArray( *valueData );
+                    valueData->ReserveArrayElementCount( int32( data.size() ) );
+
+                    for ( const T& element : data )
+                    {
+                        Value* value = nullptr;
+
+                        Status status = MayThrow(
+                            [ & ]()
+                            {
+                                value = Detail::CreateValueFor( element );
+                                return Status::kOk;
+                            } );
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+
+                        valueData->AppendArrayElement( value );
+
+                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                        {
+                            status = element.Serialize( value );
+                        }
+                        else
+                        {
+                            status = Serialize( value, element );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Validate( const Value* value, const std::map<std::string, T>& /*data*/ ) noexcept
+        {
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
+
+            if ( !objectValue )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    T      temp;
+                    Status status;
+
+                    for ( const ObjectMember& member : *objectValue )
+                    {
+                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        {
+                            status = temp.Validate( member.value );
+                        }
+                        else
+                        {
+                            status = Validate( member.value, temp );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+        template <class T>
+        Status Deserialize( const Value* value, std::map<std::string, T>& data ) noexcept
         {
-            T* valueData = value->GetDataAsPointerTo<T>();
+            const ObjectValue* objectValue = value->AsJsonObjectValue();
 
-            if ( !valueData )
+            if ( !objectValue )
             {
                 return Status::kInvalidValueType;
             }
@@ -788,25 +2931,37 @@ namespace C4
             return MayThrow(
                 [ & ]()
                 {
-                    if constexpr ( Detail::HasSerializeMember<T>::Value )
-                    {
-                        return data.Serialize( value );
-                    }
-                    else
+                    Status status;
+
+                    for ( const ObjectMember& member : *objectValue )
                     {
-                        *valueData = data;
+                        T& dataMapElementData = data[ member.key.name ];
 
-                        return Status::kOk;
+                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        {
+                            status = dataMapElementData.Deserialize( member.value );
+                        }
+                        else
+                        {
+                            status = Deserialize( member.value, dataMapElementData );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
+                        }
                     }
+
+                    return Status::kOk;
                 } );
         }
 
         template <class T>
-        Status Validate( const Value* value, const Array<T>& /*data*/ ) noexcept
+        Status Serialize( Value* value, const std::map<std::string, T>& data ) noexcept
         {
-            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+            ObjectValue* objectValue = value->AsJsonObjectValue();
 
-            if ( !valueData )
+            if ( !objectValue )
             {
                 return Status::kInvalidValueType;
             }
@@ -814,24 +2969,37 @@ namespace C4
             return MayThrow(
                 [ & ]()
                 {
-                    const T temp {};
+                    objectValue->RemoveAllMembers();
 
+                    T      temp;
                     Status status;
 
-                    for ( Value* valueElement : *valueData )
+                    for ( auto const& [ dataMapElementKey, dataMapElementData ] : data )
                     {
-                        if constexpr ( Detail::HasValidateMember<T>::Value )
-                        {
+                        Value* elem = Detail::CreateValueFor( temp );
 
-                            status = temp.Validate( valueElement );
+                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                        {
+                            status = dataMapElementData.Serialize( elem );
                         }
                         else
                         {
-                            status = Validate( valueElement, temp );
+                            status = Serialize( elem, dataMapElementData );
+                        }
+
+                        if ( status == Status::kOk )
+                        {
+                            status = MayThrow(
+                                [ & ]()
+                                {
+                                    objectValue->AddMember( dataMapElementKey.c_str(), elem );
+                                    return Status::kOk;
+                                } );
                         }
 
                         if ( status != Status::kOk )
                         {
+                            delete elem;
                             return status;
                         }
                     }
@@ -840,12 +3008,254 @@ namespace C4
                 } );
         }
 
+#endif
+
+        enum class NodeType : uint8
+        {
+            kNull = 0,
+            kBool,
+            kNumber,
+            kString,
+            kArray,
+            kObject
+        };
+
+        struct NodeParseContext;
+        class TextFile;
+
+        // A node of a CompactStructuredData. Every node takes 16 bytes: a type tag, a length, and either a scalar or a
+        // pointer. Strings of up to seven characters are stored in the node itself, and longer strings and the nodes
+        // of containers are stored in the arena of the document. The members of an object are stored as alternating
+        // key and value nodes, in the order they appear in the text. Nodes are only handed out as const, because a
+        // compact document cannot be modified.
+        class Node
+        {
+        private:
+            static constexpr int32 kInlineStringLength = 7;
+
+            NodeType type       = NodeType::kNull;
+            uint8    numberType = uint8( NumberType::kDouble );
+            int32    length     = 0;
+
+            union
+            {
+                uint64      integer = 0;
+                double      doubleData;
+                bool        boolData;
+                char        inlineString[ kInlineStringLength + 1 ];
+                const char* stringData;
+                const Node* elementData;
+            };
+
+            static Status ParseString( Node* node, const char*& text, NodeParseContext& context ) noexcept;
+            static Status ParseElements( Node* node, const char*& text, NodeParseContext& context ) noexcept;
+            static Status ParseMembers( Node* node, const char*& text, NodeParseContext& context ) noexcept;
+
+        public:
+            static Status Parse( Node* node, const char*& text, NodeParseContext& context ) noexcept;
+
+            NodeType GetNodeType() const noexcept
+            {
+                return type;
+            }
+
+            NumberType GetNumberType() const noexcept
+            {
+                return NumberType( numberType );
+            }
+
+            // Returns the number of characters of a string, elements of an array, or members of an object.
+            int32 GetLength() const noexcept
+            {
+                return length;
+            }
+
+            bool IsNull() const noexcept
+            {
+                return type == NodeType::kNull;
+            }
+
+            // Returns the characters of a string, or nullptr if the node is not a string. They are null-terminated
+            // unless the document borrows its strings from the text, in which case GetLength gives their number.
+            const char* GetString() const noexcept
+            {
+                if ( type != NodeType::kString )
+                {
+                    return nullptr;
+                }
+
+                return ( length <= kInlineStringLength ) ? inlineString : stringData;
+            }
+
+            // Returns a string as a view of its characters, which is empty with a nullptr text if the node is not a
+            // string.
+            StringView GetStringView() const noexcept
+            {
+                return StringView( GetString(), ( type == NodeType::kString ) ? length : 0 );
+            }
+
+            const bool* GetBool() const noexcept
+            {
+                return ( type == NodeType::kBool ) ? &boolData : nullptr;
+            }
+
+            // Reads a number as a double, rounding integers that have no exact double representation to nearest.
+            TERATHON_API bool GetNumber( double* value ) const noexcept;
+
+            // Converts a number to an int32, int64, uint32, or uint64 with the rules of Deserialize.
+            template <class T>
+            TERATHON_API Status GetInteger( T* result ) const noexcept;
+
+            // Returns the elements of an array, or nullptr if the node is not an array.
+            const Node* GetElements() const noexcept
+            {
+                return ( type == NodeType::kArray ) ? elementData : nullptr;
+            }
+
+            const Node* GetMemberKey( int32 index ) const noexcept
+            {
+                return &elementData[ index * 2 ];
+            }
+
+            const Node* GetMemberValue( int32 index ) const noexcept
+            {
+                return &elementData[ index * 2 + 1 ];
+            }
+
+            // Returns the value of the first member with the given key, or nullptr if the node is not an object or
+            // has no such member.
+            TERATHON_API const Node* FindMember( const char* name ) const noexcept;
+            TERATHON_API const Node* FindMember( const char* name, int32 nameLength ) const noexcept;
+
+            const Node* FindMember( const Key& key ) const noexcept
+            {
+                return FindMember( key.name, key.length );
+            }
+
+            TERATHON_API const char* FindString( const char* name ) const noexcept;
+            TERATHON_API bool        FindNumber( const char* name, double* value ) const noexcept;
+            TERATHON_API const bool* FindBool( const char* name ) const noexcept;
+            TERATHON_API bool        FindJsonNull( const char* name ) const noexcept;
+            TERATHON_API const Node* FindJsonArray( const char* name ) const noexcept;
+            TERATHON_API const Node* FindJsonObject( const char* name ) const noexcept;
+
+            TERATHON_API Status Write( OutputSink& sink, uint32 indentationLength, const char indentationChar, Array<char>& indentationCharArray ) const;
+        };
+
+        // Nodes are converted by their type tag. Integers follow the rules of the Value overloads: reading a number
+        // that does not fit in the destination fails with kNumberOutOfRange, and reading a non-integral double fails
+        // with kInvalidValueType.
+        TERATHON_API Status Validate( const Node* node, const String<>& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const double& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const bool& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const Null& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const int32& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const int64& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const uint32& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const uint64& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const StringView& data ) noexcept;
+
+        TERATHON_API Status Deserialize( const Node* node, String<>& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, double& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, bool& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, Null& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, int32& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, int64& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, uint32& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, uint64& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, StringView& data ) noexcept;
+
+        namespace Detail
+        {
+            template <class T, class Name>
+            Status ValidateNodeMember( const Node* node, const Name& name, const T& data ) noexcept
+            {
+                if ( node->GetNodeType() != NodeType::kObject )
+                {
+                    return Status::kInvalidValueType;
+                }
+
+                const Node* member = node->FindMember( name );
+
+                if ( !member )
+                {
+                    return Status::kNameNotPresent;
+                }
+
+                return MayThrow(
+                    [ & ]()
+                    {
+                        if constexpr ( HasNodeValidateMember<T>::Value )
+                        {
+                            return data.Validate( member );
+                        }
+                        else
+                        {
+                            return Validate( member, data );
+                        }
+                    } );
+            }
+
+            template <class T, class Name>
+            Status DeserializeNodeMember( const Node* node, const Name& name, T& data ) noexcept
+            {
+                if ( node->GetNodeType() != NodeType::kObject )
+                {
+                    return Status::kInvalidValueType;
+                }
+
+                const Node* member = node->FindMember( name );
+
+                if ( !member )
+                {
+                    return Status::kNameNotPresent;
+                }
+
+                return MayThrow(
+                    [ & ]()
+                    {
+                        if constexpr ( HasNodeDeserializeMember<T>::Value )
+                        {
+                            return data.Deserialize( member );
+                        }
+                        else
+                        {
+                            return Deserialize( member, data );
+                        }
+                    } );
+            }
+        } // namespace Detail
+
+        template <class T>
+        Status Validate( const Node* node, const char* name, const T& data ) noexcept
+        {
+            return Detail::ValidateNodeMember( node, name, data );
+        }
+
         template <class T>
-        Status Deserialize( const Value* value, Array<T>& data ) noexcept
+        Status Validate( const Node* node, const Key& key, const T& data ) noexcept
         {
-            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+            return Detail::ValidateNodeMember( node, key, data );
+        }
 
-            if ( !valueData )
+        template <class T>
+        Status Deserialize( const Node* node, const char* name, T& data ) noexcept
+        {
+            return Detail::DeserializeNodeMember( node, name, data );
+        }
+
+        template <class T>
+        Status Deserialize( const Node* node, const Key& key, T& data ) noexcept
+        {
+            return Detail::DeserializeNodeMember( node, key, data );
+        }
+
+        template <class T>
+        Status Validate( const Node* node, const Array<T>& /*data*/ ) noexcept
+        {
+            const Node* elements = node->GetElements();
+
+            if ( node->GetNodeType() != NodeType::kArray )
             {
                 return Status::kInvalidValueType;
             }
@@ -853,28 +3263,22 @@ namespace C4
             return MayThrow(
                 [ & ]()
                 {
-                    data.PurgeArray();
-                    data.ReserveArrayElementCount( valueData->GetArrayElementCount() );
+                    const T temp = T();
 
                     Status status;
 
-                    for ( Value* valueElement : *valueData )
+                    for ( int32 a = 0; a != node->GetLength(); a++ )
                     {
-                        T temp;
-                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        if constexpr ( Detail::HasNodeValidateMember<T>::Value )
                         {
-                            status = temp.Deserialize( valueElement );
+                            status = temp.Validate( &elements[ a ] );
                         }
                         else
                         {
-                            status = Deserialize( valueElement, temp );
+                            status = Validate( &elements[ a ], temp );
                         }
 
-                        if ( status == Status::kOk )
-                        {
-                            data.AppendArrayElement( ( temp ) );
-                        }
-                        else
+                        if ( status != Status::kOk )
                         {
                             return status;
                         }
@@ -885,53 +3289,41 @@ namespace C4
         }
 
         template <class T>
-        Status Serialize( Value* value, const Array<T>& data ) noexcept
+        Status Deserialize( const Node* node, Array<T>& data ) noexcept
         {
-            Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+            const Node* elements = node->GetElements();
 
-            if ( !valueData )
+            if ( node->GetNodeType() != NodeType::kArray )
             {
                 return Status::kInvalidValueType;
             }
 
+            // Elements are deserialized in place, as for the Value overload.
             return MayThrow(
                 [ & ]()
                 {
-                    Detail::PurgePointerArray( *valueData );
-                    valueData->ReserveArrayElementCount( data.GetArrayElementCount() );
-
-                    for ( const T& element : data )
-                    {
-                        Value* value = nullptr;
+                    int32 count = node->GetLength();
 
-                        Status status = MayThrow(
-                            [ & ]()
-                            {
-                                value = Detail::CreateValueFor( element );
-                                return Status::kOk;
-                            } );
+                    Detail::ResetReusedElements( data, count );
+                    data.SetArrayElementCount( count );
 
-                        if ( status != Status::kOk )
-                        {
-                            return status;
-                        }
+                    Status status;
 
-                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        if constexpr ( Detail::HasNodeDeserializeMember<T>::Value )
                         {
-                            status = element.Serialize( value );
+                            status = data[ a ].Deserialize( &elements[ a ] );
                         }
                         else
                         {
-                            status = Serialize( value, element );
+                            status = Deserialize( &elements[ a ], data[ a ] );
                         }
 
                         if ( status != Status::kOk )
                         {
-                            delete value;
                             return status;
                         }
-
-                        valueData->AppendArrayElement( value );
                     }
 
                     return Status::kOk;
@@ -939,11 +3331,9 @@ namespace C4
         }
 
         template <class T>
-        Status Validate( const Value* value, const ObjectMap<T>& /*data*/ ) noexcept
+        Status Validate( const Node* node, const ObjectMap<T>& /*data*/ ) noexcept
         {
-            const ObjectValue* objectValue = value->AsJsonObjectValue();
-
-            if ( !objectValue )
+            if ( node->GetNodeType() != NodeType::kObject )
             {
                 return Status::kInvalidValueType;
             }
@@ -954,15 +3344,15 @@ namespace C4
                     Status status;
                     T      temp;
 
-                    for ( const auto* objectValueMapElement : *objectValue )
+                    for ( int32 a = 0; a != node->GetLength(); a++ )
                     {
-                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        if constexpr ( Detail::HasNodeValidateMember<T>::Value )
                         {
-                            status = temp.Validate( objectValueMapElement );
+                            status = temp.Validate( node->GetMemberValue( a ) );
                         }
                         else
                         {
-                            status = Validate( objectValueMapElement, temp );
+                            status = Validate( node->GetMemberValue( a ), temp );
                         }
 
                         if ( status != Status::kOk )
@@ -970,16 +3360,15 @@ namespace C4
                             return status;
                         }
                     }
+
                     return Status::kOk;
                 } );
         }
 
         template <class T>
-        Status Deserialize( const Value* value, ObjectMap<T>& data ) noexcept
+        Status Deserialize( const Node* node, ObjectMap<T>& data ) noexcept
         {
-            const ObjectValue* objectValue = value->AsJsonObjectValue();
-
-            if ( !objectValue )
+            if ( node->GetNodeType() != NodeType::kObject )
             {
                 return Status::kInvalidValueType;
             }
@@ -991,9 +3380,10 @@ namespace C4
 
                     Status status;
 
-                    for ( const auto* objectValueMapElement : *objectValue )
+                    for ( int32 a = 0; a != node->GetLength(); a++ )
                     {
-                        const auto& key = objectValueMapElement->GetKey();
+                        const Node*    keyNode = node->GetMemberKey( a );
+                        const String<> key( keyNode->GetString(), keyNode->GetLength() );
 
                         DataMapElementType* dataMapElement = data.FindMapElement( key );
 
@@ -1016,13 +3406,13 @@ namespace C4
                             dataMapElement->name = key;
                         }
 
-                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        if constexpr ( Detail::HasNodeDeserializeMember<T>::Value )
                         {
-                            status = dataMapElement->data.Deserialize( objectValueMapElement );
+                            status = dataMapElement->data.Deserialize( node->GetMemberValue( a ) );
                         }
                         else
                         {
-                            status = Deserialize( objectValueMapElement, dataMapElement->data );
+                            status = Deserialize( node->GetMemberValue( a ), dataMapElement->data );
                         }
 
                         if ( status != Status::kOk )
@@ -1044,11 +3434,55 @@ namespace C4
                                     return Status::kOk;
                                 } );
 
-                            if ( status != Status::kOk )
-                            {
-                                delete dataMapElement;
-                                return status;
-                            }
+                            if ( status != Status::kOk )
+                            {
+                                delete dataMapElement;
+                                return status;
+                            }
+                        }
+                    }
+
+                    return Status::kOk;
+                } );
+        }
+
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+        TERATHON_API Status Validate( const Node* node, const std::string& data ) noexcept;
+        TERATHON_API Status Validate( const Node* node, const std::string_view& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, std::string& data ) noexcept;
+        TERATHON_API Status Deserialize( const Node* node, std::string_view& data ) noexcept;
+
+        template <class T>
+        Status Validate( const Node* node, const std::vector<T>& /*data*/ ) noexcept
+        {
+            const Node* elements = node->GetElements();
+
+            if ( node->GetNodeType() != NodeType::kArray )
+            {
+                return Status::kInvalidValueType;
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    const T temp = T();
+                    Status  status;
+
+                    for ( int32 a = 0; a != node->GetLength(); a++ )
+                    {
+                        if constexpr ( Detail::HasNodeValidateMember<T>::Value )
+                        {
+                            status = temp.Validate( &elements[ a ] );
+                        }
+                        else
+                        {
+                            status = Validate( &elements[ a ], temp );
+                        }
+
+                        if ( status != Status::kOk )
+                        {
+                            return status;
                         }
                     }
 
@@ -1057,72 +3491,62 @@ namespace C4
         }
 
         template <class T>
-        Status Serialize( Value* value, const ObjectMap<T>& data ) noexcept
+        Status Deserialize( const Node* node, std::vector<T>& data ) noexcept
         {
-            ObjectValue* objectValue = value->AsJsonObjectValue();
+            const Node* elements = node->GetElements();
 
-            if ( !objectValue )
+            if ( node->GetNodeType() != NodeType::kArray )
             {
                 return Status::kInvalidValueType;
             }
 
+            // Elements are deserialized in place, as for the Value overload.
             return MayThrow(
                 [ & ]()
                 {
-                    objectValue->RemoveAllMapElements();
+                    int32 count = node->GetLength();
 
-                    T      temp;
-                    Status status;
+                    Detail::ResetReusedElements( data, std::size_t( count ) );
+                    data.resize( std::size_t( count ) );
 
-                    for ( const auto* dataMapElement : data )
+                    if ( data.size() != std::size_t( count ) )
                     {
-                        Value* elem = Detail::CreateValueFor( temp );
-                        elem->name  = dataMapElement->name;
+                        return Status::kException;
+                    }
 
-                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                    Status status;
+
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        if constexpr ( Detail::HasNodeDeserializeMember<T>::Value )
                         {
-                            status = dataMapElement->data.Serialize( elem );
+                            status = data[ std::size_t( a ) ].Deserialize( &elements[ a ] );
+                        }
+                        else if constexpr ( Detail::IsSame<T, bool>::Value )
+                        {
+                            bool element             = false;
+                            status                   = Deserialize( &elements[ a ], element );
+                            data[ std::size_t( a ) ] = element;
                         }
                         else
                         {
-                            status = Serialize( elem, dataMapElement->data );
+                            status = Deserialize( &elements[ a ], data[ std::size_t( a ) ] );
                         }
 
                         if ( status != Status::kOk )
                         {
-                            delete elem;
                             return status;
                         }
-
-                        objectValue->InsertMapElement( elem );
                     }
+
                     return Status::kOk;
                 } );
         }
 
-#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
-
-        namespace Detail
-        {
-            template <>
-            TERATHON_API Value* CreateValueFor( const std::string& );
-        }
-
-        template <>
-        TERATHON_API Status Validate( const Value* value, const std::string& data ) noexcept;
-
-        template <>
-        TERATHON_API Status Deserialize( const Value* value, std::string& data ) noexcept;
-
-        template <>
-        TERATHON_API Status Serialize( Value* value, const std::string& data ) noexcept;
-
         template <class T>
-        Status Validate( const Value* value, const std::vector<T>& /*data*/ ) noexcept
+        Status Validate( const Node* node, const std::map<std::string, T>& /*data*/ ) noexcept
         {
-            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
-
-            if ( !valueData )
+            if ( node->GetNodeType() != NodeType::kObject )
             {
                 return Status::kInvalidValueType;
             }
@@ -1130,18 +3554,18 @@ namespace C4
             return MayThrow(
                 [ & ]()
                 {
-                    const T temp {};
-                    Status  status;
+                    T      temp;
+                    Status status;
 
-                    for ( Value* value : *valueData )
+                    for ( int32 a = 0; a != node->GetLength(); a++ )
                     {
-                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        if constexpr ( Detail::HasNodeValidateMember<T>::Value )
                         {
-                            status = temp.Validate( value );
+                            status = temp.Validate( node->GetMemberValue( a ) );
                         }
                         else
                         {
-                            status = Validate( value, temp );
+                            status = Validate( node->GetMemberValue( a ), temp );
                         }
 
                         if ( status != Status::kOk )
@@ -1155,11 +3579,9 @@ namespace C4
         }
 
         template <class T>
-        Status Deserialize( const Value* value, std::vector<T>& data ) noexcept
+        Status Deserialize( const Node* node, std::map<std::string, T>& data ) noexcept
         {
-            const Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
-
-            if ( !valueData )
+            if ( node->GetNodeType() != NodeType::kObject )
             {
                 return Status::kInvalidValueType;
             }
@@ -1167,34 +3589,23 @@ namespace C4
             return MayThrow(
                 [ & ]()
                 {
-                    data.clear();
-                    data.reserve( valueData->GetArrayElementCount() );
-
-                    if ( data.capacity() < std::size_t( valueData->GetArrayElementCount() ) )
-                    {
-                        return Status::kException;
-                    }
-
                     Status status;
 
-                    for ( Value* value : *valueData )
+                    for ( int32 a = 0; a != node->GetLength(); a++ )
                     {
-                        T temp;
+                        const Node* keyNode            = node->GetMemberKey( a );
+                        T&          dataMapElementData = data[ std::string( keyNode->GetString(), std::size_t( keyNode->GetLength() ) ) ];
 
-                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        if constexpr ( Detail::HasNodeDeserializeMember<T>::Value )
                         {
-                            status = temp->Deserialize( value );
+                            status = dataMapElementData.Deserialize( node->GetMemberValue( a ) );
                         }
                         else
                         {
-                            status = Deserialize( value, temp );
+                            status = Deserialize( node->GetMemberValue( a ), dataMapElementData );
                         }
 
-                        if ( status == Status::kOk )
-                        {
-                            data.push_back( static_cast<T&&>( temp ) );
-                        }
-                        else
+                        if ( status != Status::kOk )
                         {
                             return status;
                         }
@@ -1204,188 +3615,449 @@ namespace C4
                 } );
         }
 
+#endif
+
+        // A parsed document made of compact nodes, for documents that are read, validated, or deserialized but not
+        // modified. A node takes a fraction of the memory of the corresponding Value, lookups and conversions
+        // dispatch on the type tag instead of calling virtual functions, and the nodes of a container are contiguous.
+        // Memory is managed as for StructuredData: the nodes live in an arena that is rewound, not freed, when the
+        // next document is parsed.
+        class CompactStructuredData
+        {
+        private:
+            const Node* rootNode = nullptr;
+            Arena       arena;
+            Array<Node> parseStack;
+            TextFile*   sourceFile      = nullptr;
+            bool        stringBorrowing = false;
+
+            ParseResult ParseNullTerminatedText( const char* text ) noexcept;
+            ParseResult ParseBorrowedFile( const char* fileName ) noexcept;
+
+        public:
+            TERATHON_API CompactStructuredData() = default;
+
+            // Parses into the given block before allocating arena chunks from the heap, as for StructuredData.
+            TERATHON_API CompactStructuredData( void* initialBlock, uint64 initialBlockSize ) noexcept;
+
+            TERATHON_API ~CompactStructuredData() noexcept;
+
+            CompactStructuredData( const CompactStructuredData& ) = delete;
+            void operator=( const CompactStructuredData& )        = delete;
+
+            // With string borrowing enabled, a string or key longer than seven characters that has no escape
+            // sequences is not copied: its node refers to its characters in the parsed text, which are not
+            // null-terminated, and StringView and std::string_view members are deserialized without copying. A
+            // document parsed from a file keeps the file loaded until it is discarded. A document parsed from a
+            // buffer refers to the buffer, which must not be modified or freed while the document is in use.
+            // Borrowing is off by default and applies from the next parse.
+            void SetStringBorrowing( bool borrowing ) noexcept
+            {
+                stringBorrowing = borrowing;
+            }
+
+            bool GetStringBorrowing() const noexcept
+            {
+                return stringBorrowing;
+            }
+
+            // Discards the document and keeps the memory it used for the next one.
+            TERATHON_API void Reset() noexcept;
+
+            // Discards the document and frees all memory except the initial block.
+            TERATHON_API void Purge() noexcept;
+
+            TERATHON_API ParseResult Parse( const char* fileName ) noexcept;
+            TERATHON_API ParseResult Parse( const Array<char>& nullTerminatedTextBuffer ) noexcept;
+
+            TERATHON_API Status Write( OutputSink& sink, const uint32 indentationLength = 2, const char indentationChar = ' ' ) const noexcept;
+            TERATHON_API Status WriteToBuffer( Array<char>& buffer, const uint32 indentationLength = 2, const char indentationChar = ' ' ) const noexcept;
+
+            const Node* GetRootNode() const noexcept
+            {
+                return rootNode;
+            }
+
+            template <class T>
+            Status DeserializeTo( T& data ) const noexcept
+            {
+                if ( !rootNode )
+                {
+                    return Status::kInvalidStructuredData;
+                }
+
+                return MayThrow(
+                    [ & ]()
+                    {
+                        if constexpr ( Detail::HasNodeDeserializeMember<T>::Value )
+                        {
+                            return data.Deserialize( rootNode );
+                        }
+                        else
+                        {
+                            return Deserialize( rootNode, data );
+                        }
+                    } );
+            }
+        };
+
         template <class T>
-        Status Serialize( Value* value, const std::vector<T>& data ) noexcept
+        Status Validate( const CompactStructuredData& sd, const T& data ) noexcept
         {
-            Array<Value*>* valueData = value->GetDataAsPointerTo<Array<Value*>>();
+            const Node* root = sd.GetRootNode();
 
-            if ( !valueData )
+            if ( !root )
             {
-                return Status::kInvalidValueType;
+                return Status::kInvalidStructuredData;
             }
 
             return MayThrow(
                 [ & ]()
                 {
-                    Detail::PurgePointerArray( *valueData );
-                    valueData->ReserveArrayElementCount( int32( data.size() ) );
-
-                    for ( const T& element : data )
+                    if constexpr ( Detail::HasNodeValidateMember<T>::Value )
                     {
-                        Value* value = nullptr;
+                        return data.Validate( root );
+                    }
+                    else
+                    {
+                        return Validate( root, data );
+                    }
+                } );
+        }
 
-                        Status status = MayThrow(
-                            [ & ]()
-                            {
-                                value = Detail::CreateValueFor( element );
-                                return Status::kOk;
-                            } );
+        // Reads a document one value at a time, for code that knows the layout of its documents and decodes them into
+        // its own structures without building values. The reader follows the grammar of StructuredData::Parse, and
+        // a syntax error is reported with the status, line, and column that Parse reports for it. A value of another
+        // type than the one requested is reported as Status::kInvalidValueType at the start of the value. The first
+        // error stops the reader, and every later call returns it.
+        //
+        // Open expects the root value. EnterObject and EnterArray begin an object or an array, and Next moves to
+        // their next member or element, reading the key of a member, and returns false at the end. A value that is
+        // not read before the next call to Next is skipped. Skipping does not recurse, so a skipped value may be
+        // nested as deeply as memory allows. Strings and keys that contain escape sequences are decoded
+        // into buffers of the reader, and the views returned for strings and keys are valid until the next string or
+        // key is read. Finish checks that nothing but whitespace follows the root value.
+        class Reader
+        {
+        private:
+            enum : uint8
+            {
+                kContainerObject  = 1,
+                kContainerStarted = 2
+            };
 
-                        if ( status != Status::kOk )
+            const char*      text            = nullptr;
+            const char*      start           = nullptr;
+            const char*      errorText       = nullptr;
+            Status           status          = Status::kInvalidStructuredData;
+            bool             valuePending    = false;
+            bool             trustedSkipping = false;
+            StringView       key;
+            Array<uint8, 32> containerStack;
+            Array<char>      keyBuffer;
+            Array<char>      stringBuffer;
+
+            Status Fail( Status failure, const char* position ) noexcept;
+            Status BeginValue( NodeType type ) noexcept;
+            Status EnterContainer( NodeType type, uint8 container ) noexcept;
+
+            template <class T>
+            Status ReadNumberAs( T& value ) noexcept;
+
+        public:
+            TERATHON_API Reader() noexcept = default;
+
+            Reader( const Reader& )        = delete;
+            void operator=( const Reader& ) = delete;
+
+            TERATHON_API Status Open( const char* nullTerminatedText, size_t length ) noexcept;
+            TERATHON_API Status Open( const Array<char>& nullTerminatedTextBuffer ) noexcept;
+
+            // When enabled, skipped values are only scanned for their end, without checking their syntax, so a
+            // malformed value that is skipped may go unreported. Off by default.
+            void SetTrustedSkipping( bool enable ) noexcept
+            {
+                trustedSkipping = enable;
+            }
+
+            // Returns the type of the next value, judged by its first character.
+            TERATHON_API NodeType PeekType() noexcept;
+
+            TERATHON_API Status EnterObject() noexcept;
+            TERATHON_API Status EnterArray() noexcept;
+            TERATHON_API bool   Next() noexcept;
+
+            // Returns the key of the member that Next moved to.
+            StringView GetKey() const noexcept
+            {
+                return key;
+            }
+
+            TERATHON_API Status ReadString( StringView& string ) noexcept;
+            TERATHON_API Status ReadNumber( Number& number ) noexcept;
+            TERATHON_API Status ReadDouble( double& value ) noexcept;
+            TERATHON_API Status ReadInteger( int32& value ) noexcept;
+            TERATHON_API Status ReadInteger( int64& value ) noexcept;
+            TERATHON_API Status ReadInteger( uint32& value ) noexcept;
+            TERATHON_API Status ReadInteger( uint64& value ) noexcept;
+            TERATHON_API Status ReadBool( bool& value ) noexcept;
+            TERATHON_API Status ReadNull() noexcept;
+            TERATHON_API Status SkipValue() noexcept;
+            TERATHON_API Status Finish() noexcept;
+
+            // Moves from the next value to the value that a JSON Pointer refers to within it, skipping the members and
+            // elements before it, and leaves that value to be read next. The objects and arrays entered on the way
+            // stay open, so Next then moves on to the members and elements after it. A pointer that refers to no
+            // value stops the reader with kPointerNotFound, reported where the object, array, or other value that
+            // lacks the member or element begins. Nothing is allocated unless a key on the way holds escape
+            // sequences or the nesting is deeper than 32 levels.
+            TERATHON_API Status Seek( const CompiledPointer& pointer ) noexcept;
+
+            // Stops the reader with an error found by the code that reads it, such as a missing member, reported at
+            // the current position.
+            TERATHON_API Status Fail( Status failure ) noexcept;
+
+            Status GetStatus() const noexcept
+            {
+                return status;
+            }
+
+            // Returns the status with the line and column where the first error occurred.
+            TERATHON_API ParseResult GetParseResult() const noexcept;
+        };
+
+        // The Reader overloads read a value straight into the data, as the Value and Node overloads deserialize it.
+        // A failure stops the reader, so its parse result reports where the value that could not be read begins.
+        TERATHON_API Status Deserialize( Reader& reader, String<>& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, double& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, bool& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, Null& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, int32& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, int64& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, uint32& data ) noexcept;
+        TERATHON_API Status Deserialize( Reader& reader, uint64& data ) noexcept;
+
+        namespace Detail
+        {
+            template <class T>
+            using ReaderDeserializeMemberOperator = decltype( DeclVal<T&>().Deserialize( DeclVal<Reader&>() ) );
+
+            template <class T>
+            using HasReaderDeserializeMember = IsDetectedExact<Status, ReaderDeserializeMemberOperator, T>;
+
+            template <class T>
+            Status ReadValue( Reader& reader, T& data ) noexcept
+            {
+                Status status = MayThrow(
+                    [ & ]()
+                    {
+                        if constexpr ( HasReaderDeserializeMember<T>::Value )
                         {
-                            return status;
+                            return data.Deserialize( reader );
+                        }
+                        else
+                        {
+                            return Deserialize( reader, data );
                         }
+                    } );
 
-                        valueData->AppendArrayElement( value );
+                if ( status != Status::kOk )
+                {
+                    return reader.Fail( status );
+                }
 
-                        if constexpr ( Detail::HasSerializeMember<T>::Value )
+                return Status::kOk;
+            }
+        } // namespace Detail
+
+        // Elements are read into the existing elements first, and reset, as for the Value overload.
+        template <class T>
+        Status Deserialize( Reader& reader, Array<T>& data ) noexcept
+        {
+            if ( reader.EnterArray() != Status::kOk )
+            {
+                return reader.GetStatus();
+            }
+
+            return MayThrow(
+                [ & ]()
+                {
+                    int32 count = 0;
+
+                    while ( reader.Next() )
+                    {
+                        if ( count == data.GetArrayElementCount() )
                         {
-                            status = element.Serialize( value );
+                            data.AppendArrayElement();
                         }
-                        else
+                        else if constexpr ( Detail::KeepsStaleValue<T>::Value )
                         {
-                            status = Serialize( value, element );
+                            Detail::ResetElement( data[ count ] );
                         }
 
-                        if ( status != Status::kOk )
+                        if ( Detail::ReadValue( reader, data[ count++ ] ) != Status::kOk )
                         {
-                            return status;
+                            return reader.GetStatus();
                         }
                     }
 
-                    return Status::kOk;
+                    data.SetArrayElementCount( count );
+
+                    return reader.GetStatus();
                 } );
         }
 
         template <class T>
-        Status Validate( const Value* value, const std::map<std::string, T>& /*data*/ ) noexcept
+        Status Deserialize( Reader& reader, ObjectMap<T>& data ) noexcept
         {
-            const ObjectValue* objectValue = value->AsJsonObjectValue();
-
-            if ( !objectValue )
+            if ( reader.EnterObject() != Status::kOk )
             {
-                return Status::kInvalidValueType;
+                return reader.GetStatus();
             }
 
             return MayThrow(
                 [ & ]()
                 {
-                    T      temp;
+                    using DataMapElementType = typename ObjectMap<T>::ElementType;
+
                     Status status;
 
-                    for ( const auto* objectValueMapElement : *objectValue )
+                    while ( reader.Next() )
                     {
-                        if constexpr ( Detail::HasValidateMember<T>::Value )
+                        const StringView keyView = reader.GetKey();
+                        const String<>   key( keyView.text, keyView.length );
+
+                        DataMapElementType* dataMapElement = data.FindMapElement( key );
+
+                        const bool addedNew = ( dataMapElement == nullptr );
+
+                        if ( addedNew )
                         {
-                            status = temp.Validate( objectValueMapElement );
+                            dataMapElement       = new DataMapElementType;
+                            dataMapElement->name = key;
                         }
-                        else
+
+                        if ( Detail::ReadValue( reader, dataMapElement->data ) != Status::kOk )
                         {
-                            status = Validate( objectValueMapElement, temp );
+                            if ( addedNew )
+                            {
+                                delete dataMapElement;
+                            }
+
+                            return reader.GetStatus();
                         }
 
-                        if ( status != Status::kOk )
+                        if ( addedNew )
                         {
-                            return status;
+                            status = MayThrow(
+                                [ & ]()
+                                {
+                                    data.InsertMapElement( dataMapElement );
+                                    return Status::kOk;
+                                } );
+
+                            if ( status != Status::kOk )
+                            {
+                                delete dataMapElement;
+                                return status;
+                            }
                         }
                     }
 
-                    return Status::kOk;
+                    return reader.GetStatus();
                 } );
         }
 
-        template <class T>
-        Status Deserialize( const Value* value, std::map<std::string, T>& data ) noexcept
-        {
-            const ObjectValue* objectValue = value->AsJsonObjectValue();
+#ifdef JSON4C4_ENABLE_STD_SUPPORT_INTERNAL
+
+        TERATHON_API Status Deserialize( Reader& reader, std::string& data ) noexcept;
 
-            if ( !objectValue )
+        template <class T>
+        Status Deserialize( Reader& reader, std::vector<T>& data ) noexcept
+        {
+            if ( reader.EnterArray() != Status::kOk )
             {
-                return Status::kInvalidValueType;
+                return reader.GetStatus();
             }
 
             return MayThrow(
                 [ & ]()
                 {
-                    Status status;
+                    std::size_t count = 0;
+                    Status      status;
 
-                    for ( const auto* objectValueMapElement : *objectValue )
+                    while ( reader.Next() )
                     {
-                        T& dataMapElementData = data[ static_cast<const char*>( objectValueMapElement->GetKey() ) ];
+                        if ( count == data.size() )
+                        {
+                            data.emplace_back();
+                        }
+                        else if constexpr ( Detail::KeepsStaleValue<T>::Value )
+                        {
+                            Detail::ResetElement( data[ count ] );
+                        }
 
-                        if constexpr ( Detail::HasDeserializeMember<T>::Value )
+                        if constexpr ( Detail::IsSame<T, bool>::Value )
                         {
-                            status = dataMapElementData.Deserialize( objectValueMapElement );
+                            bool element  = false;
+                            status        = Detail::ReadValue( reader, element );
+                            data[ count ] = element;
                         }
                         else
                         {
-                            status = Deserialize( objectValueMapElement, dataMapElementData );
+                            status = Detail::ReadValue( reader, data[ count ] );
                         }
 
+                        count++;
+
                         if ( status != Status::kOk )
                         {
-                            return status;
+                            return reader.GetStatus();
                         }
                     }
 
-                    return Status::kOk;
+                    data.resize( count );
+
+                    return reader.GetStatus();
                 } );
         }
 
         template <class T>
-        Status Serialize( Value* value, const std::map<std::string, T>& data ) noexcept
+        Status Deserialize( Reader& reader, std::map<std::string, T>& data ) noexcept
         {
-            ObjectValue* objectValue = value->AsJsonObjectValue();
-
-            if ( !objectValue )
+            if ( reader.EnterObject() != Status::kOk )
             {
-                return Status::kInvalidValueType;
+                return reader.GetStatus();
             }
 
             return MayThrow(
                 [ & ]()
                 {
-                    objectValue->RemoveAllMapElements();
-
-                    T      temp;
-                    Status status;
-
-                    for ( auto const& [ dataMapElementKey, dataMapElementData ] : data )
+                    while ( reader.Next() )
                     {
-                        Value* elem = Detail::CreateValueFor( temp );
-                        elem->name  = dataMapElementKey.c_str();
-
-                        if constexpr ( Detail::HasSerializeMember<T>::Value )
-                        {
-                            status = dataMapElementData.Serialize( elem );
-                        }
-                        else
-                        {
-                            status = Serialize( elem, dataMapElementData );
-                        }
+                        const StringView key = reader.GetKey();
 
-                        if ( status != Status::kOk )
+                        if ( Detail::ReadValue( reader, data[ std::string( key.text, std::size_t( key.length ) ) ] ) != Status::kOk )
                         {
-                            delete elem;
-                            return status;
+                            return reader.GetStatus();
                         }
-
-                        objectValue->InsertMapElement( elem );
                     }
 
-                    return Status::kOk;
+                    return reader.GetStatus();
                 } );
         }
 
 #endif
 
-        inline Status ValidateProto( const Value* ) noexcept
+        // The prototype functions work on a Value or a Node, so one field list serves both kinds of documents.
+        template <class ValueType>
+        Status ValidateProto( const ValueType* ) noexcept
         {
             return Status::kOk;
         }
 
-        template <class T, class... Args>
-        Status ValidateProto( const Value* value, const T& data, Args&&... args ) noexcept
+        template <class ValueType, class T, class... Args>
+        Status ValidateProto( const ValueType* value, const T& data, Args&&... args ) noexcept
         {
             Status status = Validate( value, data );
 
@@ -1397,8 +4069,8 @@ namespace C4
             return ValidateProto( value, Detail::Forward<Args>( args )... );
         }
 
-        template <class T, class... Args>
-        Status ValidateProto( const Value* value, const char* name, const T& data, Args&&... args ) noexcept
+        template <class ValueType, class T, class... Args>
+        Status ValidateProto( const ValueType* value, const char* name, const T& data, Args&&... args ) noexcept
         {
             Status status = Validate( value, name, data );
 
@@ -1410,8 +4082,8 @@ namespace C4
             return ValidateProto( value, Detail::Forward<Args>( args )... );
         }
 
-        template <class T, class... Args>
-        Status ValidateProto( const Value* value, Detail::Optional, const char* name, const T& data, Args&&... args ) noexcept
+        template <class ValueType, class T, class... Args>
+        Status ValidateProto( const ValueType* value, Detail::Optional, const char* name, const T& data, Args&&... args ) noexcept
         {
             Status status = Validate( value, name, data );
 
@@ -1423,13 +4095,14 @@ namespace C4
             return ValidateProto( value, Detail::Forward<Args>( args )... );
         }
 
-        inline Status DeserializeProto( const Value* ) noexcept
+        template <class ValueType>
+        Status DeserializeProto( const ValueType* ) noexcept
         {
             return Status::kOk;
         }
 
-        template <class T, class... Args>
-        Status DeserializeProto( const Value* value, T& data, Args&&... args ) noexcept
+        template <class ValueType, class T, class... Args>
+        Status DeserializeProto( const ValueType* value, T& data, Args&&... args ) noexcept
         {
             Status status = Deserialize( value, data );
 
@@ -1441,8 +4114,8 @@ namespace C4
             return DeserializeProto( value, Detail::Forward<Args>( args )... );
         }
 
-        template <class T, class... Args>
-        Status DeserializeProto( const Value* value, const char* name, T& data, Args&&... args ) noexcept
+        template <class ValueType, class T, class... Args>
+        Status DeserializeProto( const ValueType* value, const char* name, T& data, Args&&... args ) noexcept
         {
             Status status = Deserialize( value, name, data );
 
@@ -1454,8 +4127,8 @@ namespace C4
             return DeserializeProto( value, Detail::Forward<Args>( args )... );
         }
 
-        template <class T, class... Args>
-        Status DeserializeProto( const Value* value, Detail::Optional, const char* name, T& data, Args&&... args ) noexcept
+        template <class ValueType, class T, class... Args>
+        Status DeserializeProto( const ValueType* value, Detail::Optional, const char* name, T& data, Args&&... args ) noexcept
         {
             Status status = Deserialize( value, name, data );
 
@@ -1467,6 +4140,301 @@ namespace C4
             return DeserializeProto( value, Detail::Forward<Args>( args )... );
         }
 
+        namespace Detail
+        {
+            template <class T>
+            struct RemoveReference
+            {
+                using Type = T;
+            };
+
+            template <class T>
+            struct RemoveReference<T&>
+            {
+                using Type = T;
+            };
+
+            template <class T>
+            struct RemoveReference<T&&>
+            {
+                using Type = T;
+            };
+
+            template <class T>
+            struct IsProtoName : FalseType
+            {
+            };
+
+            template <>
+            struct IsProtoName<const char*> : TrueType
+            {
+            };
+
+            template <>
+            struct IsProtoName<char*> : TrueType
+            {
+            };
+
+            template <size_t size>
+            struct IsProtoName<char[ size ]> : TrueType
+            {
+            };
+
+            template <size_t size>
+            struct IsProtoName<const char[ size ]> : TrueType
+            {
+            };
+
+            // The keys of the named fields of a prototype, in order.
+            template <int32 count>
+            struct ProtoKeys
+            {
+                Key keys[ ( count > 0 ) ? count : 1 ];
+            };
+
+            inline void FillProtoKeys( Key* ) noexcept
+            {
+            }
+
+            template <class T, class... Args>
+            void FillProtoKeys( Key* keys, const T& arg, const Args&... args ) noexcept
+            {
+                if constexpr ( IsProtoName<T>::Value )
+                {
+                    *keys++ = Key( arg );
+                }
+
+                FillProtoKeys( keys, args... );
+            }
+
+            template <class... Args>
+            ProtoKeys<( 0 + ... + int32( IsProtoName<typename RemoveReference<Args>::Type>::Value ) )> MakeProtoKeys( const Args&... args ) noexcept
+            {
+                ProtoKeys<( 0 + ... + int32( IsProtoName<typename RemoveReference<Args>::Type>::Value ) )> protoKeys;
+
+                FillProtoKeys( protoKeys.keys, args... );
+
+                return protoKeys;
+            }
+
+            // A prototype keeps old values if it has optional fields or fields of types that keep them. This is only
+            // used in the declarations of KeepsStaleJsonValue.
+            template <class T>
+            struct ProtoFieldKeepsStaleValue : IntegralConstant<bool, !IsProtoName<T>::Value && KeepsStaleValue<T>::Value>
+            {
+            };
+
+            template <>
+            struct ProtoFieldKeepsStaleValue<Optional> : TrueType
+            {
+            };
+
+            template <class... Args>
+            auto ProtoKeepsStaleValue( const Args&... ) noexcept -> IntegralConstant<bool, ( false || ... || ProtoFieldKeepsStaleValue<Args>::Value )>;
+
+            // These walk a prototype like ValidateProto and DeserializeProto, but look each field up with the next
+            // of the precomputed keys instead of its name.
+            template <class ValueType>
+            Status ValidateProtoKeys( const ValueType*, const Key* ) noexcept
+            {
+                return Status::kOk;
+            }
+
+            template <class ValueType, class T, class... Args>
+            Status ValidateProtoKeys( const ValueType* value, const Key* keys, const T& data, Args&&... args ) noexcept
+            {
+                Status status = Validate( value, data );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                return ValidateProtoKeys( value, keys, Forward<Args>( args )... );
+            }
+
+            template <class ValueType, class T, class... Args>
+            Status ValidateProtoKeys( const ValueType* value, const Key* keys, const char*, const T& data, Args&&... args ) noexcept
+            {
+                Status status = Validate( value, *keys, data );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                return ValidateProtoKeys( value, keys + 1, Forward<Args>( args )... );
+            }
+
+            template <class ValueType, class T, class... Args>
+            Status ValidateProtoKeys( const ValueType* value, const Key* keys, Optional, const char*, const T& data, Args&&... args ) noexcept
+            {
+                Status status = Validate( value, *keys, data );
+
+                if ( status != Status::kOk && status != Status::kNameNotPresent )
+                {
+                    return status;
+                }
+
+                return ValidateProtoKeys( value, keys + 1, Forward<Args>( args )... );
+            }
+
+            template <class ValueType>
+            Status DeserializeProtoKeys( const ValueType*, const Key* ) noexcept
+            {
+                return Status::kOk;
+            }
+
+            template <class ValueType, class T, class... Args>
+            Status DeserializeProtoKeys( const ValueType* value, const Key* keys, T& data, Args&&... args ) noexcept
+            {
+                Status status = Deserialize( value, data );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                return DeserializeProtoKeys( value, keys, Forward<Args>( args )... );
+            }
+
+            template <class ValueType, class T, class... Args>
+            Status DeserializeProtoKeys( const ValueType* value, const Key* keys, const char*, T& data, Args&&... args ) noexcept
+            {
+                Status status = Deserialize( value, *keys, data );
+
+                if ( status != Status::kOk )
+                {
+                    return status;
+                }
+
+                return DeserializeProtoKeys( value, keys + 1, Forward<Args>( args )... );
+            }
+
+            template <class ValueType, class T, class... Args>
+            Status DeserializeProtoKeys( const ValueType* value, const Key* keys, Optional, const char*, T& data, Args&&... args ) noexcept
+            {
+                Status status = Deserialize( value, *keys, data );
+
+                if ( status != Status::kOk && status != Status::kNameNotPresent )
+                {
+                    return status;
+                }
+
+                return DeserializeProtoKeys( value, keys + 1, Forward<Args>( args )... );
+            }
+
+            // These read the named field at an index of the precomputed keys, or tell whether it is optional.
+            inline Status ReadProtoField( Reader&, int32 ) noexcept
+            {
+                return Status::kOk;
+            }
+
+            template <class T, class... Args>
+            Status ReadProtoField( Reader&, int32, T&, Args&&... ) noexcept
+            {
+                static_assert( sizeof( T ) == 0, "A prototype read from a Reader cannot contain fields without a name." );
+
+                return Status::kInvalidStructuredData;
+            }
+
+            template <class T, class... Args>
+            Status ReadProtoField( Reader& reader, int32 index, const char*, T& data, Args&&... args ) noexcept
+            {
+                if ( index == 0 )
+                {
+                    return ReadValue( reader, data );
+                }
+
+                return ReadProtoField( reader, index - 1, Forward<Args>( args )... );
+            }
+
+            template <class T, class... Args>
+            Status ReadProtoField( Reader& reader, int32 index, Optional, const char*, T& data, Args&&... args ) noexcept
+            {
+                if ( index == 0 )
+                {
+                    return ReadValue( reader, data );
+                }
+
+                return ReadProtoField( reader, index - 1, Forward<Args>( args )... );
+            }
+
+            inline bool IsProtoFieldOptional( int32 ) noexcept
+            {
+                return false;
+            }
+
+            template <class T, class... Args>
+            bool IsProtoFieldOptional( int32 index, const char*, const T&, Args&&... args ) noexcept
+            {
+                return ( index != 0 ) && IsProtoFieldOptional( index - 1, Forward<Args>( args )... );
+            }
+
+            template <class T, class... Args>
+            bool IsProtoFieldOptional( int32 index, Optional, const char*, const T&, Args&&... args ) noexcept
+            {
+                return ( index == 0 ) || IsProtoFieldOptional( index - 1, Forward<Args>( args )... );
+            }
+
+            // Reads an object into the fields of a prototype as its members stream past. Each key is compared with
+            // the keys of the prototype starting after the last one found, so members in the order of the prototype
+            // are matched on the first comparison. Members that are not in the prototype are skipped without being
+            // decoded, and so are the later members of duplicate keys, so that the first one is kept as by
+            // DeserializeTo. A field that is neither optional nor found fails the reader with Status::kNameNotPresent.
+            template <int32 count, class... Args>
+            Status ReadProtoKeys( Reader& reader, const ProtoKeys<count>& protoKeys, Args&&... args ) noexcept
+            {
+                bool  found[ ( count > 0 ) ? count : 1 ] = {};
+                int32 next                               = 0;
+
+                if ( reader.EnterObject() != Status::kOk )
+                {
+                    return reader.GetStatus();
+                }
+
+                while ( reader.Next() )
+                {
+                    const StringView key = reader.GetKey();
+
+                    for ( int32 a = 0; a != count; a++ )
+                    {
+                        int32      index    = ( next + a < count ) ? next + a : next + a - count;
+                        const Key& protoKey = protoKeys.keys[ index ];
+
+                        if ( protoKey.length == key.length && Text::CompareText( protoKey.name, key.text, key.length ) )
+                        {
+                            Status fieldStatus = found[ index ] ? reader.SkipValue() : ReadProtoField( reader, index, Forward<Args>( args )... );
+
+                            if ( fieldStatus != Status::kOk )
+                            {
+                                return reader.GetStatus();
+                            }
+
+                            found[ index ] = true;
+                            next           = ( index + 1 < count ) ? index + 1 : 0;
+                            break;
+                        }
+                    }
+                }
+
+                if ( reader.GetStatus() != Status::kOk )
+                {
+                    return reader.GetStatus();
+                }
+
+                for ( int32 index = 0; index != count; index++ )
+                {
+                    if ( !found[ index ] && !IsProtoFieldOptional( index, Forward<Args>( args )... ) )
+                    {
+                        return reader.Fail( Status::kNameNotPresent );
+                    }
+                }
+
+                return Status::kOk;
+            }
+        } // namespace Detail
+
         inline Status SerializeProto( Value* ) noexcept
         {
             return Status::kOk;
@@ -1511,6 +4479,32 @@ namespace C4
             return SerializeProto( value, Detail::Forward<Args>( args )... );
         }
 
+        // Parses a document straight into an object, without building its values. The object is read as
+        // Deserialize reads it from a StructuredData, and the functions generated by DEFINE_JSON4C4_FUNCTIONS and
+        // DEFINE_JSON4C4_MEMBER_FUNCTIONS read its members as they stream past. Syntax errors are reported as Parse
+        // reports them, and an error in the contents, such as a value of another type, at the value where it occurs.
+        // With trusted skipping, members that are not read are skipped as by Reader::SetTrustedSkipping.
+        template <class T>
+        ParseResult ParseInto( const char* nullTerminatedText, size_t length, T& object, bool trustedSkipping = false ) noexcept
+        {
+            Reader reader;
+
+            reader.SetTrustedSkipping( trustedSkipping );
+
+            if ( reader.Open( nullTerminatedText, length ) == Status::kOk && Detail::ReadValue( reader, object ) == Status::kOk )
+            {
+                reader.Finish();
+            }
+
+            return reader.GetParseResult();
+        }
+
+        template <class T>
+        ParseResult ParseInto( const Array<char>& nullTerminatedTextBuffer, T& object, bool trustedSkipping = false ) noexcept
+        {
+            return ParseInto( nullTerminatedTextBuffer.begin(), size_t( nullTerminatedTextBuffer.GetArrayElementCount() ), object, trustedSkipping );
+        }
+
     } // namespace Json
 } // namespace C4
 
@@ -1602,33 +4596,79 @@ extern template TERATHON_API C4::Json::Status C4::Json::Serialize( C4::Json::Val
 
 #endif
 
+// The Node and Reader overloads are templates whose parameter is only ever Node or Reader, so they are compiled only
+// for the types that are actually read from a CompactStructuredData or with ParseInto. The keys of the prototype are
+// hashed once, on the first call, into a static table: the literals cannot be hashed at compile time because they are
+// mixed with the fields in the list.
 #define DEFINE_JSON4C4_FUNCTIONS( JSON4C4TYPE, JSON4C4PROTO )                                                                                                  \
     inline C4::Json::Status Deserialize( const C4::Json::Value* sd, JSON4C4TYPE& object ) noexcept                                                             \
     {                                                                                                                                                          \
-        return C4::Json::DeserializeProto( sd, JSON4C4PROTO );                                                                                                 \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::DeserializeProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                          \
     }                                                                                                                                                          \
     inline C4::Json::Status Validate( const C4::Json::Value* sd, const JSON4C4TYPE& object ) noexcept                                                          \
     {                                                                                                                                                          \
-        return C4::Json::ValidateProto( sd, JSON4C4PROTO );                                                                                                    \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::ValidateProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                             \
     }                                                                                                                                                          \
     inline C4::Json::Status Serialize( C4::Json::Value* sd, const JSON4C4TYPE& object ) noexcept                                                               \
     {                                                                                                                                                          \
         return C4::Json::SerializeProto( sd, JSON4C4PROTO );                                                                                                   \
-    }
+    }                                                                                                                                                          \
+    template <class JSON4C4NODE = C4::Json::Node>                                                                                                              \
+    inline C4::Json::Status Deserialize( const typename C4::Json::Detail::Identity<JSON4C4NODE>::Type* sd, JSON4C4TYPE& object ) noexcept                      \
+    {                                                                                                                                                          \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::DeserializeProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                          \
+    }                                                                                                                                                          \
+    template <class JSON4C4NODE = C4::Json::Node>                                                                                                              \
+    inline C4::Json::Status Validate( const typename C4::Json::Detail::Identity<JSON4C4NODE>::Type* sd, const JSON4C4TYPE& object ) noexcept                   \
+    {                                                                                                                                                          \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::ValidateProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                             \
+    }                                                                                                                                                          \
+    template <class JSON4C4READER = C4::Json::Reader>                                                                                                          \
+    inline C4::Json::Status Deserialize( typename C4::Json::Detail::Identity<JSON4C4READER>::Type& reader, JSON4C4TYPE& object ) noexcept                      \
+    {                                                                                                                                                          \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::ReadProtoKeys( reader, keys, JSON4C4PROTO );                                                                                  \
+    }                                                                                                                                                          \
+    auto KeepsStaleJsonValue( const JSON4C4TYPE& object ) noexcept -> decltype( C4::Json::Detail::ProtoKeepsStaleValue( JSON4C4PROTO ) );
 
 #define DEFINE_JSON4C4_MEMBER_FUNCTIONS( JSON4C4PROTO )                                                                                                        \
     inline C4::Json::Status Deserialize( const C4::Json::Value* sd ) noexcept                                                                                  \
     {                                                                                                                                                          \
-        return C4::Json::DeserializeProto( sd, JSON4C4PROTO );                                                                                                 \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::DeserializeProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                          \
     }                                                                                                                                                          \
     inline C4::Json::Status Validate( const C4::Json::Value* sd ) const noexcept                                                                               \
     {                                                                                                                                                          \
-        return C4::Json::ValidateProto( sd, JSON4C4PROTO );                                                                                                    \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::ValidateProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                             \
     }                                                                                                                                                          \
     inline C4::Json::Status Serialize( C4::Json::Value* sd ) const noexcept                                                                                    \
     {                                                                                                                                                          \
         return C4::Json::SerializeProto( sd, JSON4C4PROTO );                                                                                                   \
-    }
+    }                                                                                                                                                          \
+    template <class JSON4C4NODE = C4::Json::Node>                                                                                                              \
+    inline C4::Json::Status Deserialize( const typename C4::Json::Detail::Identity<JSON4C4NODE>::Type* sd ) noexcept                                           \
+    {                                                                                                                                                          \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::DeserializeProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                          \
+    }                                                                                                                                                          \
+    template <class JSON4C4NODE = C4::Json::Node>                                                                                                              \
+    inline C4::Json::Status Validate( const typename C4::Json::Detail::Identity<JSON4C4NODE>::Type* sd ) const noexcept                                        \
+    {                                                                                                                                                          \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::ValidateProtoKeys( sd, keys.keys, JSON4C4PROTO );                                                                             \
+    }                                                                                                                                                          \
+    template <class JSON4C4READER = C4::Json::Reader>                                                                                                          \
+    inline C4::Json::Status Deserialize( typename C4::Json::Detail::Identity<JSON4C4READER>::Type& reader ) noexcept                                           \
+    {                                                                                                                                                          \
+        static const auto keys = C4::Json::Detail::MakeProtoKeys( JSON4C4PROTO );                                                                              \
+        return C4::Json::Detail::ReadProtoKeys( reader, keys, JSON4C4PROTO );                                                                                  \
+    }                                                                                                                                                          \
+    auto KeepsStaleJsonValue() const noexcept -> decltype( C4::Json::Detail::ProtoKeepsStaleValue( JSON4C4PROTO ) );
 
 #if defined( _MSC_VER )
 
@@ -87,6 +87,18 @@ namespace Terathon
 	//# \also	$@Array::RemoveLastArrayElement@$
 
 
+	//# \function	Array::GetArrayReservedCount		Returns the number of objects an array can hold without reallocating.
+	//
+	//# \proto	int32 GetArrayReservedCount(void) const;
+	//
+	//# \desc
+	//# The $GetArrayReservedCount$ function returns the number of objects for which storage is currently
+	//# allocated. Increasing the size of the array up to this count does not allocate memory.
+	//
+	//# \also	$@Array::GetArrayElementCount@$
+	//# \also	$@Array::ReserveArrayElementCount@$
+
+
 	//# \function	Array::SetArrayElementCount		Sets the current size of an array.
 	//
 	//# \proto	void SetArrayElementCount(int32 count);
@@ -289,6 +301,11 @@ namespace Terathon
 				return (elementCount);
 			}
 
+			int32 GetArrayReservedCount(void) const
+			{
+				return (reservedCount);
+			}
+
 			int32 FindArrayElementIndex(const type& element) const;
 
 			bool operator ==(const ImmutableArray& array) const;
@@ -688,6 +705,12 @@ namespace Terathon
 			void PurgeArray(void);
 			void ReserveArrayElementCount(int32 count);
 
+			// Makes the array refer to count constructed elements at storage, which must outlive the array. The
+			// elements are destroyed with the array, but the storage is not freed, and growing the array moves the
+			// elements to storage the array owns. External storage has a reserved count of zero.
+
+			void SetExternalArray(type *storage, int32 count);
+
 			void SetArrayElementCount(int32 count);
 			void SetArrayElementCount(int32 count, const type& init);
 			type *AppendArrayElement(void);
@@ -716,7 +739,7 @@ namespace Terathon
 	Array<type, 0>::Array(const Array& array)
 	{
 		elementCount = array.elementCount;
-		reservedCount = array.reservedCount;
+		reservedCount = Max(array.reservedCount, elementCount);
 
 		if (reservedCount > 0)
 		{
@@ -753,7 +776,10 @@ namespace Terathon
 			(--pointer)->~type();
 		}
 
-		delete[] reinterpret_cast<char *>(arrayPointer);
+		if (reservedCount != 0)
+		{
+			delete[] reinterpret_cast<char *>(arrayPointer);
+		}
 	}
 
 	template <typename type>
@@ -777,18 +803,30 @@ namespace Terathon
 			(--pointer)->~type();
 		}
 
-		delete[] reinterpret_cast<char *>(arrayPointer);
+		if (reservedCount != 0)
+		{
+			delete[] reinterpret_cast<char *>(arrayPointer);
+		}
 
 		elementCount = 0;
 		reservedCount = 0;
 		arrayPointer = nullptr;
 	}
 
+	template <typename type>
+	void Array<type, 0>::SetExternalArray(type *storage, int32 count)
+	{
+		PurgeArray();
+
+		elementCount = count;
+		arrayPointer = storage;
+	}
+
 	template <typename type>
 	void Array<type, 0>::SetReservedCount(int32 count)
 	{
-		reservedCount = Max(Max(count, 4), reservedCount + Max((reservedCount / 2 + 3) & ~3, 4));
-		type *newPointer = reinterpret_cast<type *>(new char[sizeof(type) * reservedCount]);
+		int32 newReservedCount = Max(Max(count, 4), reservedCount + Max((reservedCount / 2 + 3) & ~3, 4));
+		type *newPointer = reinterpret_cast<type *>(new char[sizeof(type) * newReservedCount]);
 
 		type *pointer = arrayPointer;
 		if (pointer)
@@ -800,9 +838,13 @@ namespace Terathon
 				pointer++;
 			}
 
-			delete[] reinterpret_cast<char *>(arrayPointer);
+			if (reservedCount != 0)
+			{
+				delete[] reinterpret_cast<char *>(arrayPointer);
+			}
 		}
 
+		reservedCount = newReservedCount;
 		arrayPointer = newPointer;
 	}
 
@@ -124,6 +124,10 @@
 			extern __m128i _mm_cvtps_epi32(__m128);
 			extern __m128i _mm_add_epi32(__m128i, __m128i);
 			extern __m128i _mm_sub_epi32(__m128i, __m128i);
+			extern __m128i _mm_set1_epi8(char);
+			extern __m128i _mm_cmpeq_epi8(__m128i, __m128i);
+			extern __m128i _mm_or_si128(__m128i, __m128i);
+			extern int _mm_movemask_epi8(__m128i);
 		}
 
 	#endif
@@ -170,6 +174,13 @@
 			extern __m256 __cdecl _mm256_load_ps(const float *);
 			extern __m256 __cdecl _mm256_broadcast_ss(const float *);
 			extern void __cdecl _mm256_store_ps(float *, __m256);
+			extern __m256i __cdecl _mm256_load_si256(const __m256i *);
+			extern __m256i __cdecl _mm256_set1_epi8(char);
+			extern __m256i __cdecl _mm256_cmpeq_epi8(__m256i, __m256i);
+			extern __m256i __cdecl _mm256_cmpgt_epi8(__m256i, __m256i);
+			extern __m256i __cdecl _mm256_setzero_si256(void);
+			extern __m256i __cdecl _mm256_or_si256(__m256i, __m256i);
+			extern int __cdecl _mm256_movemask_epi8(__m256i);
 		}
 
 	#endif
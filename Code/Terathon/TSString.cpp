@@ -28,10 +28,7 @@ String<0>::String()
 
 String<0>::~String()
 {
-	if (stringPointer != localString)
-	{
-		delete[] stringPointer;
-	}
+	ReleaseString();
 }
 
 String<0>::String(const String& s)
@@ -279,12 +276,19 @@ String<0>::String(int64 n, const char *s1)
 	logicalSize = len1 + Text::Integer64ToString(n, stringPointer + len1, kStringAllocSize - 1) + 1;
 }
 
+String<0>& String<0>::SetExternalString(char *s, int32 length)
+{
+	ReleaseString();
+
+	logicalSize = length + 1;
+	physicalSize = 0;
+	stringPointer = s;
+	return (*this);
+}
+
 void String<0>::PurgeString(void)
 {
-	if (stringPointer != localString)
-	{
-		delete[] stringPointer;
-	}
+	ReleaseString();
 
 	logicalSize = 1;
 	physicalSize = kStringLocalSize;
@@ -297,12 +301,9 @@ void String<0>::Resize(int32 size)
 	logicalSize = size;
 	if (size > kStringLocalSize)
 	{
-		if ((size > physicalSize) || (size < physicalSize / 2))
+		if ((size > physicalSize) || (int32(GetPhysicalSize(size)) < physicalSize / 2))
 		{
-			if (stringPointer != localString)
-			{
-				delete[] stringPointer;
-			}
+			ReleaseString();
 
 			physicalSize = GetPhysicalSize(size);
 			stringPointer = new char[physicalSize];
@@ -310,10 +311,7 @@ void String<0>::Resize(int32 size)
 	}
 	else
 	{
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
+		ReleaseString();
 
 		physicalSize = kStringLocalSize;
 		stringPointer = localString;
@@ -346,10 +344,7 @@ String<0>& String<0>::Set(const char *s, int32 length)
 
 String<0>& String<0>::operator =(String&& s) noexcept
 {
-	if (stringPointer != localString)
-	{
-		delete[] stringPointer;
-	}
+	ReleaseString();
 
 	logicalSize = s.logicalSize;
 	physicalSize = s.physicalSize;
@@ -443,15 +438,12 @@ String<0>& String<0>::operator +=(const String<>& s)
 		int32 size = logicalSize + length;
 		if (size > physicalSize)
 		{
-			physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-			char *newPointer = new char[physicalSize];
+			int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+			char *newPointer = new char[newPhysicalSize];
 			Text::CopyText(stringPointer, newPointer);
 
-			if (stringPointer != localString)
-			{
-				delete[] stringPointer;
-			}
-
+			ReleaseString();
+			physicalSize = newPhysicalSize;
 			stringPointer = newPointer;
 		}
 
@@ -470,15 +462,12 @@ String<0>& String<0>::operator +=(const char *s)
 		int32 size = logicalSize + length;
 		if (size > physicalSize)
 		{
-			physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-			char *newPointer = new char[physicalSize];
+			int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+			char *newPointer = new char[newPhysicalSize];
 			Text::CopyText(stringPointer, newPointer);
 
-			if (stringPointer != localString)
-			{
-				delete[] stringPointer;
-			}
-
+			ReleaseString();
+			physicalSize = newPhysicalSize;
 			stringPointer = newPointer;
 		}
 
@@ -494,15 +483,12 @@ String<0>& String<0>::operator +=(char k)
 	int32 size = logicalSize + 1;
 	if (size > physicalSize)
 	{
-		physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-		char *newPointer = new char[physicalSize];
+		int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+		char *newPointer = new char[newPhysicalSize];
 		Text::CopyText(stringPointer, newPointer);
 
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
-
+		ReleaseString();
+		physicalSize = newPhysicalSize;
 		stringPointer = newPointer;
 	}
 
@@ -517,15 +503,12 @@ String<0>& String<0>::operator +=(int32 n)
 	int32 size = logicalSize + kStringAllocSize;
 	if (size > physicalSize)
 	{
-		physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-		char *newPointer = new char[physicalSize];
+		int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+		char *newPointer = new char[newPhysicalSize];
 		Text::CopyText(stringPointer, newPointer);
 
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
-
+		ReleaseString();
+		physicalSize = newPhysicalSize;
 		stringPointer = newPointer;
 	}
 
@@ -538,15 +521,12 @@ String<0>& String<0>::operator +=(uint32 n)
 	int32 size = logicalSize + kStringAllocSize;
 	if (size > physicalSize)
 	{
-		physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-		char *newPointer = new char[physicalSize];
+		int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+		char *newPointer = new char[newPhysicalSize];
 		Text::CopyText(stringPointer, newPointer);
 
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
-
+		ReleaseString();
+		physicalSize = newPhysicalSize;
 		stringPointer = newPointer;
 	}
 
@@ -559,15 +539,12 @@ String<0>& String<0>::operator +=(int64 n)
 	int32 size = logicalSize + kStringAllocSize;
 	if (size > physicalSize)
 	{
-		physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-		char *newPointer = new char[physicalSize];
+		int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+		char *newPointer = new char[newPhysicalSize];
 		Text::CopyText(stringPointer, newPointer);
 
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
-
+		ReleaseString();
+		physicalSize = newPhysicalSize;
 		stringPointer = newPointer;
 	}
 
@@ -580,15 +557,12 @@ String<0>& String<0>::operator +=(uint64 n)
 	int32 size = logicalSize + kStringAllocSize;
 	if (size > physicalSize)
 	{
-		physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-		char *newPointer = new char[physicalSize];
+		int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+		char *newPointer = new char[newPhysicalSize];
 		Text::CopyText(stringPointer, newPointer);
 
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
-
+		ReleaseString();
+		physicalSize = newPhysicalSize;
 		stringPointer = newPointer;
 	}
 
@@ -615,24 +589,22 @@ String<0>& String<0>::SetStringLength(int32 length)
 
 			if (size > kStringLocalSize)
 			{
-				if ((size > physicalSize) || (size < physicalSize / 2))
+				if ((size > physicalSize) || (int32(GetPhysicalSize(size)) < physicalSize / 2))
 				{
-					physicalSize = GetPhysicalSize(size);
-					char *newPointer = new char[physicalSize];
+					int32 newPhysicalSize = GetPhysicalSize(size);
+					char *newPointer = new char[newPhysicalSize];
 					Text::CopyText(stringPointer, newPointer, copyLength);
 
-					if (stringPointer != localString)
-					{
-						delete[] stringPointer;
-					}
-
+					ReleaseString();
+					physicalSize = newPhysicalSize;
 					stringPointer = newPointer;
 				}
 			}
 			else if (stringPointer != localString)
 			{
 				Text::CopyText(stringPointer, localString, copyLength);
-				delete[] stringPointer;
+				ReleaseString();
+				physicalSize = kStringLocalSize;
 				stringPointer = localString;
 			}
 
@@ -659,15 +631,12 @@ String<0>& String<0>::AppendString(const char *s, int32 length)
 		int32 size = logicalSize + length;
 		if (size > physicalSize)
 		{
-			physicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
-			char *newPointer = new char[physicalSize];
+			int32 newPhysicalSize = Max(GetPhysicalSize(size), physicalSize + physicalSize / 2);
+			char *newPointer = new char[newPhysicalSize];
 			Text::CopyText(stringPointer, newPointer);
 
-			if (stringPointer != localString)
-			{
-				delete[] stringPointer;
-			}
-
+			ReleaseString();
+			physicalSize = newPhysicalSize;
 			stringPointer = newPointer;
 		}
 
@@ -784,8 +753,8 @@ String<0>& String<0>::EncodeEscapeSequences(void)
 	if (maxCharSize > 1)
 	{
 		logicalSize = encodedLength;
-		physicalSize = GetPhysicalSize(encodedLength);
-		char *encodedString = new char[physicalSize];
+		int32 newPhysicalSize = GetPhysicalSize(encodedLength);
+		char *encodedString = new char[newPhysicalSize];
 
 		byte = reinterpret_cast<uint8 *>(stringPointer);
 		uint8 *encodedByte = reinterpret_cast<uint8 *>(encodedString);
@@ -843,11 +812,8 @@ String<0>& String<0>::EncodeEscapeSequences(void)
 
 		encodedByte[0] = 0;
 
-		if (stringPointer != localString)
-		{
-			delete[] stringPointer;
-		}
-
+		ReleaseString();
+		physicalSize = newPhysicalSize;
 		stringPointer = encodedString;
 	}
 
@@ -417,6 +417,16 @@ namespace Terathon
 
 			void Resize(int32 size);
 
+			// A physical size of zero marks storage set with SetExternalString, which the string does not own.
+
+			void ReleaseString(void)
+			{
+				if ((stringPointer != localString) && (physicalSize != 0))
+				{
+					delete[] stringPointer;
+				}
+			}
+
 		public:
 
 			TERATHON_API String();
@@ -528,6 +538,12 @@ namespace Terathon
 			TERATHON_API String& SetStringLength(int32 length);
 			TERATHON_API String& AppendString(const char *s, int32 length);
 
+			// Makes the string refer to length characters at s, which must be followed by a null terminator and must
+			// outlive the string. The storage is not freed by the string, and any modification that changes the
+			// length moves the contents to storage the string owns.
+
+			TERATHON_API String& SetExternalString(char *s, int32 length);
+
 			TERATHON_API String& ConvertToLowerCase(void);
 			TERATHON_API String& ConvertToUpperCase(void);
 			TERATHON_API String& ReplaceChar(char x, char y);
@@ -0,0 +1,58 @@
+#ifndef AllocationCounter_h
+#define AllocationCounter_h
+
+#include <cstdlib>
+#include <new>
+
+// Replaces the global allocation functions to count the allocations made while countAllocations is set. The
+// replacements are definitions, so only one source file of a test program may include this header.
+
+static bool countAllocations = false;
+static int  allocationCount  = 0;
+
+void* operator new( std::size_t size )
+{
+    if ( countAllocations )
+    {
+        allocationCount++;
+    }
+
+    void* pointer = malloc( size != 0 ? size : 1 );
+    if ( !pointer )
+    {
+#ifdef __cpp_exceptions
+        throw std::bad_alloc();
+#else
+        abort();
+#endif
+    }
+
+    return pointer;
+}
+
+void* operator new[]( std::size_t size )
+{
+    return operator new( size );
+}
+
+void operator delete( void* pointer ) noexcept
+{
+    free( pointer );
+}
+
+void operator delete[]( void* pointer ) noexcept
+{
+    free( pointer );
+}
+
+void operator delete( void* pointer, std::size_t ) noexcept
+{
+    free( pointer );
+}
+
+void operator delete[]( void* pointer, std::size_t ) noexcept
+{
+    free( pointer );
+}
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef TestText_h
+#define TestText_h
+
+#include <Json4C4/C4Json.h>
+
+#include <cstring>
+
+// Copies a string into a text buffer that includes its terminating null character, as Parse expects.
+inline void MakeText( Terathon::Array<char>& text, const char* string )
+{
+    Terathon::int32 length = Terathon::int32( strlen( string ) );
+
+    text.SetArrayElementCount( length + 1 );
+    memcpy( &text[ 0 ], string, size_t( length ) + 1 );
+}
+
+#endif
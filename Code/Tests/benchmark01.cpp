@@ -0,0 +1,447 @@
+#include <Json4C4/C4Json.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace Json = C4::Json;
+
+// Measures parse throughput, and the time taken to release the parsed document, on an object-heavy document and on a
+// number-dense document held in memory. Not registered with CTest; run it by hand from the bin directory, optionally
+// passing the number of repetitions.
+
+static void AppendText( Terathon::Array<char>& text, const char* string )
+{
+    for ( ; *string != 0; string++ )
+    {
+        text.AppendArrayElement( *string );
+    }
+}
+
+static void BuildDocument( Terathon::Array<char>& text, int objectCount )
+{
+    char element[ 256 ];
+
+    AppendText( text, "{ \"items\" : [\n" );
+
+    for ( int a = 0; a != objectCount; a++ )
+    {
+        snprintf( element,
+                  sizeof( element ),
+                  "%s  { \"id\" : %d, \"name\" : \"item%d\", \"active\" : %s, \"parent\" : null, \"position\" : { \"x\" : %d.5, \"y\" : -%d.25 }, "
+                  "\"tags\" : [ \"a\", \"b\" ] }",
+                  a == 0 ? "" : ",\n",
+                  a,
+                  a,
+                  ( a & 1 ) ? "true" : "false",
+                  a,
+                  a );
+
+        AppendText( text, element );
+    }
+
+    AppendText( text, "\n] }\n" );
+    text.AppendArrayElement( '\0' );
+}
+
+static void BuildNumberDocument( Terathon::Array<char>& text, int numberCount )
+{
+    char               element[ 64 ];
+    unsigned long long state = 0x9E3779B97F4A7C15;
+
+    AppendText( text, "[\n" );
+
+    for ( int a = 0; a != numberCount; a++ )
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        double value = double( state >> 11 ) * ( 1.0 / 9007199254740992.0 ) * 2000.0 - 1000.0;
+
+        snprintf( element, sizeof( element ), "%s%.*g", a == 0 ? "" : ",\n", ( a & 1 ) ? 17 : 6 + a % 8, value );
+
+        AppendText( text, element );
+    }
+
+    AppendText( text, "\n]\n" );
+    text.AppendArrayElement( '\0' );
+}
+
+static bool ReportParseError( const Json::ParseResult& parseResult )
+{
+    if ( parseResult.status != Json::Status::kOk )
+    {
+        Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+        fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool MeasureParse( const char* name, const Terathon::Array<char>& text, int repetitionCount )
+{
+    double bestParseSeconds   = 1.0e30;
+    double bestReleaseSeconds = 1.0e30;
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        Json::StructuredData* jSd = new Json::StructuredData;
+
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = jSd->Parse( text );
+        auto middle      = std::chrono::steady_clock::now();
+
+        delete jSd;
+
+        auto end = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double parseSeconds   = std::chrono::duration<double>( middle - start ).count();
+        double releaseSeconds = std::chrono::duration<double>( end - middle ).count();
+        if ( parseSeconds < bestParseSeconds )
+        {
+            bestParseSeconds = parseSeconds;
+        }
+
+        if ( releaseSeconds < bestReleaseSeconds )
+        {
+            bestReleaseSeconds = releaseSeconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Parse %s: %.2f MB in %.3f ms, %.1f MB/s, released in %.3f ms\n", name, megabytes, bestParseSeconds * 1000.0, megabytes / bestParseSeconds,
+            bestReleaseSeconds * 1000.0 );
+
+    return true;
+}
+
+// Parses the same document repeatedly into one StructuredData, which reuses the memory of the previous parse. With
+// lazy numbers, the numbers are checked but not converted.
+static bool MeasureReparse( const char* name, const Terathon::Array<char>& text, int repetitionCount, bool lazyNumbers = false )
+{
+    Json::StructuredData jSd;
+    double               bestSeconds = 1.0e30;
+
+    jSd.SetLazyNumbers( lazyNumbers );
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = jSd.Parse( text );
+        auto end         = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double seconds = std::chrono::duration<double>( end - start ).count();
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Reparse %s: %.2f MB in %.3f ms, %.1f MB/s\n", name, megabytes, bestSeconds * 1000.0, megabytes / bestSeconds );
+
+    return true;
+}
+
+// Parses the same document repeatedly into one CompactStructuredData, which also reuses its memory.
+static bool MeasureCompactReparse( const char* name, const Terathon::Array<char>& text, int repetitionCount )
+{
+    Json::CompactStructuredData jCsd;
+    double                      bestSeconds = 1.0e30;
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = jCsd.Parse( text );
+        auto end         = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double seconds = std::chrono::duration<double>( end - start ).count();
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Reparse compact %s: %.2f MB in %.3f ms, %.1f MB/s\n", name, megabytes, bestSeconds * 1000.0, megabytes / bestSeconds );
+
+    return true;
+}
+
+// Parses the object-heavy document repeatedly with a projection that keeps only the ids of the items, skipping the
+// other members by checking them or, when skipping is trusted, by scanning for their end.
+static bool MeasureProjectedReparse( const Terathon::Array<char>& text, int repetitionCount, bool trustedSkipping )
+{
+    static constexpr Json::Key projectionKeys[] = { Json::Key( "items" ), Json::Key( "id" ) };
+
+    Json::StructuredData jSd;
+    double               bestSeconds = 1.0e30;
+
+    jSd.SetProjection( projectionKeys, 2 );
+    jSd.SetTrustedSkipping( trustedSkipping );
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = jSd.Parse( text );
+        auto end         = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double seconds = std::chrono::duration<double>( end - start ).count();
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Reparse projected objects%s: %.2f MB in %.3f ms, %.1f MB/s\n", trustedSkipping ? ", trusted" : "", megabytes, bestSeconds * 1000.0,
+            megabytes / bestSeconds );
+
+    return true;
+}
+
+// Parses only the position of the last item of the object-heavy document repeatedly, which skips every other item.
+static bool MeasureParsePaths( const Terathon::Array<char>& text, int repetitionCount )
+{
+    Json::StructuredData  jSd;
+    Json::CompiledPointer path;
+    double                bestSeconds = 1.0e30;
+
+    path.Compile( "/items/49999/position" );
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = jSd.ParsePaths( text, &path, 1 );
+        auto end         = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double seconds = std::chrono::duration<double>( end - start ).count();
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Parse path of objects: %.2f MB in %.3f ms, %.1f MB/s\n", megabytes, bestSeconds * 1000.0, megabytes / bestSeconds );
+
+    return true;
+}
+
+// Checks the syntax of the same document repeatedly, which builds no values and allocates nothing.
+static bool MeasureCheckSyntax( const char* name, const Terathon::Array<char>& text, int repetitionCount )
+{
+    double bestSeconds = 1.0e30;
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = Json::CheckSyntax( text.begin(), size_t( text.GetArrayElementCount() ) );
+        auto end         = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double seconds = std::chrono::duration<double>( end - start ).count();
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Check syntax %s: %.2f MB in %.3f ms, %.1f MB/s\n", name, megabytes, bestSeconds * 1000.0, megabytes / bestSeconds );
+
+    return true;
+}
+
+// Counts the numbers of a document, so that ParseEvents has a handler that does some work.
+struct NumberCounter : Json::EventHandler
+{
+    Terathon::int64 numberCount = 0;
+
+    bool OnNumber( const Json::Number& /*number*/ )
+    {
+        numberCount++;
+        return true;
+    }
+};
+
+// Parses the same document repeatedly into events, which builds no values.
+static bool MeasureParseEvents( const char* name, const Terathon::Array<char>& text, int repetitionCount )
+{
+    double bestSeconds = 1.0e30;
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        NumberCounter counter;
+
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = Json::ParseEvents( text, counter );
+        auto end         = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) )
+        {
+            return false;
+        }
+
+        double seconds = std::chrono::duration<double>( end - start ).count();
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Parse events %s: %.2f MB in %.3f ms, %.1f MB/s\n", name, megabytes, bestSeconds * 1000.0, megabytes / bestSeconds );
+
+    return true;
+}
+
+// The objects of the object-heavy document, without their parent, which is skipped.
+struct Position
+{
+    double x = 0.0;
+    double y = 0.0;
+};
+
+#define POSITION_PROTO "x", object.x, "y", object.y
+DEFINE_JSON4C4_FUNCTIONS( Position, POSITION_PROTO )
+
+struct Item
+{
+    Terathon::int32                     id = 0;
+    Terathon::String<>                  name;
+    bool                                active = false;
+    Position                            position;
+    Terathon::Array<Terathon::String<>> tags;
+
+#define ITEM_PROTO "id", id, "name", name, "active", active, "position", position, "tags", tags
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( ITEM_PROTO )
+};
+
+struct ItemList
+{
+    Terathon::Array<Item> items;
+
+#define ITEM_LIST_PROTO "items", items
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( ITEM_LIST_PROTO )
+};
+
+// Reads the object-heavy document into the same objects repeatedly, by parsing it into a StructuredData that is
+// deserialized and by parsing it straight into the objects.
+static bool MeasureParseInto( const Terathon::Array<char>& text, int repetitionCount )
+{
+    Json::StructuredData jSd;
+    ItemList             itemList;
+    double               bestSeconds     = 1.0e30;
+    double               bestIntoSeconds = 1.0e30;
+
+    for ( int a = 0; a != repetitionCount; a++ )
+    {
+        auto start       = std::chrono::steady_clock::now();
+        auto parseResult = jSd.Parse( text );
+
+        if ( parseResult.status == Json::Status::kOk )
+        {
+            parseResult.status = jSd.DeserializeTo( itemList );
+        }
+
+        auto middle          = std::chrono::steady_clock::now();
+        auto parseIntoResult = Json::ParseInto( text, itemList );
+        auto end             = std::chrono::steady_clock::now();
+
+        if ( ReportParseError( parseResult ) || ReportParseError( parseIntoResult ) )
+        {
+            return false;
+        }
+
+        double seconds     = std::chrono::duration<double>( middle - start ).count();
+        double intoSeconds = std::chrono::duration<double>( end - middle ).count();
+
+        if ( seconds < bestSeconds )
+        {
+            bestSeconds = seconds;
+        }
+
+        if ( intoSeconds < bestIntoSeconds )
+        {
+            bestIntoSeconds = intoSeconds;
+        }
+    }
+
+    double megabytes = double( text.GetArrayElementCount() ) / ( 1024.0 * 1024.0 );
+
+    printf( "Parse and deserialize objects: %.2f MB in %.3f ms, %.1f MB/s\n", megabytes, bestSeconds * 1000.0, megabytes / bestSeconds );
+    printf( "Parse into objects: %.2f MB in %.3f ms, %.1f MB/s\n", megabytes, bestIntoSeconds * 1000.0, megabytes / bestIntoSeconds );
+
+    return true;
+}
+
+int main( int argc, char** argv )
+{
+    int repetitionCount = ( argc > 1 ) ? atoi( argv[ 1 ] ) : 20;
+    if ( repetitionCount < 1 )
+    {
+        repetitionCount = 1;
+    }
+
+    Terathon::Array<char> objectText;
+    BuildDocument( objectText, 50000 );
+
+    Terathon::Array<char> numberText;
+    BuildNumberDocument( numberText, 200000 );
+
+    if ( !MeasureParse( "objects", objectText, repetitionCount ) || !MeasureParse( "numbers", numberText, repetitionCount ) ||
+         !MeasureReparse( "objects", objectText, repetitionCount ) || !MeasureReparse( "numbers", numberText, repetitionCount ) ||
+         !MeasureReparse( "lazy numbers", numberText, repetitionCount, true ) ||
+         !MeasureCompactReparse( "objects", objectText, repetitionCount ) || !MeasureCompactReparse( "numbers", numberText, repetitionCount ) ||
+         !MeasureProjectedReparse( objectText, repetitionCount, false ) || !MeasureProjectedReparse( objectText, repetitionCount, true ) ||
+         !MeasureParsePaths( objectText, repetitionCount ) ||
+         !MeasureCheckSyntax( "objects", objectText, repetitionCount ) || !MeasureCheckSyntax( "numbers", numberText, repetitionCount ) ||
+         !MeasureParseEvents( "objects", objectText, repetitionCount ) || !MeasureParseEvents( "numbers", numberText, repetitionCount ) ||
+         !MeasureParseInto( objectText, repetitionCount ) )
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+
+namespace Json = C4::Json;
+
+// Parses a file that is larger than 64 KB and whose size is an exact multiple of the page size, so that
+// the terminator has to come from the guard region after the mapped file contents.
+
+int main()
+{
+    const char* fileName = "Data/Test/test_file06_large.json";
+
+    constexpr long fileSize     = 1 << 20;
+    constexpr int  elementCount = 50000;
+
+    FILE* file = fopen( fileName, "wb" );
+    if ( !file )
+    {
+        fprintf( stderr, "Could not create %s", fileName );
+        return 1;
+    }
+
+    long written = fprintf( file, "{ \"values\" : [" );
+    for ( int a = 0; a != elementCount; a++ )
+    {
+        written += fprintf( file, a == 0 ? "%d" : ", %d", a );
+    }
+    written += fprintf( file, "] }" );
+
+    for ( ; written < fileSize - 1; written++ )
+    {
+        fputc( ' ', file );
+    }
+    fputc( '\n', file );
+    fclose( file );
+
+    Json::StructuredData jSd;
+
+    auto parseResult = jSd.Parse( fileName );
+
+    if ( parseResult.status != Json::Status::kOk )
+    {
+        Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+        fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+        return 1;
+    }
+
+    const Json::ObjectValue* root = jSd.GetRootJsonValue()->AsJsonObjectValue();
+    if ( !root )
+    {
+        fprintf( stderr, "Expected an object as the root value" );
+        return 1;
+    }
+
+    const Terathon::Array<Json::Value*>* values = root->FindJsonValueArray( "values" );
+    if ( !values || values->GetArrayElementCount() != elementCount )
+    {
+        fprintf( stderr, "values not parsed correctly" );
+        return 1;
+    }
+
+    const double* last = ( *values )[ elementCount - 1 ]->GetDataAsPointerTo<double>();
+    if ( !last || *last != elementCount - 1 )
+    {
+        fprintf( stderr, "Last element not parsed correctly" );
+        return 1;
+    }
+
+    parseResult = jSd.Parse( "Data/Test/file_that_does_not_exist.json" );
+    if ( parseResult.status != Json::Status::KFileOpenError )
+    {
+        fprintf( stderr, "Expected a file open error" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Writes the same document through the file, array, and callback output sinks. The callback sink uses a buffer
+// smaller than most tokens so that both the buffered and the pass-through paths are exercised.
+
+struct CallbackOutput
+{
+    Terathon::Array<char> text;
+    int                   callCount = 0;
+};
+
+static Json::Status CollectOutput( const char* data, Terathon::uint64 size, void* cookie )
+{
+    CallbackOutput* output = static_cast<CallbackOutput*>( cookie );
+
+    for ( Terathon::uint64 a = 0; a != size; a++ )
+    {
+        output->text.AppendArrayElement( data[ a ] );
+    }
+
+    output->callCount++;
+
+    return Json::Status::kOk;
+}
+
+static Json::Status FailOutput( const char*, Terathon::uint64, void* )
+{
+    return Json::Status::kFileWriteError;
+}
+
+int main()
+{
+    Json::StructuredData jSd;
+
+    auto parseResult = jSd.Parse( "Data/Test/test_file02.json" );
+
+    if ( parseResult.status != Json::Status::kOk )
+    {
+        Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+        fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+        return 1;
+    }
+
+    const char* fileName = "Data/Test/test_file07.json";
+
+    if ( jSd.Write( fileName ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write %s", fileName );
+        return 1;
+    }
+
+    char   fileText[ 4096 ];
+    FILE*  file       = fopen( fileName, "rb" );
+    size_t fileLength = file ? fread( fileText, 1, sizeof( fileText ), file ) : 0;
+
+    if ( file )
+    {
+        fclose( file );
+    }
+
+    if ( fileLength == 0 || fileLength == sizeof( fileText ) )
+    {
+        fprintf( stderr, "Unexpected length of %s", fileName );
+        return 1;
+    }
+
+    Terathon::Array<char> arrayText;
+    Json::ArrayOutputSink arraySink( arrayText );
+
+    if ( jSd.Write( arraySink ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write to an array" );
+        return 1;
+    }
+
+    if ( size_t( arrayText.GetArrayElementCount() ) != fileLength || memcmp( arrayText.begin(), fileText, fileLength ) != 0 )
+    {
+        fprintf( stderr, "Array output differs from file output" );
+        return 1;
+    }
+
+    CallbackOutput           callbackOutput;
+    Json::CallbackOutputSink callbackSink( &CollectOutput, &callbackOutput, 3 );
+
+    if ( jSd.Write( callbackSink ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write through a callback" );
+        return 1;
+    }
+
+    if ( size_t( callbackOutput.text.GetArrayElementCount() ) != fileLength || memcmp( callbackOutput.text.begin(), fileText, fileLength ) != 0 )
+    {
+        fprintf( stderr, "Callback output differs from file output" );
+        return 1;
+    }
+
+    if ( callbackOutput.callCount < 2 )
+    {
+        fprintf( stderr, "Expected several callback invocations" );
+        return 1;
+    }
+
+    Json::CallbackOutputSink failingSink( &FailOutput, nullptr, 16 );
+
+    if ( jSd.Write( failingSink ) != Json::Status::kFileWriteError )
+    {
+        fprintf( stderr, "Expected the callback error to be reported" );
+        return 1;
+    }
+
+    arrayText.AppendArrayElement( '\0' );
+
+    Json::StructuredData jSdCopy;
+
+    if ( jSdCopy.Parse( arrayText ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Array output could not be parsed" );
+        return 1;
+    }
+
+    return 0;
+}
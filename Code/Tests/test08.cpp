@@ -0,0 +1,96 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Json = C4::Json;
+
+// Serializes to memory buffers. Writing the same document into a buffer that is kept between calls must reuse its
+// storage, and strings containing characters that need escaping must survive a write and parse round trip.
+
+static const char* const jsonText = "{ \"quote\" : \"a \\\"b\\\" \\\\ c\\nd\\te\\u0001\\u007f\", \"values\" : [ 1, 2.5, true, null ] }";
+
+int main()
+{
+    Terathon::Array<char> inputText;
+    for ( const char* c = jsonText; *c != 0; c++ )
+    {
+        inputText.AppendArrayElement( *c );
+    }
+    inputText.AppendArrayElement( '\0' );
+
+    Json::StructuredData jSd;
+
+    auto parseResult = jSd.Parse( inputText );
+
+    if ( parseResult.status != Json::Status::kOk )
+    {
+        Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+        fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+        return 1;
+    }
+
+    Terathon::Array<char> buffer;
+
+    if ( jSd.WriteToBuffer( buffer ) != Json::Status::kOk || buffer.Empty() )
+    {
+        fprintf( stderr, "Failed to write to an array" );
+        return 1;
+    }
+
+    Terathon::Array<char> firstText( buffer );
+    const char*           storage = buffer.begin();
+
+    for ( int a = 0; a != 10; a++ )
+    {
+        if ( jSd.WriteToBuffer( buffer ) != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to write to an array" );
+            return 1;
+        }
+    }
+
+    if ( buffer.begin() != storage || !( buffer == firstText ) )
+    {
+        fprintf( stderr, "Array storage was not reused" );
+        return 1;
+    }
+
+    std::string string;
+    string.reserve( 4096 );
+    const char* stringStorage = string.data();
+
+    if ( jSd.WriteToBuffer( string ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write to a string" );
+        return 1;
+    }
+
+    if ( string.data() != stringStorage || string.size() != size_t( buffer.GetArrayElementCount() ) || memcmp( string.data(), buffer.begin(), string.size() ) != 0 )
+    {
+        fprintf( stderr, "String output differs from array output" );
+        return 1;
+    }
+
+    buffer.AppendArrayElement( '\0' );
+
+    Json::StructuredData jSdCopy;
+
+    if ( jSdCopy.Parse( buffer ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Written text could not be parsed" );
+        return 1;
+    }
+
+    const Terathon::String<>* quote = jSdCopy.GetRootJsonValue()->AsJsonObjectValue()->FindString( "quote" );
+    if ( !quote || *quote != "a \"b\" \\ c\nd\te\x01\x7F" )
+    {
+        fprintf( stderr, "Escaped string did not survive the round trip" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+
+namespace Json = C4::Json;
+
+// Parses arrays whose elements are separated by whitespace runs of every length up to several vector blocks, with
+// every combination of the four whitespace characters, and with the text ending at varying offsets after the last
+// token so that the terminator falls at every position within a block.
+
+static void AppendWhitespace( Terathon::Array<char>& text, int length, int seed )
+{
+    static const char whitespace[ 4 ] = { ' ', '\t', '\n', '\r' };
+
+    for ( int a = 0; a != length; a++ )
+    {
+        text.AppendArrayElement( whitespace[ ( a * 7 + seed ) & 3 ] );
+    }
+}
+
+int main()
+{
+    constexpr int maxRunLength = 100;
+
+    for ( int trailingLength = 0; trailingLength != 40; trailingLength++ )
+    {
+        Terathon::Array<char> text;
+
+        AppendWhitespace( text, trailingLength, 1 );
+        text.AppendArrayElement( '[' );
+
+        for ( int a = 0; a <= maxRunLength; a++ )
+        {
+            AppendWhitespace( text, a, a );
+
+            char number[ 16 ];
+            int  length = snprintf( number, sizeof( number ), "%d", a );
+            for ( int b = 0; b != length; b++ )
+            {
+                text.AppendArrayElement( number[ b ] );
+            }
+
+            AppendWhitespace( text, maxRunLength - a, a + 1 );
+            text.AppendArrayElement( a == maxRunLength ? ']' : ',' );
+        }
+
+        AppendWhitespace( text, trailingLength, 2 );
+        text.AppendArrayElement( '\0' );
+
+        Json::StructuredData jSd;
+
+        auto parseResult = jSd.Parse( text );
+
+        if ( parseResult.status != Json::Status::kOk )
+        {
+            Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+            fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+            return 1;
+        }
+
+        const Terathon::Array<Json::Value*>* values = jSd.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>();
+        if ( !values || values->GetArrayElementCount() != maxRunLength + 1 )
+        {
+            fprintf( stderr, "Array not parsed correctly" );
+            return 1;
+        }
+
+        for ( int a = 0; a <= maxRunLength; a++ )
+        {
+            const double* value = ( *values )[ a ]->GetDataAsPointerTo<double>();
+            if ( !value || *value != a )
+            {
+                fprintf( stderr, "Element %d not parsed correctly", a );
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses string literals of every length up to several vector blocks, with an escape sequence, a multi-byte UTF-8
+// character, or an illegal character placed at every position, and checks the decoded strings and error statuses.
+
+static Json::Status ParseString( const char* literal, Terathon::String<>& decoded )
+{
+    Terathon::Array<char> text;
+
+    for ( const char* c = "{ \"key\" : \""; *c != 0; c++ )
+    {
+        text.AppendArrayElement( *c );
+    }
+
+    for ( const char* c = literal; *c != 0; c++ )
+    {
+        text.AppendArrayElement( *c );
+    }
+
+    for ( const char* c = "\" }"; *c != 0; c++ )
+    {
+        text.AppendArrayElement( *c );
+    }
+
+    text.AppendArrayElement( '\0' );
+
+    Json::StructuredData jSd;
+
+    Json::Status status = jSd.Parse( text ).status;
+    if ( status == Json::Status::kOk )
+    {
+        decoded = *jSd.GetRootJsonValue()->AsJsonObjectValue()->FindString( "key" );
+    }
+
+    return status;
+}
+
+int main()
+{
+    constexpr int maxLength = 80;
+
+    char literal[ maxLength + 16 ];
+    char expected[ maxLength + 16 ];
+
+    for ( int length = 0; length <= maxLength; length++ )
+    {
+        for ( int position = 0; position <= length; position++ )
+        {
+            struct Case
+            {
+                const char*  insertion;
+                const char*  decoded;
+                Json::Status status;
+            };
+
+            static const Case cases[] = { { "", "", Json::Status::kOk },
+                                          { "\\n", "\n", Json::Status::kOk },
+                                          { "\\\"", "\"", Json::Status::kOk },
+                                          { "\\u00e9", "\xC3\xA9", Json::Status::kOk },
+                                          { "\xE2\x82\xAC", "\xE2\x82\xAC", Json::Status::kOk },
+                                          { "\x01", nullptr, Json::Status::kStringIllegalChar },
+                                          { "\x7F", nullptr, Json::Status::kStringIllegalChar },
+                                          { "\xC3", nullptr, Json::Status::kStringIllegalChar },
+                                          { "\\x", nullptr, Json::Status::kStringIllegalEscape } };
+
+            for ( const Case& testCase : cases )
+            {
+                int insertionLength = int( strlen( testCase.insertion ) );
+
+                memset( literal, 'a', size_t( length ) );
+                memcpy( literal + position, testCase.insertion, size_t( insertionLength ) );
+                memset( literal + position + insertionLength, 'b', size_t( length - position ) );
+                literal[ length + insertionLength ] = 0;
+
+                Terathon::String<> decoded;
+                Json::Status       status = ParseString( literal, decoded );
+
+                if ( status != testCase.status )
+                {
+                    fprintf( stderr, "Unexpected status for \"%s\"", literal );
+                    return 1;
+                }
+
+                if ( testCase.decoded )
+                {
+                    int decodedLength = int( strlen( testCase.decoded ) );
+
+                    memset( expected, 'a', size_t( length ) );
+                    memcpy( expected + position, testCase.decoded, size_t( decodedLength ) );
+                    memset( expected + position + decodedLength, 'b', size_t( length - position ) );
+                    expected[ length + decodedLength ] = 0;
+
+                    if ( strcmp( decoded, expected ) != 0 )
+                    {
+                        fprintf( stderr, "\"%s\" decoded incorrectly", literal );
+                        return 1;
+                    }
+                }
+            }
+        }
+    }
+
+    Terathon::Array<char> unterminatedText;
+    for ( const char* c = "{ \"key\" : \"unterminated"; ; c++ )
+    {
+        unterminatedText.AppendArrayElement( *c );
+        if ( *c == 0 )
+        {
+            break;
+        }
+    }
+
+    Json::StructuredData jSd;
+    if ( jSd.Parse( unterminatedText ).status != Json::Status::kPrematureNullTerminator )
+    {
+        fprintf( stderr, "Expected an unterminated string to fail" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses number literals and compares the results bit for bit with strtod: random doubles printed at every
+// precision, random digit strings of up to 40 digits with random exponents, and hand-picked halfway, subnormal,
+// overflow, and long-mantissa cases. Malformed literals must be rejected.
+
+static Json::Status ParseNumber( const char* literal, double& value )
+{
+    Terathon::int32       length = Terathon::int32( strlen( literal ) );
+    Terathon::Array<char> text;
+
+    text.SetArrayElementCount( length + 3 );
+    text[ 0 ] = '[';
+    memcpy( &text[ 1 ], literal, size_t( length ) );
+    text[ length + 1 ] = ']';
+    text[ length + 2 ] = 0;
+
+    Json::StructuredData jSd;
+
+    Json::Status status = jSd.Parse( text ).status;
+    if ( status == Json::Status::kOk )
+    {
+        const Terathon::Array<Json::Value*>* values = jSd.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>();
+        if ( !values || values->GetArrayElementCount() != 1 || !( *values )[ 0 ]->GetDataAsPointerTo<double>() )
+        {
+            return Json::Status::kFloatInvalid;
+        }
+
+        value = *( *values )[ 0 ]->GetDataAsPointerTo<double>();
+    }
+
+    return status;
+}
+
+static bool CheckNumber( const char* literal )
+{
+    double value;
+    if ( ParseNumber( literal, value ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse %s\n", literal );
+        return false;
+    }
+
+    double expected = strtod( literal, nullptr );
+    if ( memcmp( &value, &expected, sizeof( double ) ) != 0 )
+    {
+        fprintf( stderr, "%s parsed as %.17g instead of %.17g\n", literal, value, expected );
+        return false;
+    }
+
+    return true;
+}
+
+static unsigned long long randomState = 0x123456789ABCDEF1;
+
+static unsigned long long NextRandom()
+{
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 7;
+    randomState ^= randomState << 17;
+    return randomState;
+}
+
+int main()
+{
+    static const char* const cases[] = { "0",
+                                         "-0",
+                                         "0.0",
+                                         "1",
+                                         "1.",
+                                         ".5",
+                                         "0.1",
+                                         "-2.5e-3",
+                                         "123456789012345678",
+                                         "12345678901234567890",
+                                         "9007199254740992",
+                                         "9007199254740993",
+                                         "9007199254740993.000000000000000000000000001",
+                                         "9007199254740995",
+                                         "1e22",
+                                         "1e23",
+                                         "8.98846567431158e307",
+                                         "1.7976931348623157e308",
+                                         "1.7976931348623158e308",
+                                         "1.7976931348623159e308",
+                                         "1e309",
+                                         "1e99999999999",
+                                         "2.2250738585072011e-308",
+                                         "2.2250738585072014e-308",
+                                         "4.9406564584124654e-324",
+                                         "2.4703282292062327e-324",
+                                         "2.4703282292062328e-324",
+                                         "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996189898282347722858865463328355177969898199387398005390939063150356595155702263922908583924491051844359318028499365361525003193704576782492193656236698636584807570015857692699037063119282795585513329278343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378573934507363390079677619305775067401763246736009689513405355374585166611342237666786041621596804619144672918403005300575308490487653917113865916462395249126236538818796362393732804238910186723484976682350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854513962138377228261454376934125320985913276672363281249e-324",
+                                         "1e-400",
+                                         "0.000000000000000000000000000000000000000000001e-280",
+                                         "7.3177701707893310e+15",
+                                         "2.2250738585072012e-308",
+                                         "0.500000000000000166533453693773481063544750213623046875",
+                                         "3.518437208883201171875e13",
+                                         "62.5364939768271845828",
+                                         "8.10109172351e-10",
+                                         "1.00000005960464477550",
+                                         "7.7852156224546566e+305",
+                                         "1090544144181609348835077142190",
+                                         "4.4501477170144022721148195934182639518696390927032912960468522194496444440421538910330590478162701758282983178260792422137401728773891892910553144148156412434867599762821265346585071045737627442980259622449029037796981144446145705102663115100318287949527959668236039986479250965780342141637013812613333119898765515451440315261253813266652951306000184917766328660755595837392240989947807556594098101021612198814605258742579179000071675999344145086087205681577915435923018910334964869420614052182892431445797605163650903606514140377217442262561590244668525767372446430075513332450079650686719491377688478005309963967709758965844137894433796621993967316936280457084866613206797017728916080020698679408551343728867675409720757232455434770912461317493580281734466552734375e-308" };
+
+    for ( const char* literal : cases )
+    {
+        if ( !CheckNumber( literal ) )
+        {
+            return 1;
+        }
+    }
+
+    char literal[ 128 ];
+
+    for ( int a = 0; a != 100000; a++ )
+    {
+        unsigned long long bits = NextRandom();
+        double             value;
+        memcpy( &value, &bits, sizeof( double ) );
+
+        if ( value != value || value - value != 0.0 )
+        {
+            continue;
+        }
+
+        snprintf( literal, sizeof( literal ), "%.*g", 1 + a % 17, value );
+        if ( !CheckNumber( literal ) )
+        {
+            return 1;
+        }
+    }
+
+    for ( int a = 0; a != 100000; a++ )
+    {
+        int digitCount = 1 + int( NextRandom() % 40 );
+        int pointIndex = int( NextRandom() % unsigned( digitCount + 1 ) );
+        int length     = 0;
+
+        for ( int b = 0; b != digitCount; b++ )
+        {
+            if ( b == pointIndex && b != 0 )
+            {
+                literal[ length++ ] = '.';
+            }
+
+            literal[ length++ ] = char( ( b == 0 && digitCount > 1 ) ? '1' + NextRandom() % 9 : '0' + NextRandom() % 10 );
+        }
+
+        snprintf( literal + length, sizeof( literal ) - size_t( length ), "e%d", int( NextRandom() % 700 ) - 350 );
+        if ( !CheckNumber( literal ) )
+        {
+            return 1;
+        }
+    }
+
+    static const char* const invalidCases[] = { "01", "-01", ".", "-", "1e", "1e+", "1e-", "1.e", "0x1", "1.5e+-2" };
+
+    for ( const char* invalidLiteral : invalidCases )
+    {
+        double value;
+        if ( ParseNumber( invalidLiteral, value ) == Json::Status::kOk )
+        {
+            fprintf( stderr, "Expected %s to be rejected\n", invalidLiteral );
+            return 1;
+        }
+    }
+
+    // An exponent without digits ends the document where the value should be, wherever the number appears.
+    static const char* const missingExponentTexts[] = { "1e", "[1e+]", "{ \"a\" : 1e- }" };
+
+    for ( const char* missingExponentText : missingExponentTexts )
+    {
+        Terathon::int32       length = Terathon::int32( strlen( missingExponentText ) );
+        Terathon::Array<char> text;
+
+        text.SetArrayElementCount( length + 1 );
+        memcpy( &text[ 0 ], missingExponentText, size_t( length ) + 1 );
+
+        Json::StructuredData jSd;
+        if ( jSd.Parse( text ).status != Json::Status::kExpectedJsonValue ||
+             Json::CheckSyntax( text.begin(), size_t( length ) + 1 ).status != Json::Status::kExpectedJsonValue )
+        {
+            fprintf( stderr, "Expected %s to be rejected as a missing value\n", missingExponentText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Integer literals beyond 2^53 must survive parsing, deserialization, serialization, and writing without loss, and
+// deserializing into an integer type that cannot hold the value must fail instead of truncating.
+
+struct Record
+{
+    Terathon::int64  id        = 0;
+    Terathon::uint64 timestamp = 0;
+    Terathon::int32  count     = 0;
+    Terathon::uint32 flags     = 0;
+    Terathon::int64  offset    = 0;
+    double           ratio     = 0.0;
+};
+
+#define PROTO "id", object.id, "timestamp", object.timestamp, "count", object.count, "flags", object.flags, "offset", object.offset, "ratio", object.ratio
+DEFINE_JSON4C4_FUNCTIONS( Record, PROTO )
+
+static const char* const recordText = "{ \"id\" : 9007199254740993, \"timestamp\" : 18446744073709551615, \"count\" : -2147483648, "
+                                      "\"flags\" : 4294967295, \"offset\" : -9223372036854775808, \"ratio\" : 0.5 }";
+
+static bool ParseText( Json::StructuredData& jSd, const char* string )
+{
+    Terathon::int32       length = Terathon::int32( strlen( string ) );
+    Terathon::Array<char> text;
+
+    text.SetArrayElementCount( length + 1 );
+    memcpy( &text[ 0 ], string, size_t( length ) + 1 );
+
+    auto parseResult = jSd.Parse( text );
+
+    if ( parseResult.status != Json::Status::kOk )
+    {
+        Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+        fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    Json::StructuredData jSd;
+
+    if ( !ParseText( jSd, recordText ) )
+    {
+        return 1;
+    }
+
+    const Json::ObjectValue* root = jSd.GetRootJsonValue()->AsJsonObjectValue();
+
+    if ( root->FindMapElement( "id" )->GetNumberType() != Json::NumberType::kInt64 ||
+         root->FindMapElement( "timestamp" )->GetNumberType() != Json::NumberType::kUInt64 ||
+         root->FindMapElement( "ratio" )->GetNumberType() != Json::NumberType::kDouble )
+    {
+        fprintf( stderr, "Unexpected number types" );
+        return 1;
+    }
+
+    if ( *root->FindNumber( "id" ) != 9007199254740992.0 )
+    {
+        fprintf( stderr, "Integer not readable as the nearest double" );
+        return 1;
+    }
+
+    Record record;
+
+    if ( Json::Validate( jSd, record ) != Json::Status::kOk || jSd.DeserializeTo( record ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to deserialize the record" );
+        return 1;
+    }
+
+    if ( record.id != 9007199254740993 || record.timestamp != 18446744073709551615ULL || record.count != -2147483647 - 1 || record.flags != 4294967295U ||
+         record.offset != -9223372036854775807 - 1 || record.ratio != 0.5 )
+    {
+        fprintf( stderr, "Integers were not deserialized exactly" );
+        return 1;
+    }
+
+    Json::StructuredData jSdCopy;
+    Terathon::Array<char> buffer;
+
+    if ( jSdCopy.SerializeFrom( record ) != Json::Status::kOk || jSdCopy.WriteToBuffer( buffer ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to serialize the record" );
+        return 1;
+    }
+
+    buffer.AppendArrayElement( '\0' );
+
+    static const char* const writtenNumbers[] = { "9007199254740993", "18446744073709551615", "-2147483648", "4294967295", "-9223372036854775808" };
+
+    for ( const char* number : writtenNumbers )
+    {
+        if ( !strstr( buffer.begin(), number ) )
+        {
+            fprintf( stderr, "%s was not written exactly", number );
+            return 1;
+        }
+    }
+
+    struct RangeCase
+    {
+        const char*  text;
+        Json::Status int32Status;
+        Json::Status uint32Status;
+        Json::Status int64Status;
+        Json::Status uint64Status;
+    };
+
+    static const RangeCase rangeCases[] = {
+        { "[ 2147483648 ]", Json::Status::kNumberOutOfRange, Json::Status::kOk, Json::Status::kOk, Json::Status::kOk },
+        { "[ -1 ]", Json::Status::kOk, Json::Status::kNumberOutOfRange, Json::Status::kOk, Json::Status::kNumberOutOfRange },
+        { "[ 9223372036854775808 ]", Json::Status::kNumberOutOfRange, Json::Status::kNumberOutOfRange, Json::Status::kNumberOutOfRange, Json::Status::kOk },
+        { "[ 18446744073709551616 ]", Json::Status::kNumberOutOfRange, Json::Status::kNumberOutOfRange, Json::Status::kNumberOutOfRange, Json::Status::kNumberOutOfRange },
+        { "[ 1e3 ]", Json::Status::kOk, Json::Status::kOk, Json::Status::kOk, Json::Status::kOk },
+        { "[ 2.5 ]", Json::Status::kInvalidValueType, Json::Status::kInvalidValueType, Json::Status::kInvalidValueType, Json::Status::kInvalidValueType },
+        { "[ \"7\" ]", Json::Status::kInvalidValueType, Json::Status::kInvalidValueType, Json::Status::kInvalidValueType, Json::Status::kInvalidValueType }
+    };
+
+    for ( const RangeCase& rangeCase : rangeCases )
+    {
+        Json::StructuredData jSdRange;
+
+        if ( !ParseText( jSdRange, rangeCase.text ) )
+        {
+            return 1;
+        }
+
+        Terathon::Array<Terathon::int32>  int32Array;
+        Terathon::Array<Terathon::uint32> uint32Array;
+        Terathon::Array<Terathon::int64>  int64Array;
+        Terathon::Array<Terathon::uint64> uint64Array;
+
+        if ( jSdRange.DeserializeTo( int32Array ) != rangeCase.int32Status || jSdRange.DeserializeTo( uint32Array ) != rangeCase.uint32Status ||
+             jSdRange.DeserializeTo( int64Array ) != rangeCase.int64Status || jSdRange.DeserializeTo( uint64Array ) != rangeCase.uint64Status )
+        {
+            fprintf( stderr, "Unexpected status deserializing %s", rangeCase.text );
+            return 1;
+        }
+    }
+
+    // Reading an integer through the const double pointer keeps it, and the mutable pointer makes the number a
+    // double, so that a store through it is written even when it equals the integer rounded to a double.
+    Json::StructuredData jSdMutable;
+
+    if ( !ParseText( jSdMutable, "[ 9007199254740993, 9007199254740993, 7 ]" ) )
+    {
+        return 1;
+    }
+
+    Terathon::Array<Json::Value*>* mutableNumbers = jSdMutable.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>();
+    const Json::Value*             readValue      = ( *mutableNumbers )[ 0 ];
+    const double*                  readNumber     = readValue->GetDataAsPointerTo<double>();
+
+    *( *mutableNumbers )[ 1 ]->GetDataAsPointerTo<double>() = 9007199254740992.0;
+    *( *mutableNumbers )[ 2 ]->GetDataAsPointerTo<double>() = 2.5;
+
+    Terathon::Array<char> mutableBuffer;
+
+    if ( *readNumber != 9007199254740992.0 || readValue->GetNumberType() != Json::NumberType::kInt64 ||
+         ( *mutableNumbers )[ 1 ]->GetNumberType() != Json::NumberType::kDouble || ( *mutableNumbers )[ 2 ]->GetNumberType() != Json::NumberType::kDouble ||
+         jSdMutable.WriteToBuffer( mutableBuffer, 0 ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Unexpected number types after access through the double pointers" );
+        return 1;
+    }
+
+    mutableBuffer.AppendArrayElement( '\0' );
+
+    if ( !strstr( mutableBuffer.begin(), "9007199254740993,\n9007199254740992,\n2.5" ) )
+    {
+        fprintf( stderr, "Unexpected text after storing through the mutable double pointer: %s", mutableBuffer.begin() );
+        return 1;
+    }
+
+    Json::StructuredData jSdZero;
+
+    if ( !ParseText( jSdZero, "[ -0, 0 ]" ) )
+    {
+        return 1;
+    }
+
+    const Terathon::Array<Json::Value*>* zeros = jSdZero.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>();
+    if ( ( *zeros )[ 0 ]->GetNumberType() != Json::NumberType::kDouble || ( *zeros )[ 1 ]->GetNumberType() != Json::NumberType::kInt64 )
+    {
+        fprintf( stderr, "Negative zero must stay a double" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses documents into the arena of a StructuredData: a small document that must fit a user-supplied initial block,
+// a large one that spills into heap chunks and has a string bigger than a chunk, and arena trees, one with packed
+// arrays, that are modified through the non-const accessors before being written and destroyed.
+
+static bool ParseText( Json::StructuredData& jSd, const char* string )
+{
+    Terathon::int32       length = Terathon::int32( strlen( string ) );
+    Terathon::Array<char> text;
+
+    text.SetArrayElementCount( length + 1 );
+    memcpy( &text[ 0 ], string, size_t( length ) + 1 );
+
+    auto parseResult = jSd.Parse( text );
+
+    if ( parseResult.status != Json::Status::kOk )
+    {
+        Terathon::String<256> errorDescription = Json::ParseResultToString( parseResult );
+
+        fprintf( stderr, "JSON parse error: %s\n", static_cast<const char*>( errorDescription ) );
+
+        return false;
+    }
+
+    return true;
+}
+
+static bool WriteText( Json::StructuredData& jSd, Terathon::Array<char>& buffer )
+{
+    if ( jSd.WriteToBuffer( buffer, 0, ' ' ) != Json::Status::kOk )
+    {
+        return false;
+    }
+
+    buffer.AppendArrayElement( '\0' );
+
+    return true;
+}
+
+static const char* const smallText = "{ \"name\" : \"a string longer than the local buffer\", \"short\" : \"abc\", "
+                                     "\"a key longer than the local buffer\" : [ 1, 2.5, true, null, { \"nested\" : [] } ] }";
+
+int main()
+{
+    alignas( 16 ) static char initialBlock[ 4096 ];
+
+    {
+        Json::StructuredData jSd( initialBlock, sizeof( initialBlock ) );
+
+        for ( int pass = 0; pass != 3; pass++ )
+        {
+            if ( !ParseText( jSd, smallText ) )
+            {
+                return 1;
+            }
+
+            const Json::Value* root    = static_cast<const Json::StructuredData&>( jSd ).GetRootJsonValue();
+            const char*        address = reinterpret_cast<const char*>( root );
+
+            if ( address < initialBlock || address >= initialBlock + sizeof( initialBlock ) )
+            {
+                fprintf( stderr, "A small document was not parsed into the initial block" );
+                return 1;
+            }
+
+            const Json::ObjectValue* object = root->AsJsonObjectValue();
+            const Terathon::String<>* name  = object->FindString( "name" );
+            const Terathon::String<>* value = object->FindString( "short" );
+
+            if ( !name || strcmp( *name, "a string longer than the local buffer" ) != 0 || !value || strcmp( *value, "abc" ) != 0 )
+            {
+                fprintf( stderr, "Strings were not parsed correctly" );
+                return 1;
+            }
+
+            const Terathon::Array<Json::Value*>* values = object->FindJsonValueArray( "a key longer than the local buffer" );
+            if ( !values || values->GetArrayElementCount() != 5 || *( *values )[ 1 ]->GetDataAsPointerTo<double>() != 2.5 )
+            {
+                fprintf( stderr, "Array was not parsed correctly" );
+                return 1;
+            }
+        }
+
+        Terathon::Array<char> buffer;
+        if ( !WriteText( jSd, buffer ) ||
+             strcmp( buffer.begin(), "{\n\"name\" : \"a string longer than the local buffer\",\n\"short\" : \"abc\",\n"
+                                     "\"a key longer than the local buffer\" : [\n1,\n2.5,\ntrue,\nnull,\n{\n\"nested\" : [\n]\n}\n]\n}" ) != 0 )
+        {
+            fprintf( stderr, "Unexpected output:\n%s\n", buffer.begin() );
+            return 1;
+        }
+
+        if ( ParseText( jSd, "[ 1, 2, " ) )
+        {
+            fprintf( stderr, "Expected a truncated document to fail" );
+            return 1;
+        }
+    }
+
+    Terathon::Array<char> largeText;
+    for ( const char* c = "[ \""; *c != 0; c++ )
+    {
+        largeText.AppendArrayElement( *c );
+    }
+
+    for ( Terathon::int32 a = 0; a != 0x60000; a++ )
+    {
+        largeText.AppendArrayElement( char( 'a' + a % 26 ) );
+    }
+
+    for ( Terathon::int32 a = 0; a != 20000; a++ )
+    {
+        char element[ 64 ];
+        int  length = snprintf( element, sizeof( element ), "\", { \"key number %d\" : [ %d, \"value number %d\" ] }, \"", a, a, a );
+        for ( int b = 0; b != length; b++ )
+        {
+            largeText.AppendArrayElement( element[ b ] );
+        }
+    }
+
+    for ( const char* c = "\" ]"; ; c++ )
+    {
+        largeText.AppendArrayElement( *c );
+        if ( *c == 0 )
+        {
+            break;
+        }
+    }
+
+    Json::StructuredData jSd;
+
+    if ( !ParseText( jSd, largeText.begin() ) )
+    {
+        return 1;
+    }
+
+    const Terathon::Array<Json::Value*>* elements = static_cast<const Json::StructuredData&>( jSd ).GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>();
+    if ( !elements || elements->GetArrayElementCount() != 40001 || ( *elements )[ 0 ]->GetDataAsPointerTo<Terathon::String<>>()->GetStringLength() != 0x60000 )
+    {
+        fprintf( stderr, "Large document was not parsed correctly" );
+        return 1;
+    }
+
+    const Json::ObjectValue* lastObject = ( *elements )[ 39999 ]->AsJsonObjectValue();
+    if ( !lastObject || !lastObject->FindJsonValueArray( "key number 19999" ) )
+    {
+        fprintf( stderr, "Large document was not parsed correctly" );
+        return 1;
+    }
+
+    // Modifying the tree gives arena values heap-owned parts, which must be freed when the document is released.
+    if ( !ParseText( jSd, smallText ) )
+    {
+        return 1;
+    }
+
+    Json::Value* root = jSd.GetRootJsonValue();
+
+    *root->AsJsonObjectValue()->FindMapElement( "short" )->GetDataAsPointerTo<Terathon::String<>>() = "a replacement that is too long for the local buffer";
+
+    Json::Value* arrayValue = root->AsJsonObjectValue()->FindMapElement( "a key longer than the local buffer" );
+    for ( int a = 0; a != 10; a++ )
+    {
+        if ( Json::Serialize( arrayValue, "", double( a ) ) != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to append to a parsed array" );
+            return 1;
+        }
+    }
+
+    if ( Json::Serialize( root, "added", Terathon::String<>( "added value" ) ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to add to a parsed object" );
+        return 1;
+    }
+
+    Terathon::Array<char> buffer;
+    if ( !WriteText( jSd, buffer ) || !strstr( buffer.begin(), "\"short\" : \"a replacement that is too long for the local buffer\"" ) ||
+         !strstr( buffer.begin(), "null,\n{\n\"nested\" : [\n]\n},\n0,\n1," ) || !strstr( buffer.begin(), "\"added\" : \"added value\"\n}" ) )
+    {
+        fprintf( stderr, "Unexpected output after modification:\n%s\n", buffer.begin() );
+        return 1;
+    }
+
+    if ( !ParseText( jSd, smallText ) )
+    {
+        return 1;
+    }
+
+    // A packed array that grows moves its elements out of the arena, and must be freed as well.
+    Json::StructuredData jSdPacked;
+    jSdPacked.SetArrayPacking( true );
+
+    if ( !ParseText( jSdPacked, "{ \"a\" : [ 1.5, 2.5 ], \"b\" : [ true, false ] }" ) )
+    {
+        return 1;
+    }
+
+    Json::ObjectValue*       packedObject = jSdPacked.GetRootJsonValue()->AsJsonObjectValue();
+    Terathon::Array<double>* numbers      = packedObject->FindMember( "a" )->GetDataAsPointerTo<Terathon::Array<double>>();
+    Terathon::Array<bool>*   bools        = packedObject->FindMember( "b" )->GetDataAsPointerTo<Terathon::Array<bool>>();
+
+    if ( !numbers || !bools )
+    {
+        fprintf( stderr, "Arrays were not packed" );
+        return 1;
+    }
+
+    for ( int a = 0; a != 100; a++ )
+    {
+        numbers->AppendArrayElement( double( a ) );
+        bools->AppendArrayElement( ( a & 1 ) != 0 );
+    }
+
+    if ( !ParseText( jSdPacked, smallText ) )
+    {
+        return 1;
+    }
+
+    return 0;
+}
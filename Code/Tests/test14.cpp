@@ -0,0 +1,127 @@
+#include <Json4C4/C4Json.h>
+
+#include "AllocationCounter.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses and deserializes a stream of messages with the same shape into one StructuredData and one destination
+// object, and checks with a replaced global operator new that nothing is allocated once the first messages have been
+// seen. The messages contain long strings, nested objects, and arrays of objects, strings, and numbers.
+
+struct Item
+{
+    Terathon::int64         id = 0;
+    Terathon::String<>      label;
+    Terathon::Array<double> weights;
+
+#define ITEM_PROTO "id", id, "label", label, "weights", weights
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( ITEM_PROTO )
+};
+
+struct Message
+{
+    Terathon::String<>                  sender;
+    double                              timestamp = 0.0;
+    bool                                urgent    = false;
+    Terathon::Array<Terathon::String<>> tags;
+    Terathon::Array<Item>               items;
+};
+
+#define MESSAGE_PROTO "sender", object.sender, "timestamp", object.timestamp, "urgent", object.urgent, "tags", object.tags, "items", object.items
+DEFINE_JSON4C4_FUNCTIONS( Message, MESSAGE_PROTO )
+
+static void BuildMessage( Terathon::Array<char>& text, int sequence )
+{
+    char  buffer[ 0x4000 ];
+    char* cursor = buffer;
+    char* limit  = buffer + sizeof( buffer );
+
+    cursor += snprintf( cursor, size_t( limit - cursor ), "{ \"sender\" : \"sender number %04d of the stream\", \"timestamp\" : %d.25, \"urgent\" : %s, \"tags\" : [ ",
+                        sequence, 1700000000 + sequence, ( sequence & 1 ) ? "true" : "false" );
+
+    for ( int a = 0; a != 8; a++ )
+    {
+        cursor += snprintf( cursor, size_t( limit - cursor ), "%s\"tag %02d of message %04d\"", a == 0 ? "" : ", ", a, sequence );
+    }
+
+    cursor += snprintf( cursor, size_t( limit - cursor ), " ], \"items\" : [ " );
+
+    for ( int a = 0; a != 40; a++ )
+    {
+        cursor += snprintf( cursor, size_t( limit - cursor ), "%s{ \"id\" : %d, \"label\" : \"label %02d of message %04d\", \"weights\" : [ %d.5, %d, -%d.125 ] }",
+                            a == 0 ? "" : ", ", sequence * 100 + a, a, sequence, a, sequence, a );
+    }
+
+    cursor += snprintf( cursor, size_t( limit - cursor ), " ] }" );
+
+    int length = int( cursor - buffer );
+
+    text.SetArrayElementCount( length + 1 );
+    memcpy( &text[ 0 ], buffer, size_t( length ) + 1 );
+}
+
+int main()
+{
+    constexpr int messageCount = 12;
+    constexpr int warmUpCount  = 2;
+
+    Terathon::Array<char> texts[ messageCount ];
+    for ( int a = 0; a != messageCount; a++ )
+    {
+        BuildMessage( texts[ a ], a + 1000 );
+    }
+
+    Json::StructuredData jSd;
+    Message              message;
+
+    for ( int a = 0; a != messageCount; a++ )
+    {
+        countAllocations = ( a >= warmUpCount );
+
+        auto         parseResult = jSd.Parse( texts[ a ] );
+        Json::Status status      = ( parseResult.status == Json::Status::kOk ) ? jSd.DeserializeTo( message ) : parseResult.status;
+
+        countAllocations = false;
+
+        if ( status != Json::Status::kOk )
+        {
+            fprintf( stderr, "Message %d failed with status %u\n", a, static_cast<unsigned int>( status ) );
+            return 1;
+        }
+
+        char expected[ 64 ];
+        snprintf( expected, sizeof( expected ), "label 39 of message %04d", a + 1000 );
+
+        if ( message.tags.GetArrayElementCount() != 8 || message.items.GetArrayElementCount() != 40 || message.items[ 39 ].id != ( a + 1000 ) * 100 + 39 ||
+             strcmp( message.items[ 39 ].label, expected ) != 0 || message.items[ 39 ].weights[ 1 ] != a + 1000 || message.urgent != ( ( a & 1 ) != 0 ) )
+        {
+            fprintf( stderr, "Message %d was not deserialized correctly\n", a );
+            return 1;
+        }
+    }
+
+    if ( allocationCount != 0 )
+    {
+        fprintf( stderr, "%d allocations after warm-up\n", allocationCount );
+        return 1;
+    }
+
+    jSd.Reset();
+    if ( jSd.GetRootJsonValue() )
+    {
+        fprintf( stderr, "Reset did not discard the document\n" );
+        return 1;
+    }
+
+    jSd.Purge();
+    if ( jSd.Parse( texts[ 0 ] ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Parse after Purge failed\n" );
+        return 1;
+    }
+
+    return 0;
+}
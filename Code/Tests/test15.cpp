@@ -0,0 +1,252 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses the same documents into a StructuredData and a CompactStructuredData and checks that both give the same
+// written text, the same deserialized objects, the same validation results, and the same syntax errors.
+
+struct Position
+{
+    double x = 0.0;
+    double y = 0.0;
+
+#define POSITION_PROTO "x", x, "y", y
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( POSITION_PROTO )
+};
+
+struct Entry
+{
+    Terathon::int64                           id = 0;
+    Terathon::String<>                        name;
+    bool                                      active = false;
+    Json::Null                                parent;
+    Terathon::Array<Position>                 path;
+    Terathon::Array<Terathon::String<>>       tags;
+    Terathon::uint64                          checksum = 0;
+    Terathon::int32                           rank     = 0;
+    std::string                               comment;
+    std::vector<double>                       weights;
+    std::map<std::string, Terathon::String<>> labels;
+};
+
+#define ENTRY_PROTO                                                                                                                                            \
+    "id", object.id, "name", object.name, "active", object.active, "parent", object.parent, "path", object.path, "tags", object.tags, "checksum",              \
+        object.checksum, Json::optional, "rank", object.rank, "comment", object.comment, "weights", object.weights, "labels", object.labels
+DEFINE_JSON4C4_FUNCTIONS( Entry, ENTRY_PROTO )
+
+struct Document
+{
+    Terathon::Array<Entry>  entries;
+    Terathon::String<>      title;
+    Json::ObjectMap<double> scores;
+};
+
+#define DOCUMENT_PROTO "entries", object.entries, "title", object.title, Json::optional, "scores", object.scores
+DEFINE_JSON4C4_FUNCTIONS( Document, DOCUMENT_PROTO )
+
+static const char* const documentText =
+    "{ \"title\" : \"a title that does not fit in a node\", \"entries\" : [\n"
+    "  { \"id\" : 9007199254740993, \"name\" : \"short\", \"active\" : true, \"parent\" : null, \"path\" : [ { \"x\" : 1.5, \"y\" : -2.25 } ],\n"
+    "    \"tags\" : [ \"a\", \"tab\\there\", \"\\u00e9t\\u00e9\", \"exactly7\", \"\" ], \"checksum\" : 18446744073709551615, \"rank\" : -7,\n"
+    "    \"comment\" : \"quote \\\" and backslash \\\\\", \"weights\" : [ 1, 2.5, -0, 1e300 ],\n"
+    "    \"labels\" : { \"k\" : \"v\", \"long key for a label\" : \"long value for a label\" }, \"ignored\" : [ {}, [], [ [] ] ] },\n"
+    "  { \"id\" : -42, \"name\" : \"second entry name\", \"active\" : false, \"parent\" : null, \"path\" : [ { \"y\" : 0.1, \"x\" : 3 },\n"
+    "    { \"x\" : 0, \"y\" : 0 } ], \"tags\" : [], \"checksum\" : 0, \"comment\" : \"\", \"weights\" : [], \"labels\" : {} }\n"
+    "], \"scores\" : { \"math\" : 9.5, \"art\" : 7 } }";
+
+static bool SameEntry( const Entry& a, const Entry& b )
+{
+    if ( a.id != b.id || strcmp( a.name, b.name ) != 0 || a.active != b.active || a.checksum != b.checksum || a.rank != b.rank || a.comment != b.comment ||
+         a.weights != b.weights || a.labels != b.labels ||
+         a.tags.GetArrayElementCount() != b.tags.GetArrayElementCount() || a.path.GetArrayElementCount() != b.path.GetArrayElementCount() )
+    {
+        return false;
+    }
+
+    for ( Terathon::int32 t = 0; t != a.tags.GetArrayElementCount(); t++ )
+    {
+        if ( strcmp( a.tags[ t ], b.tags[ t ] ) != 0 )
+        {
+            return false;
+        }
+    }
+
+    for ( Terathon::int32 p = 0; p != a.path.GetArrayElementCount(); p++ )
+    {
+        if ( a.path[ p ].x != b.path[ p ].x || a.path[ p ].y != b.path[ p ].y )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    if ( sizeof( Json::Node ) != 16 )
+    {
+        fprintf( stderr, "Unexpected node size %u\n", unsigned( sizeof( Json::Node ) ) );
+        return 1;
+    }
+
+    Terathon::Array<char> text;
+    MakeText( text, documentText );
+
+    Json::StructuredData        jSd;
+    Json::CompactStructuredData jCsd;
+
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        Json::ParseResult parseResult        = jSd.Parse( text );
+        Json::ParseResult compactParseResult = jCsd.Parse( text );
+
+        if ( parseResult.status != Json::Status::kOk || compactParseResult.status != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to parse the document\n" );
+            return 1;
+        }
+    }
+
+    Terathon::Array<char> written;
+    Terathon::Array<char> compactWritten;
+
+    if ( jSd.WriteToBuffer( written ) != Json::Status::kOk || jCsd.WriteToBuffer( compactWritten ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write the document\n" );
+        return 1;
+    }
+
+    written.AppendArrayElement( '\0' );
+    compactWritten.AppendArrayElement( '\0' );
+
+    if ( strcmp( written.begin(), compactWritten.begin() ) != 0 )
+    {
+        fprintf( stderr, "Written documents differ:\n%s\n%s\n", written.begin(), compactWritten.begin() );
+        return 1;
+    }
+
+    Document document;
+    Document compactDocument;
+
+    if ( Json::Validate( jSd, document ) != Json::Status::kOk || Json::Validate( jCsd, compactDocument ) != Json::Status::kOk ||
+         jSd.DeserializeTo( document ) != Json::Status::kOk || jCsd.DeserializeTo( compactDocument ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to deserialize the document\n" );
+        return 1;
+    }
+
+    if ( strcmp( document.title, compactDocument.title ) != 0 || compactDocument.entries.GetArrayElementCount() != 2 ||
+         !SameEntry( document.entries[ 0 ], compactDocument.entries[ 0 ] ) || !SameEntry( document.entries[ 1 ], compactDocument.entries[ 1 ] ) ||
+         !compactDocument.scores.FindMapElement( "math" ) || compactDocument.scores.FindMapElement( "math" )->data != 9.5 ||
+         !compactDocument.scores.FindMapElement( "art" ) || compactDocument.scores.FindMapElement( "art" )->data != 7.0 )
+    {
+        fprintf( stderr, "Deserialized documents differ\n" );
+        return 1;
+    }
+
+    const Entry& first = compactDocument.entries[ 0 ];
+    if ( first.id != 9007199254740993 || first.checksum != 18446744073709551615ULL || first.rank != -7 || strcmp( first.tags[ 1 ], "tab\there" ) != 0 ||
+         strcmp( first.tags[ 2 ], "\xC3\xA9t\xC3\xA9" ) != 0 || first.comment != "quote \" and backslash \\" || first.labels.at( "k" ) != "v" )
+    {
+        fprintf( stderr, "Unexpected deserialized values\n" );
+        return 1;
+    }
+
+    const Json::Node* root  = jCsd.GetRootNode();
+    const Json::Node* entry = root->FindJsonArray( "entries" )->GetElements();
+    double            x     = 0.0;
+
+    if ( root->GetNodeType() != Json::NodeType::kObject || root->GetLength() != 3 ||
+         strcmp( root->FindString( "title" ), "a title that does not fit in a node" ) != 0 ||
+         !entry->FindJsonArray( "path" )->GetElements()->FindNumber( "x", &x ) || x != 1.5 || !entry->FindBool( "active" ) || !*entry->FindBool( "active" ) ||
+         !entry->FindJsonNull( "parent" ) || entry->FindJsonNull( "name" ) || entry->FindMember( "missing" ) || entry->FindString( "id" ) ||
+         entry->FindMember( "id" )->GetNumberType() != Json::NumberType::kInt64 ||
+         entry->FindMember( "checksum" )->GetNumberType() != Json::NumberType::kUInt64 ||
+         strcmp( entry->GetMemberKey( 0 )->GetString(), "id" ) != 0 || entry->GetMemberValue( 1 )->GetLength() != 5 )
+    {
+        fprintf( stderr, "Unexpected node accessor results\n" );
+        return 1;
+    }
+
+    struct StatusCase
+    {
+        const char*  text;
+        Json::Status status;
+    };
+
+    static const StatusCase statusCases[] = {
+        { "{ \"entries\" : [] }", Json::Status::kNameNotPresent },
+        { "{ \"entries\" : {}, \"title\" : \"\" }", Json::Status::kInvalidValueType },
+        { "{ \"entries\" : [ 1 ], \"title\" : \"\" }", Json::Status::kInvalidValueType },
+        { "{ \"entries\" : [], \"title\" : 5 }", Json::Status::kInvalidValueType },
+        { "[ \"title\" ]", Json::Status::kInvalidValueType },
+    };
+
+    for ( const StatusCase& statusCase : statusCases )
+    {
+        MakeText( text, statusCase.text );
+
+        if ( jSd.Parse( text ).status != Json::Status::kOk || jCsd.Parse( text ).status != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to parse %s\n", statusCase.text );
+            return 1;
+        }
+
+        if ( Json::Validate( jSd, document ) != statusCase.status || Json::Validate( jCsd, document ) != statusCase.status ||
+             jCsd.DeserializeTo( document ) != statusCase.status )
+        {
+            fprintf( stderr, "Unexpected status for %s\n", statusCase.text );
+            return 1;
+        }
+    }
+
+    MakeText( text, "[ 2147483648, -1 ]" );
+
+    Terathon::Array<Terathon::int32>  int32Array;
+    Terathon::Array<Terathon::uint32> uint32Array;
+    Terathon::Array<Terathon::int64>  int64Array;
+
+    if ( jCsd.Parse( text ).status != Json::Status::kOk || jCsd.DeserializeTo( int32Array ) != Json::Status::kNumberOutOfRange ||
+         jCsd.DeserializeTo( uint32Array ) != Json::Status::kNumberOutOfRange || jCsd.DeserializeTo( int64Array ) != Json::Status::kOk ||
+         int64Array[ 0 ] != 2147483648 || int64Array[ 1 ] != -1 )
+    {
+        fprintf( stderr, "Unexpected integer conversions\n" );
+        return 1;
+    }
+
+    static const char* const malformedTexts[] = {
+        "{ \"a\" : [ 1, 2, ] }",
+        "{ \"a\" : 1,\n  \"b\" 2 }",
+        "[ 01 ]",
+        "[ tru ]",
+        "{ \"a\" : \"unterminated }",
+        "{ \"a\" : [ 1 }",
+        "{ 1 : 2 }",
+        "\n\n  [ 1, 2 ] x",
+        "[ \"bad escape \\q\" ]",
+        "{ \"a\" : { \"b\" : nul } }",
+    };
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+
+        Json::ParseResult parseResult        = jSd.Parse( text );
+        Json::ParseResult compactParseResult = jCsd.Parse( text );
+
+        if ( parseResult.status == Json::Status::kOk || compactParseResult.status != parseResult.status ||
+             compactParseResult.errorLine != parseResult.errorLine || compactParseResult.errorColumn != parseResult.errorColumn || jCsd.GetRootNode() )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
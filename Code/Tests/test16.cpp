@@ -0,0 +1,160 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Checks object member storage: lookups in objects below and above the hash threshold, members added to parsed
+// objects until they cross it, duplicate keys, and that writing keeps the insertion order.
+
+static void AppendText( Terathon::Array<char>& text, const char* string )
+{
+    for ( ; *string != 0; string++ )
+    {
+        text.AppendArrayElement( *string );
+    }
+}
+
+static void BuildObject( Terathon::Array<char>& text, int memberCount )
+{
+    char member[ 64 ];
+
+    AppendText( text, "{" );
+
+    for ( int a = 0; a != memberCount; a++ )
+    {
+        // Keys of several lengths, including long ones that are stored in the arena.
+        snprintf( member, sizeof( member ), "%s \"%.*s%d\" : %d", a == 0 ? "" : ",", a % 24, "abcdefghijklmnopqrstuvwxyz", a, a );
+        AppendText( text, member );
+    }
+
+    AppendText( text, memberCount == 0 ? " \"dup\" : 1, \"dup\" : 2 }" : ", \"dup\" : 1, \"dup\" : 2 }" );
+    text.AppendArrayElement( '\0' );
+}
+
+static bool CheckMembers( const Json::ObjectValue* object, int memberCount )
+{
+    char key[ 64 ];
+
+    for ( int a = 0; a != memberCount; a++ )
+    {
+        snprintf( key, sizeof( key ), "%.*s%d", a % 24, "abcdefghijklmnopqrstuvwxyz", a );
+
+        const double* number = object->FindNumber( key );
+        if ( !number || *number != a || strcmp( object->GetMember( a ).key.name, key ) != 0 )
+        {
+            fprintf( stderr, "Member %s not found in an object of %d members\n", key, memberCount );
+            return false;
+        }
+    }
+
+    const double* duplicate = object->FindNumber( "dup" );
+    if ( !duplicate || *duplicate != 1 || object->FindMember( "missing" ) || object->FindMember( "" ) || object->FindMember( "abcdefghijklmnopqrstuvw" ) )
+    {
+        fprintf( stderr, "Unexpected lookup results in an object of %d members\n", memberCount );
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    static const int memberCounts[] = { 0, 1, 15, 16, 17, 40, 1000 };
+
+    for ( int memberCount : memberCounts )
+    {
+        Terathon::Array<char> text;
+        BuildObject( text, memberCount );
+
+        Json::StructuredData jSd;
+        if ( jSd.Parse( text ).status != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to parse an object of %d members\n", memberCount );
+            return 1;
+        }
+
+        Json::ObjectValue* object = jSd.GetRootJsonValue()->AsJsonObjectValue();
+        if ( !object || object->GetMemberCount() != memberCount + 2 || !CheckMembers( object, memberCount ) )
+        {
+            return 1;
+        }
+
+        // Added members move the storage of a parsed object to the heap and grow or create its index.
+        char key[ 64 ];
+        for ( int a = 0; a != 40; a++ )
+        {
+            snprintf( key, sizeof( key ), "added %d", a );
+            if ( Json::Serialize( object, key, double( a ) ) != Json::Status::kOk )
+            {
+                fprintf( stderr, "Failed to add a member\n" );
+                return 1;
+            }
+        }
+
+        if ( object->GetMemberCount() != memberCount + 42 || !CheckMembers( object, memberCount ) )
+        {
+            return 1;
+        }
+
+        for ( int a = 0; a != 40; a++ )
+        {
+            snprintf( key, sizeof( key ), "added %d", a );
+
+            const double* number = object->FindNumber( key );
+            if ( !number || *number != a )
+            {
+                fprintf( stderr, "Added member %s not found\n", key );
+                return 1;
+            }
+        }
+
+        // Writing keeps the insertion order, including both duplicates.
+        Terathon::Array<char> written;
+        if ( jSd.WriteToBuffer( written, 0 ) != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to write an object\n" );
+            return 1;
+        }
+
+        written.AppendArrayElement( '\0' );
+
+        const char* first  = strstr( written.begin(), "\"dup\" : 1" );
+        const char* second = strstr( written.begin(), "\"dup\" : 2" );
+        const char* added  = strstr( written.begin(), "\"added 39\" : 39" );
+
+        if ( !first || !second || !added || first > second || second > added )
+        {
+            fprintf( stderr, "Members were not written in insertion order\n" );
+            return 1;
+        }
+    }
+
+    // Serializing a map replaces the members of an object.
+    Json::StructuredData  jSd;
+    Terathon::Array<char> text;
+
+    BuildObject( text, 30 );
+    if ( jSd.Parse( text ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse an object\n" );
+        return 1;
+    }
+
+    Json::ObjectMap<double> map;
+    auto*                   element = new Json::ObjectMap<double>::ElementType;
+    element->name                   = "only";
+    element->data                   = 5.0;
+    map.InsertMapElement( element );
+
+    Json::ObjectValue* object = jSd.GetRootJsonValue()->AsJsonObjectValue();
+    if ( Json::Serialize( object, map ) != Json::Status::kOk || object->GetMemberCount() != 1 || !object->FindNumber( "only" ) ||
+         object->FindMember( "dup" ) )
+    {
+        fprintf( stderr, "Serializing a map did not replace the members\n" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <Json4C4/C4Json.h>
+
+#include "AllocationCounter.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Checks that keys are looked up without allocating: through DeserializeTo with prototype keys longer than the local
+// buffer of String<>, in objects with and without a hash index, through the Find accessors, and through Key handles
+// and (name, length) pairs.
+
+struct Sample
+{
+    double          temperatureInDegreesCelsius        = 0.0;
+    double          relativeHumidityPercentage         = 0.0;
+    double          barometricPressureInPascals        = 0.0;
+    Terathon::int64 measurementTimestampInMilliseconds = 0;
+    bool            sensorCalibrationIsValid           = false;
+
+#define SAMPLE_PROTO                                                                                                                                           \
+    "temperatureInDegreesCelsius", temperatureInDegreesCelsius, "relativeHumidityPercentage", relativeHumidityPercentage, "barometricPressureInPascals",        \
+        barometricPressureInPascals, "measurementTimestampInMilliseconds", measurementTimestampInMilliseconds, Json::optional, "sensorCalibrationIsValid",     \
+        sensorCalibrationIsValid
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( SAMPLE_PROTO )
+};
+
+struct Station
+{
+    Terathon::Array<Sample> samples;
+    double                  stationElevationInMeters = 0.0;
+};
+
+#define STATION_PROTO "samples", object.samples, "stationElevationInMeters", object.stationElevationInMeters
+DEFINE_JSON4C4_FUNCTIONS( Station, STATION_PROTO )
+
+// The first sample has only the fields of Sample, and the second has twenty more, so it is looked up through a hash
+// index.
+static const char* const stationText =
+    "{ \"stationElevationInMeters\" : 1250.5, \"samples\" : [\n"
+    "  { \"temperatureInDegreesCelsius\" : 21.5, \"relativeHumidityPercentage\" : 40, \"barometricPressureInPascals\" : 101325,\n"
+    "    \"measurementTimestampInMilliseconds\" : 1700000000000 },\n"
+    "  { \"extra00\" : 0, \"extra01\" : 1, \"extra02\" : 2, \"extra03\" : 3, \"extra04\" : 4, \"extra05\" : 5, \"extra06\" : 6, \"extra07\" : 7,\n"
+    "    \"extra08\" : 8, \"extra09\" : 9, \"extra10\" : 10, \"extra11\" : 11, \"extra12\" : 12, \"extra13\" : 13, \"extra14\" : 14,\n"
+    "    \"extra15\" : 15, \"extra16\" : 16, \"extra17\" : 17, \"extra18\" : 18, \"extra19\" : 19, \"sensorCalibrationIsValid\" : true,\n"
+    "    \"measurementTimestampInMilliseconds\" : 1700000001000, \"barometricPressureInPascals\" : 99000, \"relativeHumidityPercentage\" : 55.5,\n"
+    "    \"temperatureInDegreesCelsius\" : -3.25, \"name\" : \"second\" }\n"
+    "] }";
+
+static constexpr Json::Key elevationKey( "stationElevationInMeters" );
+static_assert( elevationKey.length == 24 && elevationKey.hash == Json::HashKey( "stationElevationInMeters", 24 ), "Keys are computed at compile time" );
+
+int main()
+{
+    Terathon::Array<char> text;
+    text.SetArrayElementCount( Terathon::int32( strlen( stationText ) ) + 1 );
+    memcpy( text.begin(), stationText, strlen( stationText ) + 1 );
+
+    if ( elevationKey.hash != Terathon::Text::Hash( "stationElevationInMeters" ) )
+    {
+        fprintf( stderr, "HashKey does not match Text::Hash\n" );
+        return 1;
+    }
+
+    Json::StructuredData        jSd;
+    Json::CompactStructuredData jCsd;
+    Station                     station;
+    Station                     compactStation;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk || jCsd.Parse( text ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the document\n" );
+        return 1;
+    }
+
+    // The first calls size the destination arrays and hash the prototype keys.
+    for ( int pass = 0; pass != 3; pass++ )
+    {
+        countAllocations = ( pass != 0 );
+
+        Json::Status status        = jSd.DeserializeTo( station );
+        Json::Status compactStatus = jCsd.DeserializeTo( compactStation );
+        Json::Status validStatus   = Json::Validate( jSd, station );
+
+        countAllocations = false;
+
+        if ( status != Json::Status::kOk || compactStatus != Json::Status::kOk || validStatus != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to deserialize the document\n" );
+            return 1;
+        }
+    }
+
+    if ( allocationCount != 0 )
+    {
+        fprintf( stderr, "%d allocations while deserializing\n", allocationCount );
+        return 1;
+    }
+
+    const Sample& sample = station.samples[ 1 ];
+    if ( station.stationElevationInMeters != 1250.5 || station.samples.GetArrayElementCount() != 2 || sample.temperatureInDegreesCelsius != -3.25 ||
+         sample.relativeHumidityPercentage != 55.5 || sample.measurementTimestampInMilliseconds != 1700000001000 || !sample.sensorCalibrationIsValid ||
+         station.samples[ 0 ].sensorCalibrationIsValid || compactStation.samples[ 1 ].barometricPressureInPascals != 99000 )
+    {
+        fprintf( stderr, "Unexpected deserialized values\n" );
+        return 1;
+    }
+
+    const Json::ObjectValue* root   = static_cast<const Json::StructuredData&>( jSd ).GetRootJsonValue()->AsJsonObjectValue();
+    const Json::ObjectValue* second = ( *root->FindJsonValueArray( Json::Key( "samples" ) ) )[ 1 ]->AsJsonObjectValue();
+
+    countAllocations = true;
+
+    const double*             elevation   = root->FindNumber( elevationKey );
+    const double*             pressure    = second->FindNumber( "barometricPressureInPascals" );
+    const double*             extra       = second->FindNumber( Json::Key( "extra19" ) );
+    const Json::Value*        sliced      = second->FindMember( "extra07 and some text that is not part of the key", 7 );
+    const Terathon::String<>* name        = second->FindString( Json::Key( "name of the sample", 4 ) );
+    const Json::Value*        truncated   = second->FindMember( "nam" );
+    const Json::Node*         compactRoot = jCsd.GetRootNode();
+    const Json::Node*         compactKey  = compactRoot->FindMember( elevationKey );
+
+    countAllocations = false;
+
+    if ( allocationCount != 0 || !elevation || *elevation != 1250.5 || !pressure || *pressure != 99000 || !extra || *extra != 19 || !sliced ||
+         *sliced->GetDataAsPointerTo<double>() != 7 || !name || strcmp( *name, "second" ) != 0 || truncated || !compactKey )
+    {
+        fprintf( stderr, "Unexpected lookup results\n" );
+        return 1;
+    }
+
+    return 0;
+}
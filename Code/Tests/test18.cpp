@@ -0,0 +1,119 @@
+#include <Json4C4/C4Json.h>
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Checks that the keys of a parsed document are stored once: members with equal keys in different objects share
+// their storage, escaped and unescaped spellings of a key are the same key, and a key found in the document is
+// matched by address. Also checks that members added to parsed objects own their keys.
+
+struct Record
+{
+    Terathon::int64    identifier = 0;
+    Terathon::String<> description;
+    double             measurementValue = 0.0;
+
+#define RECORD_PROTO "identifier", identifier, "description", description, "measurementValue", measurementValue
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( RECORD_PROTO )
+};
+
+static void AppendText( Terathon::Array<char>& text, const char* string )
+{
+    for ( ; *string != 0; string++ )
+    {
+        text.AppendArrayElement( *string );
+    }
+}
+
+static void BuildRecords( Terathon::Array<char>& text, int recordCount )
+{
+    char record[ 160 ];
+
+    text.ReserveArrayElementCount( recordCount * 128 );
+    AppendText( text, "[" );
+
+    for ( int a = 0; a != recordCount; a++ )
+    {
+        // Every third record spells a key with an escape sequence.
+        snprintf( record, sizeof( record ), "%s { \"identifier\" : %d, \"%s\" : \"record %d\", \"measurementValue\" : %d.5 }", a == 0 ? "" : ",", a,
+                  a % 3 == 0 ? "descr\\u0069ption" : "description", a, a );
+        AppendText( text, record );
+    }
+
+    AppendText( text, " ]" );
+    text.AppendArrayElement( '\0' );
+}
+
+int main()
+{
+    Json::StructuredData    jSd;
+    Terathon::Array<Record> records;
+
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        Terathon::Array<char> text;
+        int                   recordCount = ( pass == 0 ) ? 1000 : 10;
+
+        BuildRecords( text, recordCount );
+        if ( jSd.Parse( text ).status != Json::Status::kOk || jSd.DeserializeTo( records ) != Json::Status::kOk ||
+             records.GetArrayElementCount() != recordCount )
+        {
+            fprintf( stderr, "Failed to parse the records\n" );
+            return 1;
+        }
+
+        const Json::StructuredData& document       = jSd;
+        const Json::Key*            identifierKey  = document.FindKey( "identifier" );
+        const Json::Key*            descriptionKey = document.FindKey( Json::Key( "description" ) );
+
+        if ( !identifierKey || !descriptionKey || document.FindKey( "missing" ) || document.FindKey( "descr" ) )
+        {
+            fprintf( stderr, "Unexpected key table contents\n" );
+            return 1;
+        }
+
+        const Terathon::Array<Json::Value*>* elements = document.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>();
+
+        for ( int a = 0; a != recordCount; a++ )
+        {
+            const Json::ObjectValue* object = ( *elements )[ a ]->AsJsonObjectValue();
+            const Record&            record = records[ a ];
+
+            if ( object->GetMember( 0 ).key.name != identifierKey->name || object->GetMember( 1 ).key.name != descriptionKey->name ||
+                 object->FindMember( *descriptionKey ) != object->GetMember( 1 ).value || record.identifier != a || record.measurementValue != a + 0.5 )
+            {
+                fprintf( stderr, "Record %d does not share its keys\n", a );
+                return 1;
+            }
+        }
+    }
+
+    // Members added to a parsed object own their keys, and the interned keys still match the parsed members.
+    Json::ObjectValue* object = ( *jSd.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>() )[ 0 ]->AsJsonObjectValue();
+    const Json::Key*   key    = static_cast<const Json::StructuredData&>( jSd ).FindKey( "measurementValue" );
+    char               name[ 32 ];
+
+    for ( int a = 0; a != 20; a++ )
+    {
+        snprintf( name, sizeof( name ), "added member %d", a );
+        if ( Json::Serialize( object, name, double( a ) ) != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to add a member\n" );
+            return 1;
+        }
+    }
+
+    const double* measurement = object->FindNumber( *key );
+    const double* added       = object->FindNumber( "added member 19" );
+
+    if ( object->GetMemberCount() != 23 || !measurement || *measurement != 0.5 || !added || *added != 19 ||
+         object->FindMember( Json::Key( "identifier" ) ) != object->GetMember( 0 ).value )
+    {
+        fprintf( stderr, "Unexpected lookup results after adding members\n" );
+        return 1;
+    }
+
+    return 0;
+}
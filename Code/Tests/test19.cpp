@@ -0,0 +1,213 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses the same documents with and without array packing and checks which arrays are packed, that both give the
+// same deserialized objects, validation results, written text, and syntax errors, and how packed numbers convert to
+// integers.
+
+struct Mesh
+{
+    Terathon::Array<double>          positions;
+    std::vector<double>              normals;
+    Terathon::Array<bool>            flags;
+    std::vector<bool>                visible;
+    Terathon::Array<Terathon::int32> indices;
+    std::vector<Terathon::uint64>    identifiers;
+    Terathon::Array<Terathon::int64> mixed;
+};
+
+#define MESH_PROTO                                                                                                                                             \
+    "positions", object.positions, "normals", object.normals, "flags", object.flags, "visible", object.visible, "indices", object.indices, "identifiers",   \
+        object.identifiers, "mixed", object.mixed
+DEFINE_JSON4C4_FUNCTIONS( Mesh, MESH_PROTO )
+
+static const char* const meshText = "{ \"positions\" : [ 0.5, -1.25, 3e2, 1e-3 ], \"normals\" : [ 0.0, 1.0, -0.0 ], \"flags\" : [ true, false, true ],\n"
+                                    "  \"visible\" : [ false, true ], \"indices\" : [ 0, 1, 2, -2147483648 ], \"identifiers\" : [ 9007199254740992, 7 ],\n"
+                                    "  \"mixed\" : [ 1, 9007199254740993, -3 ], \"nested\" : [ [ 1, 2 ], [ true ], [], [ null ] ], \"empty\" : [],\n"
+                                    "  \"numbersThenBool\" : [ 1, 2, true ], \"boolsThenNumber\" : [ true, 0 ] }";
+
+static bool SameMesh( const Mesh& a, const Mesh& b )
+{
+    if ( a.positions.GetArrayElementCount() != b.positions.GetArrayElementCount() || a.flags.GetArrayElementCount() != b.flags.GetArrayElementCount() ||
+         a.indices.GetArrayElementCount() != b.indices.GetArrayElementCount() || a.mixed.GetArrayElementCount() != b.mixed.GetArrayElementCount() ||
+         a.normals != b.normals || a.visible != b.visible || a.identifiers != b.identifiers )
+    {
+        return false;
+    }
+
+    for ( Terathon::int32 i = 0; i != a.positions.GetArrayElementCount(); i++ )
+    {
+        if ( a.positions[ i ] != b.positions[ i ] )
+        {
+            return false;
+        }
+    }
+
+    for ( Terathon::int32 i = 0; i != a.flags.GetArrayElementCount(); i++ )
+    {
+        if ( a.flags[ i ] != b.flags[ i ] )
+        {
+            return false;
+        }
+    }
+
+    for ( Terathon::int32 i = 0; i != a.indices.GetArrayElementCount(); i++ )
+    {
+        if ( a.indices[ i ] != b.indices[ i ] )
+        {
+            return false;
+        }
+    }
+
+    for ( Terathon::int32 i = 0; i != a.mixed.GetArrayElementCount(); i++ )
+    {
+        if ( a.mixed[ i ] != b.mixed[ i ] )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool IsPacked( const Json::ObjectValue* object, const char* name )
+{
+    const Json::Value* value = object->FindMember( name );
+
+    return value && !value->GetDataAsPointerTo<Terathon::Array<Json::Value*>>() &&
+           ( value->GetDataAsPointerTo<Terathon::Array<double>>() || value->GetDataAsPointerTo<Terathon::Array<bool>>() );
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    MakeText( text, meshText );
+
+    Json::StructuredData jSd;
+    Json::StructuredData packedJSd;
+
+    packedJSd.SetArrayPacking( true );
+
+    if ( jSd.GetArrayPacking() || !packedJSd.GetArrayPacking() || jSd.Parse( text ).status != Json::Status::kOk ||
+         packedJSd.Parse( text ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the mesh\n" );
+        return 1;
+    }
+
+    const Json::ObjectValue* root   = static_cast<const Json::StructuredData&>( packedJSd ).GetRootJsonValue()->AsJsonObjectValue();
+    const Json::ObjectValue* plain  = static_cast<const Json::StructuredData&>( jSd ).GetRootJsonValue()->AsJsonObjectValue();
+    const auto*              nested = root->FindJsonValueArray( "nested" );
+
+    // Arrays with an integer beyond 2^53, with elements of both kinds, or without elements are not packed.
+    if ( !IsPacked( root, "positions" ) || !IsPacked( root, "normals" ) || !IsPacked( root, "flags" ) || !IsPacked( root, "indices" ) ||
+         !IsPacked( root, "identifiers" ) || IsPacked( root, "mixed" ) || IsPacked( root, "numbersThenBool" ) || IsPacked( root, "boolsThenNumber" ) ||
+         IsPacked( root, "empty" ) || IsPacked( plain, "positions" ) || !nested || !( *nested )[ 0 ]->GetDataAsPointerTo<Terathon::Array<double>>() ||
+         !( *nested )[ 1 ]->GetDataAsPointerTo<Terathon::Array<bool>>() || !( *nested )[ 3 ]->GetDataAsPointerTo<Terathon::Array<Json::Value*>>() )
+    {
+        fprintf( stderr, "Unexpected packed arrays\n" );
+        return 1;
+    }
+
+    Mesh mesh;
+    Mesh packedMesh;
+
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        if ( Json::Validate( jSd, mesh ) != Json::Status::kOk || Json::Validate( packedJSd, packedMesh ) != Json::Status::kOk ||
+             jSd.DeserializeTo( mesh ) != Json::Status::kOk || packedJSd.DeserializeTo( packedMesh ) != Json::Status::kOk || !SameMesh( mesh, packedMesh ) )
+        {
+            fprintf( stderr, "Packed arrays were not deserialized correctly\n" );
+            return 1;
+        }
+    }
+
+    if ( packedMesh.positions[ 2 ] != 300.0 || packedMesh.indices[ 3 ] != -2147483647 - 1 || packedMesh.identifiers[ 0 ] != 9007199254740992ULL ||
+         packedMesh.mixed[ 1 ] != 9007199254740993 || !packedMesh.visible[ 1 ] || packedMesh.visible[ 0 ] )
+    {
+        fprintf( stderr, "Unexpected deserialized values\n" );
+        return 1;
+    }
+
+    Terathon::Array<char> written;
+    Terathon::Array<char> packedWritten;
+
+    if ( jSd.WriteToBuffer( written ) != Json::Status::kOk || packedJSd.WriteToBuffer( packedWritten ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write the mesh\n" );
+        return 1;
+    }
+
+    written.AppendArrayElement( '\0' );
+    packedWritten.AppendArrayElement( '\0' );
+
+    if ( strcmp( written.begin(), packedWritten.begin() ) != 0 )
+    {
+        fprintf( stderr, "Written documents differ:\n%s\n%s\n", written.begin(), packedWritten.begin() );
+        return 1;
+    }
+
+    // Packed numbers convert to integers as numbers do.
+    struct ConversionCase
+    {
+        const char*  text;
+        Json::Status status;
+    };
+
+    static const ConversionCase conversionCases[] = {
+        { "[ 1, 2.5 ]", Json::Status::kInvalidValueType },
+        { "[ 1, 2147483648 ]", Json::Status::kNumberOutOfRange },
+        { "[ 1.0, -7 ]", Json::Status::kOk },
+        { "[ true ]", Json::Status::kInvalidValueType },
+    };
+
+    for ( const ConversionCase& conversionCase : conversionCases )
+    {
+        Terathon::Array<Terathon::int32> integers;
+        std::vector<Terathon::int32>     integerVector;
+
+        MakeText( text, conversionCase.text );
+
+        if ( jSd.Parse( text ).status != Json::Status::kOk || packedJSd.Parse( text ).status != Json::Status::kOk ||
+             Json::Validate( packedJSd, integers ) != conversionCase.status || packedJSd.DeserializeTo( integers ) != conversionCase.status ||
+             packedJSd.DeserializeTo( integerVector ) != conversionCase.status || jSd.DeserializeTo( integers ) != conversionCase.status )
+        {
+            fprintf( stderr, "Unexpected conversion status for %s\n", conversionCase.text );
+            return 1;
+        }
+    }
+
+    Terathon::Array<Terathon::String<>> strings;
+    if ( packedJSd.DeserializeTo( strings ) != Json::Status::kInvalidValueType || Json::Validate( packedJSd, strings ) != Json::Status::kInvalidValueType )
+    {
+        fprintf( stderr, "Packed arrays must not deserialize into strings\n" );
+        return 1;
+    }
+
+    static const char* const malformedTexts[] = {
+        "[ 1, 2, ]", "[ 1 2 ]", "[ 1,\n  01 ]", "[ true, tru ]", "[ 1, - ]", "{ \"a\" : [ false, true } ", "[ 1, 2 ] x", "[ 1, 2",
+    };
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+
+        Json::ParseResult parseResult       = jSd.Parse( text );
+        Json::ParseResult packedParseResult = packedJSd.Parse( text );
+
+        if ( parseResult.status == Json::Status::kOk || packedParseResult.status != parseResult.status ||
+             packedParseResult.errorLine != parseResult.errorLine || packedParseResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
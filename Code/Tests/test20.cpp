@@ -0,0 +1,170 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses compact documents that borrow their strings from the text and checks which strings refer to the text, that
+// views are deserialized without copying, and that the documents read, deserialize, and write as documents that copy
+// their strings. Also checks that a document parsed from a file keeps the file loaded.
+
+struct Label
+{
+    Json::StringView                       name;
+    std::string_view                       caption;
+    Terathon::String<>                     copiedName;
+    std::string                            copiedCaption;
+    Terathon::Array<Json::StringView>      tags;
+    std::map<std::string, Terathon::int32> counts;
+};
+
+#define LABEL_PROTO                                                                                                                                            \
+    "name", object.name, "caption", object.caption, "name", object.copiedName, "caption", object.copiedCaption, "tags", object.tags, "counts", object.counts
+DEFINE_JSON4C4_FUNCTIONS( Label, LABEL_PROTO )
+
+static const char* const labelText = "{ \"name\" : \"a name that is not short\", \"caption\" : \"line one\\nline two\",\n"
+                                     "  \"tags\" : [ \"short\", \"a tag that is borrowed\", \"an escaped \\u0074ag\" ],\n"
+                                     "  \"counts\" : { \"a key that is borrowed\" : 1, \"key\" : 2 } }";
+
+static bool IsInText( const Terathon::Array<char>& text, const char* string )
+{
+    return string >= text.begin() && string < text.end();
+}
+
+static bool Equals( Json::StringView view, const char* string )
+{
+    return view.length == Terathon::int32( strlen( string ) ) && memcmp( view.text, string, size_t( view.length ) ) == 0;
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    MakeText( text, labelText );
+
+    Json::CompactStructuredData jCsd;
+    Json::CompactStructuredData borrowedJCsd;
+
+    borrowedJCsd.SetStringBorrowing( true );
+
+    if ( jCsd.GetStringBorrowing() || !borrowedJCsd.GetStringBorrowing() || jCsd.Parse( text ).status != Json::Status::kOk ||
+         borrowedJCsd.Parse( text ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the label\n" );
+        return 1;
+    }
+
+    // Long strings without escape sequences refer to the text, and short or escaped strings are decoded.
+    const Json::Node* root    = borrowedJCsd.GetRootNode();
+    const Json::Node* tags    = root->FindJsonArray( "tags" );
+    const Json::Node* counts  = root->FindJsonObject( "counts" );
+    const Json::Node* copied  = jCsd.GetRootNode()->FindMember( "name" );
+    Json::StringView  caption = root->FindMember( "caption" )->GetStringView();
+
+    if ( !IsInText( text, root->FindMember( "name" )->GetString() ) || IsInText( text, copied->GetString() ) || IsInText( text, caption.text ) ||
+         !Equals( caption, "line one\nline two" ) || IsInText( text, tags->GetElements()[ 0 ].GetString() ) ||
+         !IsInText( text, tags->GetElements()[ 1 ].GetString() ) || IsInText( text, tags->GetElements()[ 2 ].GetString() ) ||
+         !IsInText( text, counts->GetMemberKey( 0 )->GetString() ) || !counts->FindMember( "a key that is borrowed" ) ||
+         root->FindMember( "counts" )->GetStringView().text != nullptr )
+    {
+        fprintf( stderr, "Unexpected borrowed strings\n" );
+        return 1;
+    }
+
+    Label label;
+    Label borrowedLabel;
+
+    if ( Json::Validate( borrowedJCsd, borrowedLabel ) != Json::Status::kOk || borrowedJCsd.DeserializeTo( borrowedLabel ) != Json::Status::kOk ||
+         jCsd.DeserializeTo( label ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to deserialize the label\n" );
+        return 1;
+    }
+
+    if ( !IsInText( text, borrowedLabel.name.text ) || !Equals( borrowedLabel.name, "a name that is not short" ) ||
+         borrowedLabel.caption != "line one\nline two" || strcmp( borrowedLabel.copiedName, "a name that is not short" ) != 0 ||
+         borrowedLabel.copiedCaption != label.copiedCaption || borrowedLabel.tags.GetArrayElementCount() != 3 ||
+         !Equals( borrowedLabel.tags[ 1 ], "a tag that is borrowed" ) || !Equals( borrowedLabel.tags[ 2 ], "an escaped tag" ) ||
+         borrowedLabel.counts != label.counts || borrowedLabel.counts[ "a key that is borrowed" ] != 1 )
+    {
+        fprintf( stderr, "Unexpected deserialized label\n" );
+        return 1;
+    }
+
+    Terathon::Array<char> written;
+    Terathon::Array<char> borrowedWritten;
+
+    if ( jCsd.WriteToBuffer( written ) != Json::Status::kOk || borrowedJCsd.WriteToBuffer( borrowedWritten ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write the label\n" );
+        return 1;
+    }
+
+    written.AppendArrayElement( '\0' );
+    borrowedWritten.AppendArrayElement( '\0' );
+
+    if ( strcmp( written.begin(), borrowedWritten.begin() ) != 0 )
+    {
+        fprintf( stderr, "Written documents differ:\n%s\n%s\n", written.begin(), borrowedWritten.begin() );
+        return 1;
+    }
+
+    // Views deserialized from a StructuredData refer to its strings, and views are serialized as strings.
+    Json::StructuredData jSd;
+    Label                structuredLabel;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk || jSd.DeserializeTo( structuredLabel ) != Json::Status::kOk ||
+         !Equals( structuredLabel.name, "a name that is not short" ) || IsInText( text, structuredLabel.name.text ) ||
+         structuredLabel.caption != "line one\nline two" )
+    {
+        fprintf( stderr, "Unexpected views of a StructuredData\n" );
+        return 1;
+    }
+
+    Json::StructuredData serialized;
+    Label                serializedLabel;
+
+    if ( serialized.SerializeFrom( borrowedLabel ) != Json::Status::kOk || serialized.DeserializeTo( serializedLabel ) != Json::Status::kOk ||
+         !Equals( serializedLabel.tags[ 2 ], "an escaped tag" ) || serializedLabel.caption != borrowedLabel.caption ||
+         serializedLabel.counts != borrowedLabel.counts )
+    {
+        fprintf( stderr, "Failed to serialize views\n" );
+        return 1;
+    }
+
+    // A document parsed from a file refers to the file until the next parse.
+    const char* fileName = "Data/Test/test_file20_borrowed.json";
+    FILE*       file     = fopen( fileName, "wb" );
+
+    if ( !file )
+    {
+        fprintf( stderr, "Could not create %s\n", fileName );
+        return 1;
+    }
+
+    fputs( labelText, file );
+    fclose( file );
+
+    Label fileLabel;
+
+    if ( borrowedJCsd.Parse( fileName ).status != Json::Status::kOk || borrowedJCsd.DeserializeTo( fileLabel ) != Json::Status::kOk ||
+         !Equals( fileLabel.name, "a name that is not short" ) || !Equals( fileLabel.tags[ 1 ], "a tag that is borrowed" ) )
+    {
+        fprintf( stderr, "Failed to parse the file\n" );
+        return 1;
+    }
+
+    remove( fileName );
+
+    MakeText( text, "[ \"another string that is long enough\" ]" );
+
+    if ( borrowedJCsd.Parse( text ).status != Json::Status::kOk || !IsInText( text, borrowedJCsd.GetRootNode()->GetElements()[ 0 ].GetString() ) )
+    {
+        fprintf( stderr, "Failed to parse after the file\n" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+#include <Json4C4/C4Json.h>
+
+#include "AllocationCounter.h"
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses documents in situ and checks that escape sequences are decoded into the buffer, that strings refer to
+// it, that parsing needs no memory for strings, and that the documents read, deserialize, and write as documents
+// parsed from a copy of the text. Also checks that syntax errors are reported as for Parse.
+
+struct Message
+{
+    Terathon::String<>                  title;
+    Terathon::String<>                  body;
+    Terathon::Array<Terathon::String<>> lines;
+    std::string                         footer;
+
+#define MESSAGE_PROTO "title", title, "message body", body, "lines", lines, "footer", footer
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( MESSAGE_PROTO )
+};
+
+static const char* const messageText = "{ \"title\" : \"caf\\u00e9\", \"message \\\"body\\\"\" : \"first line\\nsecond line\\tand a tab \\\\ \\/\",\n"
+                                       "  \"message body\" : \"a body that is long enough to be stored outside the string\",\n"
+                                       "  \"lines\" : [ \"\\u20ac 5\", \"plain and longer than fifteen\", \"\", \"\\\"quoted\\\" and longer than fifteen\" ],\n"
+                                       "  \"footer\" : \"\\u0041\\u0042\\u0043\" }";
+
+static bool IsInText( const Terathon::Array<char>& text, const char* string )
+{
+    return string >= text.begin() && string < text.end();
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    Terathon::Array<char> buffer;
+
+    MakeText( text, messageText );
+    MakeText( buffer, messageText );
+
+    Json::StructuredData jSd;
+    Json::StructuredData inSituJSd;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk || inSituJSd.ParseInSitu( buffer ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the message\n" );
+        return 1;
+    }
+
+    const Json::ObjectValue*             root  = static_cast<const Json::StructuredData&>( inSituJSd ).GetRootJsonValue()->AsJsonObjectValue();
+    const Terathon::Array<Json::Value*>* lines = root->FindJsonValueArray( "lines" );
+    const Terathon::String<>*            body  = root->FindString( "message body" );
+    const Terathon::String<>*            text0 = root->FindString( "message \"body\"" );
+
+    if ( !body || !text0 || !lines || !IsInText( buffer, *body ) || !IsInText( buffer, *text0 ) || !IsInText( buffer, *root->FindString( "title" ) ) ||
+         strcmp( *text0, "first line\nsecond line\tand a tab \\ /" ) != 0 || strcmp( *root->FindString( "title" ), "caf\xC3\xA9" ) != 0 ||
+         strcmp( *( *lines )[ 0 ]->GetDataAsPointerTo<Terathon::String<>>(), "\xE2\x82\xAC 5" ) != 0 ||
+         strcmp( *( *lines )[ 3 ]->GetDataAsPointerTo<Terathon::String<>>(), "\"quoted\" and longer than fifteen" ) != 0 )
+    {
+        fprintf( stderr, "Unexpected strings decoded in place\n" );
+        return 1;
+    }
+
+    Message message;
+    Message inSituMessage;
+
+    if ( jSd.DeserializeTo( message ) != Json::Status::kOk || inSituJSd.DeserializeTo( inSituMessage ) != Json::Status::kOk ||
+         strcmp( message.body, inSituMessage.body ) != 0 || strcmp( message.title, inSituMessage.title ) != 0 ||
+         message.lines.GetArrayElementCount() != 4 || inSituMessage.lines.GetArrayElementCount() != 4 || message.footer != "ABC" ||
+         inSituMessage.footer != "ABC" )
+    {
+        fprintf( stderr, "Unexpected deserialized message\n" );
+        return 1;
+    }
+
+    for ( Terathon::int32 a = 0; a != 4; a++ )
+    {
+        if ( strcmp( message.lines[ a ], inSituMessage.lines[ a ] ) != 0 )
+        {
+            fprintf( stderr, "Line %d differs\n", int( a ) );
+            return 1;
+        }
+    }
+
+    Terathon::Array<char> written;
+    Terathon::Array<char> inSituWritten;
+
+    if ( jSd.WriteToBuffer( written ) != Json::Status::kOk || inSituJSd.WriteToBuffer( inSituWritten ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to write the message\n" );
+        return 1;
+    }
+
+    written.AppendArrayElement( '\0' );
+    inSituWritten.AppendArrayElement( '\0' );
+
+    if ( strcmp( written.begin(), inSituWritten.begin() ) != 0 )
+    {
+        fprintf( stderr, "Written documents differ:\n%s\n%s\n", written.begin(), inSituWritten.begin() );
+        return 1;
+    }
+
+    // Many long escaped strings fit in a block that only has room for their values when they are parsed in situ.
+    Terathon::Array<char> manyStrings;
+    char                  element[ 128 ];
+
+    manyStrings.ReserveArrayElementCount( 32768 );
+    manyStrings.AppendArrayElement( '[' );
+
+    for ( int a = 0; a != 300; a++ )
+    {
+        int length =
+            snprintf( element, sizeof( element ), "%s \"string number %03d with an \\\"escape\\\" and enough text to be long\"", a == 0 ? "" : ",", a );
+
+        for ( int b = 0; b != length; b++ )
+        {
+            manyStrings.AppendArrayElement( element[ b ] );
+        }
+    }
+
+    manyStrings.AppendArrayElement( ']' );
+    manyStrings.AppendArrayElement( '\0' );
+
+    // The first parse sizes the parse stack. The copying parse comes last, so it cannot reuse chunks it allocated.
+    alignas( 16 ) static char block[ 32768 ];
+    Json::StructuredData      blockJSd( block, sizeof( block ) );
+
+    for ( int pass = 0; pass != 3; pass++ )
+    {
+        Terathon::Array<char> manyStringsBuffer;
+        MakeText( manyStringsBuffer, manyStrings.begin() );
+
+        allocationCount  = 0;
+        countAllocations = true;
+
+        Json::ParseResult parseResult = ( pass == 2 ) ? blockJSd.Parse( manyStringsBuffer ) : blockJSd.ParseInSitu( manyStringsBuffer );
+
+        countAllocations = false;
+
+        if ( parseResult.status != Json::Status::kOk || ( pass == 1 && allocationCount != 0 ) || ( pass == 2 && allocationCount == 0 ) )
+        {
+            fprintf( stderr, "Unexpected allocation count %d in pass %d\n", allocationCount, pass );
+            return 1;
+        }
+
+        const Json::Value* last = ( *blockJSd.GetRootJsonValue()->GetDataAsPointerTo<Terathon::Array<Json::Value*>>() )[ 299 ];
+        if ( strcmp( *last->GetDataAsPointerTo<Terathon::String<>>(), "string number 299 with an \"escape\" and enough text to be long" ) != 0 )
+        {
+            fprintf( stderr, "Unexpected string in pass %d\n", pass );
+            return 1;
+        }
+    }
+
+    static const char* const malformedTexts[] = {
+        "{ \"a\\tb\" : \"x\\ny\", \"c\" : [ 1, 2, ] }",
+        "[ \"an escaped \\\"string\\\" before the error\" \"missing comma\" ]",
+        "[ \"bad \\q escape\" ]",
+        "{ \"key\" : \"value\" } x",
+    };
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+        MakeText( buffer, malformedText );
+
+        Json::ParseResult parseResult       = jSd.Parse( text );
+        Json::ParseResult inSituParseResult = inSituJSd.ParseInSitu( buffer );
+
+        if ( parseResult.status == Json::Status::kOk || inSituParseResult.status != parseResult.status ||
+             inSituParseResult.errorLine != parseResult.errorLine || inSituParseResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses the same documents with and without lazy numbers and checks that both give the same number types, integer
+// conversions, deserialized objects, validation results, written text, and syntax errors, also when lazy numbers
+// are combined with array packing and with parsing in situ.
+
+struct Reading
+{
+    double                           value;
+    Terathon::uint32                 scale;
+    Terathon::int64                  smallest;
+    Terathon::uint64                 largest;
+    Terathon::int32                  count;
+    Terathon::Array<double>          samples;
+    Terathon::Array<Terathon::int64> offsets;
+};
+
+#define READING_PROTO                                                                                                                                          \
+    "value", object.value, "scale", object.scale, "smallest", object.smallest, "largest", object.largest, "count", object.count, "samples", object.samples,    \
+        "offsets", object.offsets
+DEFINE_JSON4C4_FUNCTIONS( Reading, READING_PROTO )
+
+static const char* const readingText = "{ \"value\" : -1.5e-3, \"scale\" : 4e0, \"smallest\" : -9223372036854775808, \"largest\" : 18446744073709551615,\n"
+                                       "  \"count\" : 12, \"samples\" : [ 0, 1.0, -2.5, 1e300, 5e-324 ], \"offsets\" : [ 1, 9007199254740993, -3 ],\n"
+                                       "  \"big\" : 1e999999, \"fraction\" : 0.1, \"zero\" : -0 }";
+
+static bool SameReading( const Reading& a, const Reading& b )
+{
+    if ( a.value != b.value || a.scale != b.scale || a.smallest != b.smallest || a.largest != b.largest || a.count != b.count ||
+         a.samples.GetArrayElementCount() != b.samples.GetArrayElementCount() || a.offsets.GetArrayElementCount() != b.offsets.GetArrayElementCount() )
+    {
+        return false;
+    }
+
+    for ( Terathon::int32 i = 0; i != a.samples.GetArrayElementCount(); i++ )
+    {
+        if ( a.samples[ i ] != b.samples[ i ] )
+        {
+            return false;
+        }
+    }
+
+    for ( Terathon::int32 i = 0; i != a.offsets.GetArrayElementCount(); i++ )
+    {
+        if ( a.offsets[ i ] != b.offsets[ i ] )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool SameWrittenText( Json::StructuredData& a, Json::StructuredData& b )
+{
+    Terathon::Array<char> writtenA;
+    Terathon::Array<char> writtenB;
+
+    if ( a.WriteToBuffer( writtenA ) != Json::Status::kOk || b.WriteToBuffer( writtenB ) != Json::Status::kOk )
+    {
+        return false;
+    }
+
+    writtenA.AppendArrayElement( '\0' );
+    writtenB.AppendArrayElement( '\0' );
+
+    if ( strcmp( writtenA.begin(), writtenB.begin() ) != 0 )
+    {
+        fprintf( stderr, "Written documents differ:\n%s\n%s\n", writtenA.begin(), writtenB.begin() );
+        return false;
+    }
+
+    return true;
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    Terathon::Array<char> buffer;
+
+    MakeText( text, readingText );
+    MakeText( buffer, readingText );
+
+    Json::StructuredData jSd;
+    Json::StructuredData lazyJSd;
+    Json::StructuredData packedLazyJSd;
+    Json::StructuredData inSituLazyJSd;
+
+    lazyJSd.SetLazyNumbers( true );
+    packedLazyJSd.SetLazyNumbers( true );
+    packedLazyJSd.SetArrayPacking( true );
+    inSituLazyJSd.SetLazyNumbers( true );
+
+    if ( jSd.GetLazyNumbers() || !lazyJSd.GetLazyNumbers() || jSd.Parse( text ).status != Json::Status::kOk ||
+         lazyJSd.Parse( text ).status != Json::Status::kOk || packedLazyJSd.Parse( text ).status != Json::Status::kOk ||
+         inSituLazyJSd.ParseInSitu( buffer ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the reading\n" );
+        return 1;
+    }
+
+    // Number types and values are those of eagerly converted numbers, whichever accessor reads them first.
+    static const char* const memberNames[] = { "value", "scale", "smallest", "largest", "count", "big", "fraction", "zero" };
+
+    const Json::ObjectValue* root   = static_cast<const Json::StructuredData&>( jSd ).GetRootJsonValue()->AsJsonObjectValue();
+    const Json::ObjectValue* lazy   = static_cast<const Json::StructuredData&>( lazyJSd ).GetRootJsonValue()->AsJsonObjectValue();
+    const Json::ObjectValue* inSitu = static_cast<const Json::StructuredData&>( inSituLazyJSd ).GetRootJsonValue()->AsJsonObjectValue();
+
+    for ( const char* memberName : memberNames )
+    {
+        const Json::Value* value       = root->FindMember( memberName );
+        const Json::Value* lazyValue   = lazy->FindMember( memberName );
+        const Json::Value* inSituValue = inSitu->FindMember( memberName );
+        const double*      number      = root->FindNumber( memberName );
+        const double*      lazyNumber  = inSitu->FindNumber( memberName );
+
+        if ( !value || !lazyValue || !inSituValue || !number || !lazyNumber || memcmp( number, lazyNumber, sizeof( double ) ) != 0 ||
+             value->GetNumberType() != lazyValue->GetNumberType() || value->GetNumberType() != inSituValue->GetNumberType() ||
+             memcmp( number, lazyValue->GetDataAsPointerTo<double>(), sizeof( double ) ) != 0 )
+        {
+            fprintf( stderr, "Unexpected lazy number %s\n", memberName );
+            return 1;
+        }
+    }
+
+    if ( lazy->FindMember( "smallest" )->GetNumberType() != Json::NumberType::kInt64 ||
+         lazy->FindMember( "largest" )->GetNumberType() != Json::NumberType::kUInt64 ||
+         lazy->FindMember( "fraction" )->GetNumberType() != Json::NumberType::kDouble )
+    {
+        fprintf( stderr, "Unexpected lazy number types\n" );
+        return 1;
+    }
+
+    // Each document is written before it is deserialized, so that writing converts some of the numbers first.
+    Json::StructuredData* lazyDocuments[] = { &lazyJSd, &packedLazyJSd, &inSituLazyJSd };
+
+    for ( Json::StructuredData* lazyDocument : lazyDocuments )
+    {
+        if ( !SameWrittenText( jSd, *lazyDocument ) )
+        {
+            return 1;
+        }
+    }
+
+    Reading reading;
+
+    if ( Json::Validate( jSd, reading ) != Json::Status::kOk || jSd.DeserializeTo( reading ) != Json::Status::kOk ||
+         reading.largest != 18446744073709551615ULL || reading.offsets[ 1 ] != 9007199254740993 )
+    {
+        fprintf( stderr, "Failed to deserialize the reading\n" );
+        return 1;
+    }
+
+    for ( Json::StructuredData* lazyDocument : lazyDocuments )
+    {
+        Reading lazyReading;
+
+        if ( Json::Validate( *lazyDocument, lazyReading ) != Json::Status::kOk || lazyDocument->DeserializeTo( lazyReading ) != Json::Status::kOk ||
+             !SameReading( reading, lazyReading ) )
+        {
+            fprintf( stderr, "Lazy numbers were not deserialized correctly\n" );
+            return 1;
+        }
+    }
+
+    // A number that is read as an integer before anything else converts as an eagerly converted number does.
+    struct ConversionCase
+    {
+        const char*  text;
+        Json::Status status;
+    };
+
+    static const ConversionCase conversionCases[] = {
+        { "[ 2147483647 ]", Json::Status::kOk },
+        { "[ 2147483648 ]", Json::Status::kNumberOutOfRange },
+        { "[ -2147483648 ]", Json::Status::kOk },
+        { "[ 2.5 ]", Json::Status::kInvalidValueType },
+        { "[ 4.0e1 ]", Json::Status::kOk },
+        { "[ true ]", Json::Status::kInvalidValueType },
+    };
+
+    for ( const ConversionCase& conversionCase : conversionCases )
+    {
+        Terathon::Array<Terathon::int32> integers;
+        Terathon::Array<Terathon::int32> lazyIntegers;
+
+        MakeText( text, conversionCase.text );
+
+        if ( jSd.Parse( text ).status != Json::Status::kOk || lazyJSd.Parse( text ).status != Json::Status::kOk ||
+             jSd.DeserializeTo( integers ) != conversionCase.status || lazyJSd.DeserializeTo( lazyIntegers ) != conversionCase.status ||
+             ( conversionCase.status == Json::Status::kOk && integers[ 0 ] != lazyIntegers[ 0 ] ) )
+        {
+            fprintf( stderr, "Unexpected conversion status for %s\n", conversionCase.text );
+            return 1;
+        }
+    }
+
+    static const char* const malformedTexts[] = {
+        "[ 01 ]", "[ 1.e ]", "[ - ]", "[ 1e ]", "[ 1e+ ]", "[ 1, 2, ]", "{ \"a\" :\n  -.e5 }", "[ 1 2 ]", "[ 1, 2 ] x", "[ .5, 0x1 ]",
+    };
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+        MakeText( buffer, malformedText );
+
+        Json::ParseResult parseResult       = jSd.Parse( text );
+        Json::ParseResult lazyParseResult   = lazyJSd.Parse( text );
+        Json::ParseResult inSituParseResult = inSituLazyJSd.ParseInSitu( buffer );
+
+        if ( parseResult.status == Json::Status::kOk || lazyParseResult.status != parseResult.status ||
+             lazyParseResult.errorLine != parseResult.errorLine || lazyParseResult.errorColumn != parseResult.errorColumn ||
+             inSituParseResult.status != parseResult.status || inSituParseResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
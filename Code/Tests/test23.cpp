@@ -0,0 +1,200 @@
+#include <Json4C4/C4Json.h>
+
+#include "AllocationCounter.h"
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Json = C4::Json;
+
+// Checks the syntax of valid and malformed documents without parsing them and checks that, with the grammar of Parse,
+// the status and error position are those reported by StructuredData::Parse, that the grammar of RFC 8259 is checked
+// by default, and that checking allocates no memory.
+
+static const char* const documentTexts[] = {
+    // Valid documents.
+    "{ \"name\" : \"caf\\u00e9\", \"values\" : [ 1, -2.5e3, 0, true, false, null, { \"empty\" : {}, \"list\" : [] } ],\n"
+    "  \"nested\" : [ [ [ \"\\\"deep\\\"\" ] ] ], \"text\" : \"\xE2\x82\xAC \\n\\t\\\\\" }",
+    "  [ 1, 2, 3 ]  \n",
+    "\"just a string\"",
+    "-0.5",
+    "true",
+    "null",
+    "[ +1, .5, 5., 1e999999 ]",
+
+    // Malformed documents.
+    "{ \"a\" : 1, }",
+    "{ \"a\" 1 }",
+    "{ a : 1 }",
+    "{ \"a\" : 1\n  \"b\" : 2 }",
+    "[ 1, 2, ]",
+    "[ 1 2 ]",
+    "[ 01 ]",
+    "[ 1.e5, - ]",
+    "[ 1e ]",
+    "[ tru ]",
+    "[ fals ]",
+    "[ nul ]",
+    "[ \"bad \\q escape\" ]",
+    "[ \"control \x01 character\" ]",
+    "[ \"\xC3\x28 invalid UTF-8\" ]",
+    "[ \"unterminated ]",
+    "{ \"a\" : [ 1, { \"b\" : [ true, } ] }",
+    "[ 1, 2 ] x",
+    "[ 1, 2",
+    "{",
+    "@",
+    "  \n\n ",
+};
+
+int main()
+{
+    Terathon::Array<char> text;
+    Json::StructuredData  jSd;
+
+    for ( const char* documentText : documentTexts )
+    {
+        MakeText( text, documentText );
+
+        Json::ParseResult parseResult = jSd.Parse( text );
+
+        allocationCount  = 0;
+        countAllocations = true;
+
+        Json::ParseResult checkResult = Json::CheckSyntax( text.begin(), size_t( text.GetArrayElementCount() ), Json::Grammar::kParse );
+
+        countAllocations = false;
+
+        if ( checkResult.status != parseResult.status || checkResult.errorLine != parseResult.errorLine ||
+             checkResult.errorColumn != parseResult.errorColumn || allocationCount != 0 )
+        {
+            Terathon::String<256> checkDescription = Json::ParseResultToString( checkResult );
+            Terathon::String<256> parseDescription = Json::ParseResultToString( parseResult );
+
+            fprintf( stderr, "Unexpected result for %s:\n%s\n%s\n", documentText, static_cast<const char*>( checkDescription ),
+                     static_cast<const char*>( parseDescription ) );
+            return 1;
+        }
+    }
+
+    // A large document is checked as it is parsed.
+    Terathon::Array<char> largeText;
+    char                  element[ 128 ];
+
+    largeText.AppendArrayElement( '[' );
+
+    for ( int a = 0; a != 20000; a++ )
+    {
+        int length = snprintf( element, sizeof( element ), "%s\n  { \"id\" : %d, \"value\" : %d.25, \"name\" : \"element %d\", \"flags\" : [ true, null ] }",
+                               a == 0 ? "" : ",", a, -a, a );
+
+        for ( int b = 0; b != length; b++ )
+        {
+            largeText.AppendArrayElement( element[ b ] );
+        }
+    }
+
+    largeText.AppendArrayElement( ']' );
+    largeText.AppendArrayElement( '\0' );
+
+    if ( Json::CheckSyntax( largeText.begin(), size_t( largeText.GetArrayElementCount() ) ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to check the large document\n" );
+        return 1;
+    }
+
+    largeText[ largeText.GetArrayElementCount() - 3 ] = ',';
+
+    Json::ParseResult parseResult = jSd.Parse( largeText );
+    Json::ParseResult checkResult = Json::CheckSyntax( largeText.begin(), size_t( largeText.GetArrayElementCount() ), Json::Grammar::kParse );
+
+    if ( parseResult.status == Json::Status::kOk || checkResult.status != parseResult.status || checkResult.errorLine != parseResult.errorLine ||
+         checkResult.errorColumn != parseResult.errorColumn || checkResult.errorLine != 20001 )
+    {
+        fprintf( stderr, "Unexpected error report for the large document\n" );
+        return 1;
+    }
+
+    // By default, documents are checked against the grammar of RFC 8259, which is stricter than that of Parse about
+    // numbers, and accepts the delete character and escaped null characters in strings.
+    struct StrictCase
+    {
+        const char*     text;
+        Json::Status    status;
+        Terathon::int32 errorColumn;
+    };
+
+    static const StrictCase strictCases[] = {
+        { "[ 0, -0, 1.5, -2.25e3, 1E-5, 0.5e+3, 1e999999 ]", Json::Status::kOk, 0 },
+        { "[ \"delete \x7F\", \"null \\u0000\" ]", Json::Status::kOk, 0 },
+        { "[ +1 ]", Json::Status::kExpectedJsonValue, 3 },
+        { "[ - 1 ]", Json::Status::kExpectedJsonValue, 3 },
+        { "[ .5 ]", Json::Status::kExpectedJsonValue, 3 },
+        { "[ 1. ]", Json::Status::kExpectedJsonValue, 3 },
+        { "[ 1, 1.e5 ]", Json::Status::kExpectedJsonValue, 6 },
+        { "[ -e5 ]", Json::Status::kExpectedJsonValue, 3 },
+        { "[ 1e+ ]", Json::Status::kExpectedJsonValue, 3 },
+        { "[ -01 ]", Json::Status::kNumbersCannotHaveLeadingZeros, 4 },
+        { "[ \"\\u000\" ]", Json::Status::kStringIllegalEscape, 4 },
+        { "[ \"\x01\" ]", Json::Status::kStringIllegalChar, 4 },
+    };
+
+    for ( const StrictCase& strictCase : strictCases )
+    {
+        MakeText( text, strictCase.text );
+
+        allocationCount  = 0;
+        countAllocations = true;
+
+        checkResult = Json::CheckSyntax( text.begin(), size_t( text.GetArrayElementCount() ) );
+
+        countAllocations = false;
+
+        if ( checkResult.status != strictCase.status || ( checkResult.status != Json::Status::kOk && checkResult.errorColumn != strictCase.errorColumn ) ||
+             allocationCount != 0 )
+        {
+            Terathon::String<256> checkDescription = Json::ParseResultToString( checkResult );
+
+            fprintf( stderr, "Unexpected strict result for %s:\n%s\n", strictCase.text, static_cast<const char*>( checkDescription ) );
+            return 1;
+        }
+    }
+
+    // Nesting is not limited by the call stack.
+    const int   depth = 400000;
+    std::string nestedText( size_t( depth ), '[' );
+
+    nestedText += "{ \"a\" : [ 1 ] }";
+    nestedText.append( size_t( depth ), ']' );
+    MakeText( text, nestedText.c_str() );
+
+    if ( Json::CheckSyntax( text.begin(), size_t( text.GetArrayElementCount() ) ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to check deeply nested arrays\n" );
+        return 1;
+    }
+
+    nestedText[ size_t( depth ) + 11 ] = ',';
+    MakeText( text, nestedText.c_str() );
+    checkResult = Json::CheckSyntax( text.begin(), size_t( text.GetArrayElementCount() ) );
+
+    if ( checkResult.status != Json::Status::kExpectedJsonValue || checkResult.errorLine != 1 || checkResult.errorColumn != depth + 13 )
+    {
+        fprintf( stderr, "Unexpected error report for deeply nested arrays\n" );
+        return 1;
+    }
+
+    // Buffers are checked as Parse checks them.
+    static const char unterminated[] = { '[', '1', ']' };
+
+    if ( Json::CheckSyntax( "1", 2 ).status != Json::Status::kTextBufferContentsInvalid ||
+         Json::CheckSyntax( unterminated, sizeof( unterminated ) ).status != Json::Status::kUnterminatedTextBuffer )
+    {
+        fprintf( stderr, "Unexpected buffer checks\n" );
+        return 1;
+    }
+
+    return 0;
+}
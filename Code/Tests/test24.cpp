@@ -0,0 +1,391 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Json = C4::Json;
+
+// Parses documents into events and checks the events reported for a document, that writing the events back as text
+// gives the same document, that a handler can stop the parse, and that syntax errors are reported as for Parse.
+
+// Writes the events back as a compact JSON text.
+struct TextWriter : Json::EventHandler
+{
+    std::string           text;
+    Terathon::Array<bool> separated;
+
+    void BeginValue()
+    {
+        if ( !separated.Empty() )
+        {
+            if ( separated[ separated.GetArrayElementCount() - 1 ] )
+            {
+                text += ',';
+            }
+
+            separated[ separated.GetArrayElementCount() - 1 ] = true;
+        }
+    }
+
+    void WriteString( const char* string, Terathon::int32 length )
+    {
+        text += '"';
+
+        for ( Terathon::int32 a = 0; a != length; a++ )
+        {
+            char c = string[ a ];
+
+            if ( c == '"' || c == '\\' )
+            {
+                text += '\\';
+                text += c;
+            }
+            else if ( Terathon::uint8( c ) < 32 )
+            {
+                char escape[ 8 ];
+                snprintf( escape, sizeof( escape ), "\\u%04x", unsigned( c ) );
+                text += escape;
+            }
+            else
+            {
+                text += c;
+            }
+        }
+
+        text += '"';
+    }
+
+    bool OnStartObject()
+    {
+        BeginValue();
+        text += '{';
+        separated.AppendArrayElement( false );
+
+        return true;
+    }
+
+    bool OnKey( const char* name, Terathon::int32 length )
+    {
+        BeginValue();
+        WriteString( name, length );
+        text += ':';
+
+        // The value of a member follows its key without a comma.
+        separated[ separated.GetArrayElementCount() - 1 ] = false;
+
+        return true;
+    }
+
+    bool OnEndObject( Terathon::int32 /*memberCount*/ )
+    {
+        separated.RemoveArrayElement( separated.GetArrayElementCount() - 1 );
+        text += '}';
+
+        return true;
+    }
+
+    bool OnStartArray()
+    {
+        BeginValue();
+        text += '[';
+        separated.AppendArrayElement( false );
+
+        return true;
+    }
+
+    bool OnEndArray( Terathon::int32 /*elementCount*/ )
+    {
+        separated.RemoveArrayElement( separated.GetArrayElementCount() - 1 );
+        text += ']';
+
+        return true;
+    }
+
+    bool OnString( const char* string, Terathon::int32 length )
+    {
+        BeginValue();
+        WriteString( string, length );
+
+        return true;
+    }
+
+    bool OnNumber( const Json::Number& number )
+    {
+        char digits[ 32 ];
+
+        if ( number.type == Json::NumberType::kInt64 )
+        {
+            snprintf( digits, sizeof( digits ), "%lld", static_cast<long long>( Terathon::int64( number.integer ) ) );
+        }
+        else if ( number.type == Json::NumberType::kUInt64 )
+        {
+            snprintf( digits, sizeof( digits ), "%llu", static_cast<unsigned long long>( number.integer ) );
+        }
+        else
+        {
+            snprintf( digits, sizeof( digits ), "%.17g", number.data );
+        }
+
+        BeginValue();
+        text += digits;
+
+        return true;
+    }
+
+    bool OnBool( bool value )
+    {
+        BeginValue();
+        text += value ? "true" : "false";
+
+        return true;
+    }
+
+    bool OnNull()
+    {
+        BeginValue();
+        text += "null";
+
+        return true;
+    }
+};
+
+// Records the events in a short form, and stops at a chosen event.
+struct EventRecorder : Json::EventHandler
+{
+    std::string events;
+    int         eventCount = 0;
+    int         stopEvent  = -1;
+
+    bool Record( const std::string& event )
+    {
+        events += event;
+        events += ' ';
+
+        return eventCount++ != stopEvent;
+    }
+
+    bool OnStartObject()
+    {
+        return Record( "{" );
+    }
+
+    bool OnKey( const char* name, Terathon::int32 length )
+    {
+        return Record( "key:" + std::string( name, size_t( length ) ) );
+    }
+
+    bool OnEndObject( Terathon::int32 memberCount )
+    {
+        return Record( "}" + std::to_string( memberCount ) );
+    }
+
+    bool OnStartArray()
+    {
+        return Record( "[" );
+    }
+
+    bool OnEndArray( Terathon::int32 elementCount )
+    {
+        return Record( "]" + std::to_string( elementCount ) );
+    }
+
+    bool OnString( const char* string, Terathon::int32 length )
+    {
+        return Record( "string:" + std::string( string, size_t( length ) ) );
+    }
+
+    bool OnNumber( const Json::Number& number )
+    {
+        return Record( ( number.type == Json::NumberType::kDouble ) ? "double:" + std::to_string( number.data )
+                                                                     : "integer:" + std::to_string( Terathon::int64( number.integer ) ) );
+    }
+
+    bool OnBool( bool value )
+    {
+        return Record( value ? "true" : "false" );
+    }
+};
+
+// Handles only strings, and throws on a chosen one.
+struct StringCounter : Json::EventHandler
+{
+    int stringCount = 0;
+
+    bool OnString( const char* string, Terathon::int32 length )
+    {
+#ifdef __cpp_exceptions
+
+        if ( length == 5 && memcmp( string, "throw", 5 ) == 0 )
+        {
+            throw 1;
+        }
+
+#endif
+
+        stringCount++;
+
+        return true;
+    }
+};
+
+static bool WriteDocument( const Terathon::Array<char>& text, Terathon::Array<char>& written )
+{
+    Json::StructuredData jSd;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk || jSd.WriteToBuffer( written ) != Json::Status::kOk )
+    {
+        return false;
+    }
+
+    written.AppendArrayElement( '\0' );
+
+    return true;
+}
+
+static const char* const documentText = "{ \"name\" : \"caf\\u00e9 \\\"quoted\\\"\", \"values\" : [ 1, -2.5, 18446744073709551615, true, false, null ],\n"
+                                        "  \"empty\" : {}, \"list\" : [], \"nested\" : [ [ { \"key \\t tab\" : \"line\\nbreak\" } ] ], \"last\" : -0 }";
+
+int main()
+{
+    Terathon::Array<char> text;
+    EventRecorder         recorder;
+
+    MakeText( text, "{ \"a\" : [ 1, 2.5, \"x\\ny\" ], \"b\" : { \"c\" : true }, \"d\" : [] }" );
+
+    if ( Json::ParseEvents( text, recorder ).status != Json::Status::kOk ||
+         recorder.events != "{ key:a [ integer:1 double:2.500000 string:x\ny ]3 key:b { key:c true }1 key:d [ ]0 }3 " )
+    {
+        fprintf( stderr, "Unexpected events: %s\n", recorder.events.c_str() );
+        return 1;
+    }
+
+    // Writing the events back gives a text that parses to the same document.
+    TextWriter writer;
+    MakeText( text, documentText );
+
+    Json::ParseResult parseResult = Json::ParseEvents( text.begin(), size_t( text.GetArrayElementCount() ), writer );
+
+    Terathon::Array<char> rewrittenText;
+    MakeText( rewrittenText, writer.text.c_str() );
+
+    Terathon::Array<char> written;
+    Terathon::Array<char> rewritten;
+
+    if ( parseResult.status != Json::Status::kOk || !WriteDocument( text, written ) || !WriteDocument( rewrittenText, rewritten ) ||
+         strcmp( written.begin(), rewritten.begin() ) != 0 )
+    {
+        fprintf( stderr, "Events do not describe the document:\n%s\n", writer.text.c_str() );
+        return 1;
+    }
+
+    // A handler stops the parse by returning false, and the position where it stopped is reported.
+    EventRecorder stoppingRecorder;
+    stoppingRecorder.stopEvent = 4;
+
+    parseResult = Json::ParseEvents( text, stoppingRecorder );
+
+    if ( parseResult.status != Json::Status::kStoppedByHandler || stoppingRecorder.eventCount != 5 || parseResult.errorLine != 1 ||
+         parseResult.errorColumn != 47 )
+    {
+        fprintf( stderr, "Unexpected stop after %d events at %d:%d\n", stoppingRecorder.eventCount, int( parseResult.errorLine ),
+                 int( parseResult.errorColumn ) );
+        return 1;
+    }
+
+#ifdef __cpp_exceptions
+
+    // Exceptions thrown by a handler are caught.
+    StringCounter counter;
+    MakeText( text, "[ \"one\", \"two\", \"throw\", \"four\" ]" );
+
+    if ( Json::ParseEvents( text, counter ).status != Json::Status::kException || counter.stringCount != 2 )
+    {
+        fprintf( stderr, "Unexpected exception handling\n" );
+        return 1;
+    }
+
+#endif
+
+    // Nesting is not limited by the call stack, and the events of deeply nested containers are reported in order.
+    const Terathon::int32 depth = 400000;
+    std::string           nestedText( size_t( depth ), '[' );
+
+    nestedText += "{ \"a\" : 1 }";
+    nestedText.append( size_t( depth ), ']' );
+    MakeText( text, nestedText.c_str() );
+
+    EventRecorder nestedRecorder;
+
+    if ( Json::ParseEvents( text, nestedRecorder ).status != Json::Status::kOk || nestedRecorder.eventCount != depth * 2 + 4 ||
+         nestedRecorder.events.compare( nestedRecorder.events.size() - 12, 12, "]1 ]1 ]1 ]1 " ) != 0 )
+    {
+        fprintf( stderr, "Unexpected events for deeply nested arrays\n" );
+        return 1;
+    }
+
+    nestedText.erase( nestedText.size() - 1 );
+    MakeText( text, nestedText.c_str() );
+
+    Json::EventHandler nestedHandler;
+    parseResult = Json::ParseEvents( text, nestedHandler );
+
+    if ( parseResult.status != Json::Status::kExpectedClosingSquareBracketsOrComma || parseResult.errorLine != 1 ||
+         parseResult.errorColumn != Terathon::int32( nestedText.size() ) + 1 )
+    {
+        fprintf( stderr, "Unexpected error for unclosed nested arrays\n" );
+        return 1;
+    }
+
+    static const char* const malformedTexts[] = {
+        "{ \"a\" : 1, }", "{ \"a\" 1 }", "{ a : 1 }", "{ \"a\" : 1\n  \"b\" : 2 }", "[ 1, 2, ]", "[ 01 ]", "[ 1e ]",
+        "[ tru ]", "[ fals ]", "[ nul ]", "[ \"bad \\q escape\" ]", "[ 1, 2 ] x", "[ 1, 2", "@",
+    };
+
+    Json::StructuredData jSd;
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+
+        Json::EventHandler handler;
+        Json::ParseResult  eventResult = Json::ParseEvents( text, handler );
+
+        parseResult = jSd.Parse( text );
+
+        if ( parseResult.status == Json::Status::kOk || eventResult.status != parseResult.status || eventResult.errorLine != parseResult.errorLine ||
+             eventResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    // Files are parsed into events as well.
+    const char* fileName = "Data/Test/test_file24_events.json";
+    FILE*       file     = fopen( fileName, "wb" );
+
+    if ( !file )
+    {
+        fprintf( stderr, "Could not create %s\n", fileName );
+        return 1;
+    }
+
+    fputs( "[ \"a\", \"b\", [ \"c\" ] ]", file );
+    fclose( file );
+
+    StringCounter fileCounter;
+
+    if ( Json::ParseEventsFromFile( fileName, fileCounter ).status != Json::Status::kOk || fileCounter.stringCount != 3 ||
+         Json::ParseEventsFromFile( "Data/Test/test_file24_missing.json", fileCounter ).status == Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the file into events\n" );
+        return 1;
+    }
+
+    remove( fileName );
+
+    return 0;
+}
@@ -0,0 +1,317 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Json = C4::Json;
+
+// Reads documents with a Reader and checks that values are decoded as Deserialize decodes them, that unread and
+// skipped values are passed over, that values of another type are reported, and that syntax errors are reported
+// with the status, line, and column that Parse reports.
+
+struct Item
+{
+    Terathon::String<>               name;
+    double                           price = 0.0;
+    Terathon::int32                  count = 0;
+    Terathon::uint64                 id    = 0;
+    bool                             sold  = false;
+    Terathon::Array<Terathon::int64> sizes;
+
+#define ITEM_PROTO "name", name, "price", price, "count", count, "id", id, "sold", sold, "sizes", sizes
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( ITEM_PROTO )
+};
+
+static const char* const itemsText =
+    "[ { \"name\" : \"caf\\u00e9 table\", \"price\" : 12.5, \"count\" : 3, \"id\" : 18446744073709551615,\n"
+    "    \"extra\" : { \"nested\" : [ 1, { \"deep\" : null } ], \"more\" : \"skipped\" }, \"sold\" : true, \"sizes\" : [ 1, -2 ] },\n"
+    "  { \"sizes\" : [], \"unread\" : [ \"a\", \"b\" ], \"sold\" : false, \"name\" : \"chair\", \"count\" : -7, \"price\" : 0,\n"
+    "    \"id\" : 0, \"note\" : null } ]";
+
+static bool KeyIs( const Json::Reader& reader, const char* name )
+{
+    Json::StringView key = reader.GetKey();
+
+    return key.length == Terathon::int32( strlen( name ) ) && memcmp( key.text, name, size_t( key.length ) ) == 0;
+}
+
+// Decodes an item from its members, in any order, and skips or leaves unknown members.
+static Json::Status ReadItem( Json::Reader& reader, Item& item )
+{
+    reader.EnterObject();
+
+    while ( reader.Next() )
+    {
+        if ( KeyIs( reader, "name" ) )
+        {
+            Json::StringView name;
+            if ( reader.ReadString( name ) == Json::Status::kOk )
+            {
+                item.name.Set( name.text, name.length );
+            }
+        }
+        else if ( KeyIs( reader, "price" ) )
+        {
+            reader.ReadDouble( item.price );
+        }
+        else if ( KeyIs( reader, "count" ) )
+        {
+            reader.ReadInteger( item.count );
+        }
+        else if ( KeyIs( reader, "id" ) )
+        {
+            reader.ReadInteger( item.id );
+        }
+        else if ( KeyIs( reader, "sold" ) )
+        {
+            reader.ReadBool( item.sold );
+        }
+        else if ( KeyIs( reader, "sizes" ) )
+        {
+            reader.EnterArray();
+
+            while ( reader.Next() )
+            {
+                Terathon::int64 size = 0;
+                reader.ReadInteger( size );
+                item.sizes.AppendArrayElement( size );
+            }
+        }
+        else if ( KeyIs( reader, "extra" ) )
+        {
+            reader.SkipValue();
+        }
+    }
+
+    return reader.GetStatus();
+}
+
+// Reads every value of a document in order, as a generic consumer would.
+static void ReadAnyValue( Json::Reader& reader )
+{
+    switch ( reader.PeekType() )
+    {
+    case Json::NodeType::kObject:
+        reader.EnterObject();
+
+        while ( reader.Next() )
+        {
+            ReadAnyValue( reader );
+        }
+        break;
+
+    case Json::NodeType::kArray:
+        reader.EnterArray();
+
+        while ( reader.Next() )
+        {
+            ReadAnyValue( reader );
+        }
+        break;
+
+    case Json::NodeType::kString:
+    {
+        Json::StringView string;
+        reader.ReadString( string );
+        break;
+    }
+
+    case Json::NodeType::kNumber:
+    {
+        Json::Number number;
+        reader.ReadNumber( number );
+        break;
+    }
+
+    case Json::NodeType::kBool:
+    {
+        bool value;
+        reader.ReadBool( value );
+        break;
+    }
+
+    case Json::NodeType::kNull:
+        reader.ReadNull();
+        break;
+    }
+}
+
+static bool SameItem( const Item& a, const Item& b )
+{
+    if ( strcmp( a.name, b.name ) != 0 || a.price != b.price || a.count != b.count || a.id != b.id || a.sold != b.sold ||
+         a.sizes.GetArrayElementCount() != b.sizes.GetArrayElementCount() )
+    {
+        return false;
+    }
+
+    for ( Terathon::int32 i = 0; i != a.sizes.GetArrayElementCount(); i++ )
+    {
+        if ( a.sizes[ i ] != b.sizes[ i ] )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    MakeText( text, itemsText );
+
+    Json::StructuredData  jSd;
+    Terathon::Array<Item> items;
+    Terathon::Array<Item> readItems;
+    Json::Reader          reader;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk || jSd.DeserializeTo( items ) != Json::Status::kOk ||
+         reader.Open( text ) != Json::Status::kOk || reader.EnterArray() != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to open the items\n" );
+        return 1;
+    }
+
+    while ( reader.Next() )
+    {
+        ReadItem( reader, *readItems.AppendArrayElement() );
+    }
+
+    if ( reader.Finish() != Json::Status::kOk || readItems.GetArrayElementCount() != 2 || !SameItem( items[ 0 ], readItems[ 0 ] ) ||
+         !SameItem( items[ 1 ], readItems[ 1 ] ) || strcmp( readItems[ 0 ].name, "caf\xC3\xA9 table" ) != 0 )
+    {
+        fprintf( stderr, "Unexpected items read\n" );
+        return 1;
+    }
+
+    // Values of another type, and numbers out of the range of an integer, are reported at the start of the value.
+    struct MismatchCase
+    {
+        const char*     text;
+        Json::Status    status;
+        Terathon::int32 errorColumn;
+    };
+
+    static const MismatchCase mismatchCases[] = {
+        { "[ { \"name\" : 5 } ]", Json::Status::kInvalidValueType, 14 },
+        { "[ { \"count\" : 2.5 } ]", Json::Status::kInvalidValueType, 15 },
+        { "[ { \"count\" : 2147483648 } ]", Json::Status::kNumberOutOfRange, 15 },
+        { "[ { \"sizes\" : {} } ]", Json::Status::kInvalidValueType, 15 },
+        { "{ \"name\" : \"x\" }", Json::Status::kInvalidValueType, 1 },
+    };
+
+    for ( const MismatchCase& mismatchCase : mismatchCases )
+    {
+        Item item;
+
+        MakeText( text, mismatchCase.text );
+
+        if ( reader.Open( text ) == Json::Status::kOk && reader.EnterArray() == Json::Status::kOk )
+        {
+            while ( reader.Next() )
+            {
+                ReadItem( reader, item );
+            }
+        }
+
+        Json::ParseResult parseResult = reader.GetParseResult();
+
+        if ( parseResult.status != mismatchCase.status || parseResult.errorLine != 1 || parseResult.errorColumn != mismatchCase.errorColumn ||
+             reader.Next() || reader.Finish() != mismatchCase.status )
+        {
+            fprintf( stderr, "Unexpected mismatch report for %s\n", mismatchCase.text );
+            return 1;
+        }
+    }
+
+    // Reading every value of a document, or skipping it, reports the syntax errors of Parse.
+    static const char* const documentTexts[] = {
+        "{ \"a\" : 1, }", "{ \"a\" 1 }", "{ a : 1 }", "{ \"a\" : 1\n  \"b\" : 2 }", "[ 1, 2, ]", "[ 1 2 ]", "[ 01 ]", "[ 1e ]", "[ tru ]",
+        "[ fals ]", "[ nul ]", "[ \"bad \\q escape\" ]", "[ \"\tabc\" ]", "{ \"a\" : \"b\nc\" }", "[ 1, 2 ] x", "[ 1, 2",
+        "{ \"a\" : [ 1, { \"b\" :\n [ true, } ] }", "@@@", "", "{ \"a\" : [ 1, -2.5e3, \"x\\ny\", true, null, {} ], \"b\" : {} }",
+    };
+
+    for ( const char* documentText : documentTexts )
+    {
+        MakeText( text, documentText );
+
+        Json::ParseResult parseResult = jSd.Parse( text );
+
+        for ( int pass = 0; pass != 2; pass++ )
+        {
+            if ( reader.Open( text ) == Json::Status::kOk )
+            {
+                if ( pass == 0 )
+                {
+                    ReadAnyValue( reader );
+                }
+                else
+                {
+                    reader.SkipValue();
+                }
+
+                reader.Finish();
+            }
+
+            Json::ParseResult readResult = reader.GetParseResult();
+
+            if ( readResult.status != parseResult.status || readResult.errorLine != parseResult.errorLine ||
+                 readResult.errorColumn != parseResult.errorColumn )
+            {
+                fprintf( stderr, "Unexpected error report in pass %d for %s\n", pass, documentText );
+                return 1;
+            }
+        }
+    }
+
+    // Deeply nested values are checked without recursion when they are left for Next, skipped, or passed over by Seek
+    // and ParseInto.
+    const int   depth = 400000;
+    std::string nestedText( "{ \"unread\" : " );
+
+    nestedText.append( size_t( depth ), '[' );
+    nestedText.append( size_t( depth ), ']' );
+    nestedText += ", \"extra\" : ";
+
+    for ( int a = 0; a != depth; a++ )
+    {
+        nestedText += "{ \"a\" : ";
+    }
+
+    nestedText += "{}";
+    nestedText.append( size_t( depth ), '}' );
+    nestedText += ", \"name\" : \"deep\", \"price\" : 1, \"count\" : 2, \"id\" : 3, \"sold\" : true, \"sizes\" : [] }";
+    MakeText( text, nestedText.c_str() );
+
+    Item                  nestedItem;
+    Item                  parsedItem;
+    Json::CompiledPointer namePointer;
+    Json::StringView      name;
+
+    if ( reader.Open( text ) != Json::Status::kOk || ReadItem( reader, nestedItem ) != Json::Status::kOk || reader.Finish() != Json::Status::kOk ||
+         strcmp( nestedItem.name, "deep" ) != 0 || namePointer.Compile( "/name" ) != Json::Status::kOk || reader.Open( text ) != Json::Status::kOk ||
+         reader.Seek( namePointer ) != Json::Status::kOk || reader.ReadString( name ) != Json::Status::kOk || name.length != 4 ||
+         Json::ParseInto( text, parsedItem ).status != Json::Status::kOk || strcmp( parsedItem.name, "deep" ) != 0 )
+    {
+        fprintf( stderr, "Failed to skip deeply nested values\n" );
+        return 1;
+    }
+
+    // An array left open reports the colon of the next member, as Parse would.
+    nestedText.erase( nestedText.find( ']' ), 1 );
+    MakeText( text, nestedText.c_str() );
+
+    Json::ParseResult nestedResult = Json::ParseInto( text, parsedItem );
+
+    if ( nestedResult.status != Json::Status::kExpectedClosingSquareBracketsOrComma || nestedResult.errorLine != 1 ||
+         nestedResult.errorColumn != Terathon::int32( nestedText.find( "\"extra\" :" ) ) + 9 )
+    {
+        fprintf( stderr, "Unexpected error report for deeply nested values\n" );
+        return 1;
+    }
+
+    return 0;
+}
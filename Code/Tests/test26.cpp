@@ -0,0 +1,239 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Parses documents straight into objects and checks that they are read as Deserialize reads them from a
+// StructuredData, with members in any order and unknown members skipped, that missing members are reported, and that
+// errors in the contents and in the syntax are reported with their line and column.
+
+struct Point
+{
+    double x = 0.0;
+    double y = 0.0;
+
+#define POINT_PROTO "x", x, "y", y
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( POINT_PROTO )
+};
+
+struct Shape
+{
+    Terathon::int64                           id = 0;
+    Terathon::String<>                        name;
+    bool                                      closed = false;
+    Json::Null                                parent;
+    Terathon::Array<Point>                    points;
+    Terathon::Array<Terathon::String<>>       tags;
+    Terathon::uint64                          checksum = 0;
+    Terathon::int32                           layer    = 0;
+    Terathon::uint32                          color    = 0;
+    std::string                               comment;
+    std::vector<bool>                         flags;
+    std::map<std::string, Terathon::String<>> labels;
+};
+
+#define SHAPE_PROTO                                                                                                                                            \
+    "id", object.id, "name", object.name, "closed", object.closed, "parent", object.parent, "points", object.points, "tags", object.tags,                      \
+        "checksum", object.checksum, Json::optional, "layer", object.layer, Json::optional, "color", object.color, "comment", object.comment,                  \
+        "flags", object.flags, "labels", object.labels
+DEFINE_JSON4C4_FUNCTIONS( Shape, SHAPE_PROTO )
+
+struct Drawing
+{
+    Terathon::Array<Shape>  shapes;
+    Terathon::String<>      title;
+    Json::ObjectMap<double> scales;
+};
+
+#define DRAWING_PROTO "title", object.title, "shapes", object.shapes, Json::optional, "scales", object.scales
+DEFINE_JSON4C4_FUNCTIONS( Drawing, DRAWING_PROTO )
+
+static const char* const drawingText =
+    "{ \"title\" : \"caf\\u00e9 \\\"plans\\\"\", \"shapes\" : [\n"
+    "  { \"id\" : 9007199254740993, \"name\" : \"square\", \"closed\" : true, \"parent\" : null,\n"
+    "    \"points\" : [ { \"x\" : 0, \"y\" : 0 }, { \"y\" : 1.5, \"unused\" : [ 1, { \"deep\" : [] } ], \"x\" : -2.25 } ],\n"
+    "    \"tags\" : [ \"a\", \"tab\\there\" ], \"checksum\" : 18446744073709551615, \"layer\" : -7, \"color\" : 4294967295,\n"
+    "    \"comment\" : \"\", \"flags\" : [ true, false, true ], \"labels\" : { \"k\" : \"v\", \"\\u00e9t\\u00e9\" : \"summer\" } },\n"
+    "  { \"labels\" : {}, \"flags\" : [], \"comment\" : \"line\\nbreak\", \"checksum\" : 0, \"tags\" : [], \"points\" : [],\n"
+    "    \"ignored\" : { \"a\" : [ [ [ \"x\" ] ] ], \"b\" : null }, \"parent\" : null, \"closed\" : false, \"name\" : \"\", \"id\" : -42 }\n"
+    "], \"scales\" : { \"print\" : 0.5, \"screen\" : 2 }, \"version\" : 3 }";
+
+static bool SameShape( const Shape& a, const Shape& b )
+{
+    if ( a.id != b.id || strcmp( a.name, b.name ) != 0 || a.closed != b.closed || a.checksum != b.checksum || a.layer != b.layer ||
+         a.color != b.color || a.comment != b.comment || a.flags != b.flags || a.labels != b.labels ||
+         a.tags.GetArrayElementCount() != b.tags.GetArrayElementCount() || a.points.GetArrayElementCount() != b.points.GetArrayElementCount() )
+    {
+        return false;
+    }
+
+    for ( Terathon::int32 t = 0; t != a.tags.GetArrayElementCount(); t++ )
+    {
+        if ( strcmp( a.tags[ t ], b.tags[ t ] ) != 0 )
+        {
+            return false;
+        }
+    }
+
+    for ( Terathon::int32 p = 0; p != a.points.GetArrayElementCount(); p++ )
+    {
+        if ( a.points[ p ].x != b.points[ p ].x || a.points[ p ].y != b.points[ p ].y )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool SameDrawing( const Drawing& a, const Drawing& b )
+{
+    if ( strcmp( a.title, b.title ) != 0 || a.shapes.GetArrayElementCount() != b.shapes.GetArrayElementCount() )
+    {
+        return false;
+    }
+
+    for ( Terathon::int32 s = 0; s != a.shapes.GetArrayElementCount(); s++ )
+    {
+        if ( !SameShape( a.shapes[ s ], b.shapes[ s ] ) )
+        {
+            return false;
+        }
+    }
+
+    static const char* const scaleNames[] = { "print", "screen", "missing" };
+
+    for ( const char* scaleName : scaleNames )
+    {
+        const auto* scale      = a.scales.FindMapElement( scaleName );
+        const auto* otherScale = b.scales.FindMapElement( scaleName );
+
+        if ( ( scale == nullptr ) != ( otherScale == nullptr ) || ( scale && scale->data != otherScale->data ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    MakeText( text, drawingText );
+
+    Json::StructuredData jSd;
+    Drawing              drawing;
+    Drawing              parsedDrawing;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk || jSd.DeserializeTo( drawing ) != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to deserialize the drawing\n" );
+        return 1;
+    }
+
+    // Parsing into an object that already holds a larger drawing leaves the same drawing.
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        Json::ParseResult parseResult = Json::ParseInto( text, parsedDrawing );
+
+        if ( parseResult.status != Json::Status::kOk || !SameDrawing( drawing, parsedDrawing ) || parsedDrawing.shapes[ 0 ].id != 9007199254740993 ||
+             strcmp( parsedDrawing.title, "caf\xC3\xA9 \"plans\"" ) != 0 || parsedDrawing.shapes[ 0 ].labels[ "\xC3\xA9t\xC3\xA9" ] != "summer" )
+        {
+            fprintf( stderr, "Unexpected drawing in pass %d\n", pass );
+            return 1;
+        }
+
+        parsedDrawing.shapes.AppendArrayElement()->flags.push_back( true );
+        parsedDrawing.shapes[ 0 ].points.AppendArrayElement();
+    }
+
+    // Missing members are reported as DeserializeTo reports them, unless they are optional.
+    struct ContentCase
+    {
+        const char*     text;
+        Json::Status    status;
+        Terathon::int32 errorLine;
+        Terathon::int32 errorColumn;
+    };
+
+    static const ContentCase contentCases[] = {
+        { "{ \"title\" : \"t\", \"shapes\" : [] }", Json::Status::kOk, 0, 0 },
+        { "{ \"shapes\" : [] }", Json::Status::kNameNotPresent, 1, 18 },
+        { "{ \"title\" : \"t\", \"shapes\" : [ { \"id\" : 1 } ] }", Json::Status::kNameNotPresent, 1, 44 },
+        { "{ \"title\" : 5, \"shapes\" : [] }", Json::Status::kInvalidValueType, 1, 13 },
+        { "{ \"title\" : \"t\",\n  \"shapes\" : [ { \"id\" : 1.5 } ] }", Json::Status::kInvalidValueType, 2, 25 },
+        { "{ \"title\" : \"t\", \"shapes\" : [ { \"id\" : 9223372036854775808 } ] }", Json::Status::kNumberOutOfRange, 1, 40 },
+        { "{ \"title\" : \"t\", \"shapes\" : {} }", Json::Status::kInvalidValueType, 1, 29 },
+        { "[ { \"title\" : \"t\" } ]", Json::Status::kInvalidValueType, 1, 1 },
+    };
+
+    for ( const ContentCase& contentCase : contentCases )
+    {
+        Drawing contentDrawing;
+
+        MakeText( text, contentCase.text );
+
+        Json::ParseResult parseResult = Json::ParseInto( text, contentDrawing );
+
+        if ( parseResult.status != contentCase.status || parseResult.errorLine != contentCase.errorLine ||
+             parseResult.errorColumn != contentCase.errorColumn || jSd.Parse( text ).status != Json::Status::kOk ||
+             jSd.DeserializeTo( drawing ) != contentCase.status )
+        {
+            fprintf( stderr, "Unexpected result %u at %d:%d for %s\n", unsigned( parseResult.status ), int( parseResult.errorLine ),
+                     int( parseResult.errorColumn ), contentCase.text );
+            return 1;
+        }
+    }
+
+    // The first of duplicate members is kept, as by DeserializeTo, and the later ones are skipped.
+    Drawing duplicateDrawing;
+    MakeText( text, "{ \"title\" : \"first\", \"shapes\" : [], \"title\" : \"second\", \"title\" : 5 }" );
+
+    if ( Json::ParseInto( text, duplicateDrawing ).status != Json::Status::kOk || strcmp( duplicateDrawing.title, "first" ) != 0 ||
+         jSd.Parse( text ).status != Json::Status::kOk || jSd.DeserializeTo( drawing ) != Json::Status::kOk || strcmp( drawing.title, "first" ) != 0 )
+    {
+        fprintf( stderr, "Unexpected value for duplicate members\n" );
+        return 1;
+    }
+
+    // Syntax errors, also inside skipped members, are reported as Parse reports them.
+    static const char* const malformedTexts[] = {
+        "{ \"title\" : \"t\", \"shapes\" : [], }", "{ \"title\" : \"t\", \"shapes\" : [] } x", "{ \"title\" : \"t\", \"shapes\" : [ ] ",
+        "{ \"title\" : \"t\", \"skipped\" : [ 1, { \"a\" :\n [ tru ] } ], \"shapes\" : [] }", "{ \"title\" : \"t\", \"skipped\" : [ 01 ] }",
+        "{ \"title\" \"t\" }", "{ \"title\" : \"bad \\q escape\" }", "",
+    };
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        Drawing malformedDrawing;
+
+        MakeText( text, malformedText );
+
+        Json::ParseResult parseResult     = jSd.Parse( text );
+        Json::ParseResult parseIntoResult = Json::ParseInto( text.begin(), size_t( text.GetArrayElementCount() ), malformedDrawing );
+
+        if ( parseResult.status == Json::Status::kOk || parseIntoResult.status != parseResult.status || parseIntoResult.errorLine != parseResult.errorLine ||
+             parseIntoResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    // Values other than objects are parsed into as they are deserialized.
+    Terathon::Array<Terathon::int32> integers;
+    MakeText( text, "[ 1, -2, 3 ]" );
+
+    if ( Json::ParseInto( text, integers ).status != Json::Status::kOk || integers.GetArrayElementCount() != 3 || integers[ 1 ] != -2 )
+    {
+        fprintf( stderr, "Failed to parse into an array\n" );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Json = C4::Json;
+
+// Parses documents with a projection and checks that only the listed members are kept, that skipped members are
+// checked as Parse checks them unless skipping is trusted, and that trusted skipping finds the end of values whose
+// strings hold escape sequences, brackets, and quotes at every position of a block.
+
+struct Header
+{
+    Terathon::int64    id = 0;
+    Terathon::String<> kind;
+};
+
+#define HEADER_PROTO "id", object.id, "kind", object.kind
+DEFINE_JSON4C4_FUNCTIONS( Header, HEADER_PROTO )
+
+struct Event
+{
+    Header                  header;
+    Terathon::Array<double> values;
+};
+
+#define EVENT_PROTO "header", object.header, "values", object.values
+DEFINE_JSON4C4_FUNCTIONS( Event, EVENT_PROTO )
+
+static const char* const eventText =
+    "{ \"header\" : { \"id\" : 42, \"kind\" : \"sample\", \"trace\" : [ \"a\\\"]}\", { \"depth\" : [ [ [] ] ] } ] },\n"
+    "  \"payload\" : { \"blob\" : \"\\\\\\\\\\\"{[\", \"nested\" : { \"header\" : { \"id\" : 7 } }, \"caf\\u00e9\" : 1e5 },\n"
+    "  \"values\" : [ 1, 2.5, -3 ], \"tail\" : [ true, false, null, \"}\" ] }";
+
+static bool WriteDocument( Json::StructuredData& jSd, std::string& written )
+{
+    return jSd.WriteToBuffer( written, 0 ) == Json::Status::kOk;
+}
+
+int main()
+{
+    static constexpr Json::Key projectionKeys[] = { Json::Key( "header" ), Json::Key( "id" ), Json::Key( "kind" ), Json::Key( "values" ) };
+
+    Terathon::Array<char> text;
+    MakeText( text, eventText );
+
+    Json::StructuredData jSd;
+    Json::StructuredData projectedJSd;
+    Json::StructuredData expectedJSd;
+
+    projectedJSd.SetProjection( projectionKeys, 4 );
+
+    Terathon::Array<char> expectedText;
+    MakeText( expectedText, "{ \"header\" : { \"id\" : 42, \"kind\" : \"sample\" }, \"values\" : [ 1, 2.5, -3 ] }" );
+
+    std::string written;
+    std::string expectedWritten;
+
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        projectedJSd.SetTrustedSkipping( pass != 0 );
+
+        Event event;
+
+        if ( projectedJSd.Parse( text ).status != Json::Status::kOk || expectedJSd.Parse( expectedText ).status != Json::Status::kOk ||
+             !WriteDocument( projectedJSd, written ) || !WriteDocument( expectedJSd, expectedWritten ) || written != expectedWritten ||
+             projectedJSd.FindKey( "payload" ) || projectedJSd.FindKey( "trace" ) || !projectedJSd.FindKey( "kind" ) ||
+             projectedJSd.DeserializeTo( event ) != Json::Status::kOk || event.header.id != 42 || event.values.GetArrayElementCount() != 3 )
+        {
+            fprintf( stderr, "Unexpected projection in pass %d: %s\n", pass, written.c_str() );
+            return 1;
+        }
+    }
+
+    // Syntax errors in skipped members are reported as Parse reports them, unless skipping is trusted.
+    static const char* const malformedTexts[] = {
+        "{ \"skipped\" : [ 1, 2, ], \"id\" : 1 }",
+        "{ \"skipped\" : { \"a\" 1 } }",
+        "{ \"skipped\" : [ tru ] }",
+        "{ \"skipped\" : \"bad \\q escape\" }",
+        "{ \"skipped\" : [ 01 ] }",
+        "{ \"skipped\" :\n  [ 1, { \"a\" : [ } ] }",
+        "{ \"skipped\" : [ \"unterminated ] }",
+        "{ \"skipped\" : [ [ [ 1 ] ] }",
+    };
+
+    projectedJSd.SetTrustedSkipping( false );
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+
+        Json::ParseResult parseResult          = jSd.Parse( text );
+        Json::ParseResult projectedParseResult = projectedJSd.Parse( text );
+
+        if ( parseResult.status == Json::Status::kOk || projectedParseResult.status != parseResult.status ||
+             projectedParseResult.errorLine != parseResult.errorLine || projectedParseResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    // Trusted skipping never reads past the end of the text.
+    projectedJSd.SetTrustedSkipping( true );
+
+    static const char* const unterminatedTexts[] = {
+        "{ \"skipped\" : [ \"unterminated ] }",
+        "{ \"skipped\" : [ [ [ 1 ] ]",
+        "{ \"skipped\" : \"ends with a backslash \\",
+    };
+
+    for ( const char* unterminatedText : unterminatedTexts )
+    {
+        MakeText( text, unterminatedText );
+
+        if ( projectedJSd.Parse( text ).status != Json::Status::kPrematureNullTerminator )
+        {
+            fprintf( stderr, "Unexpected trusted skip of %s\n", unterminatedText );
+            return 1;
+        }
+    }
+
+    // Values whose special characters fall at every position of a block, and across blocks, are skipped to their end.
+    Json::Reader reader;
+    reader.SetTrustedSkipping( true );
+
+    for ( int offset = 0; offset != 80; offset++ )
+    {
+        std::string document = "[ ";
+        document.append( size_t( offset ), ' ' );
+        document += "{ \"";
+        document.append( size_t( offset ), 'x' );
+        document += "\\\"\\\\\" : [ \"";
+        document.append( size_t( offset % 7 ), '}' );
+        document += "\\\\\", { \"k\" : \"";
+        document.append( size_t( offset ), ']' );
+        document += "\\\"\" }, [ \"\\u005d\" ], -1.5e3 ] }, true, \"";
+        document.append( size_t( offset ), '[' );
+        document += "\\\\\", 12, null ]";
+
+        MakeText( text, document.c_str() );
+
+        int elementCount = 0;
+
+        if ( reader.Open( text ) == Json::Status::kOk && reader.EnterArray() == Json::Status::kOk )
+        {
+            while ( reader.Next() )
+            {
+                reader.SkipValue();
+                elementCount++;
+            }
+        }
+
+        if ( jSd.Parse( text ).status != Json::Status::kOk || reader.Finish() != Json::Status::kOk || elementCount != 5 )
+        {
+            fprintf( stderr, "Failed to skip the values of %s\n", document.c_str() );
+            return 1;
+        }
+    }
+
+    // Parsing into an object skips the members it does not read in either mode.
+    MakeText( text, eventText );
+
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        Event event;
+
+        if ( Json::ParseInto( text, event, pass != 0 ).status != Json::Status::kOk || event.header.id != 42 || strcmp( event.header.kind, "sample" ) != 0 ||
+             event.values.GetArrayElementCount() != 3 || event.values[ 2 ] != -3.0 )
+        {
+            fprintf( stderr, "Failed to parse into the event in pass %d\n", pass );
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Looks up JSON Pointers in documents, given as text, compiled, and read with a Reader from the raw text, and checks
+// that they refer to the values of the examples of RFC 6901, that escaped tokens and array indices are matched, and
+// that malformed pointers and pointers to no value are reported.
+
+// The example document of RFC 6901, and a larger object whose members are looked up through its hash index.
+static const char* const documentText =
+    "{ \"foo\" : [ \"bar\", \"baz\" ], \"\" : 0, \"a/b\" : 1, \"c%d\" : 2, \"e^f\" : 3, \"g|h\" : 4, \"i\\\\j\" : 5, \"k\\\"l\" : 6,\n"
+    "  \" \" : 7, \"m~n\" : 8, \"mechanical\" : { \"m0\" : 0, \"m1\" : 1, \"m2\" : 2, \"m3\" : 3, \"m4\" : 4, \"m5\" : 5, \"m6\" : 6,\n"
+    "  \"m7\" : 7, \"m8\" : 8, \"m9\" : 9, \"m10\" : 10, \"m11\" : 11, \"m12\" : 12, \"m13\" : 13, \"m14\" : 14, \"m15\" : 15,\n"
+    "  \"gear\\u0052atios\" : [ 3.5, 2.1, 1.4, 1.0, 0.8 ], \"~/\" : { \"deep\" : [ [ 9 ], { \"10\" : 10 } ] } } }";
+
+// Reads the number that a pointer refers to in the raw text.
+static bool SeekNumber( Json::Reader& reader, const Terathon::Array<char>& text, const Json::CompiledPointer& pointer, double& number )
+{
+    return reader.Open( text ) == Json::Status::kOk && reader.Seek( pointer ) == Json::Status::kOk && reader.ReadDouble( number ) == Json::Status::kOk;
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    MakeText( text, documentText );
+
+    Json::StructuredData jSd;
+    Json::Reader         reader;
+
+    if ( jSd.Parse( text ).status != Json::Status::kOk )
+    {
+        fprintf( stderr, "Failed to parse the document\n" );
+        return 1;
+    }
+
+    struct NumberCase
+    {
+        const char* pointer;
+        double      number;
+    };
+
+    static const NumberCase numberCases[] = {
+        { "/", 0.0 },
+        { "/a~1b", 1.0 },
+        { "/c%d", 2.0 },
+        { "/e^f", 3.0 },
+        { "/g|h", 4.0 },
+        { "/i\\j", 5.0 },
+        { "/k\"l", 6.0 },
+        { "/ ", 7.0 },
+        { "/m~0n", 8.0 },
+        { "/mechanical/m15", 15.0 },
+        { "/mechanical/gearRatios/3", 1.0 },
+        { "/mechanical/gearRatios/0", 3.5 },
+        { "/mechanical/~0~1/deep/0/0", 9.0 },
+        { "/mechanical/~0~1/deep/1/10", 10.0 },
+    };
+
+    // The values are the same whether the pointer is looked up as text, compiled, or read from the raw text.
+    for ( const NumberCase& numberCase : numberCases )
+    {
+        Json::CompiledPointer pointer;
+
+        const Json::Value* value         = jSd.FindPointer( numberCase.pointer );
+        const Json::Value* compiledValue = ( pointer.Compile( numberCase.pointer ) == Json::Status::kOk ) ? jSd.FindPointer( pointer ) : nullptr;
+        double             readNumber    = -1.0;
+
+        if ( !value || value != compiledValue || !value->GetDataAsPointerTo<double>() || *value->GetDataAsPointerTo<double>() != numberCase.number ||
+             !SeekNumber( reader, text, pointer, readNumber ) || readNumber != numberCase.number )
+        {
+            fprintf( stderr, "Unexpected value for %s\n", numberCase.pointer );
+            return 1;
+        }
+    }
+
+    // The empty pointer refers to the whole document, and pointers are also looked up from a value within it.
+    const Json::Value*    foo = jSd.FindPointer( "/foo" );
+    const Json::Value*    baz = foo ? foo->FindPointer( "/1" ) : nullptr;
+    Json::CompiledPointer wholePointer;
+
+    if ( jSd.FindPointer( "" ) != jSd.GetRootJsonValue() || wholePointer.Compile( "" ) != Json::Status::kOk || wholePointer.GetTokenCount() != 0 ||
+         jSd.FindPointer( wholePointer ) != jSd.GetRootJsonValue() || !baz || strcmp( *baz->GetDataAsPointerTo<Terathon::String<>>(), "baz" ) != 0 )
+    {
+        fprintf( stderr, "Unexpected whole document or relative lookup\n" );
+        return 1;
+    }
+
+    // A reader left at the value goes on with the values after it.
+    Json::CompiledPointer fooPointer;
+    Json::StringView      string;
+
+    if ( fooPointer.Compile( "/foo/0" ) != Json::Status::kOk || reader.Open( text ) != Json::Status::kOk || reader.Seek( fooPointer ) != Json::Status::kOk ||
+         reader.ReadString( string ) != Json::Status::kOk || string.length != 3 || !reader.Next() || reader.ReadString( string ) != Json::Status::kOk ||
+         memcmp( string.text, "baz", 3 ) != 0 || reader.Next() || !reader.Next() || reader.GetKey().length != 0 )
+    {
+        fprintf( stderr, "Unexpected read after seeking\n" );
+        return 1;
+    }
+
+    // Pointers to no value, with the column where the reader reports them.
+    struct MissingCase
+    {
+        const char*     pointer;
+        Terathon::int32 errorColumn;
+    };
+
+    static const MissingCase missingCases[] = {
+        { "/missing", 1 },
+        { "/foo/2", 11 },
+        { "/foo/-", 11 },
+        { "/foo/01", 11 },
+        { "/foo/bar", 11 },
+        { "/foo/0/x", 13 },
+        { "/a~1b/0", 45 },
+        { "/mechanical/gearRatios/4294967296", 23 },
+        { "/mechanical/~1~0", 38 },
+    };
+
+    for ( const MissingCase& missingCase : missingCases )
+    {
+        Json::CompiledPointer pointer;
+
+        if ( pointer.Compile( missingCase.pointer ) == Json::Status::kOk && reader.Open( text ) == Json::Status::kOk )
+        {
+            reader.Seek( pointer );
+        }
+
+        Json::ParseResult parseResult = reader.GetParseResult();
+
+        if ( jSd.FindPointer( missingCase.pointer ) || jSd.FindPointer( pointer ) || parseResult.status != Json::Status::kPointerNotFound ||
+             parseResult.errorColumn != missingCase.errorColumn )
+        {
+            fprintf( stderr, "Unexpected lookup of %s at %d:%d\n", missingCase.pointer, int( parseResult.errorLine ), int( parseResult.errorColumn ) );
+            return 1;
+        }
+    }
+
+    // Malformed pointers are reported when they are compiled, and a pointer that failed to compile refers to no value.
+    static const char* const malformedPointers[] = { "foo", "/m~2n", "/m~", "#/foo" };
+
+    for ( const char* malformedPointer : malformedPointers )
+    {
+        Json::CompiledPointer pointer;
+
+        if ( pointer.Compile( malformedPointer ) != Json::Status::kInvalidPointer || pointer.IsCompiled() || jSd.FindPointer( pointer ) ||
+             jSd.FindPointer( malformedPointer ) || reader.Open( text ) != Json::Status::kOk || reader.Seek( pointer ) != Json::Status::kInvalidPointer )
+        {
+            fprintf( stderr, "Malformed pointer %s was accepted\n", malformedPointer );
+            return 1;
+        }
+    }
+
+    // Syntax errors met while seeking are reported as Parse reports them.
+    static const char* const malformedTexts[] = { "{ \"a\" : [ 1, 2, ], \"b\" : 1 }", "{ \"a\" : tru, \"b\" : 1 }", "{ \"a\" 1 }", "{ \"b\" : @ }" };
+
+    Json::CompiledPointer bPointer;
+    bPointer.Compile( "/b/0" );
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+
+        Json::ParseResult parseResult = jSd.Parse( text );
+
+        if ( reader.Open( text ) == Json::Status::kOk )
+        {
+            reader.Seek( bPointer );
+        }
+
+        Json::ParseResult seekResult = reader.GetParseResult();
+
+        if ( seekResult.status != parseResult.status || seekResult.errorLine != parseResult.errorLine || seekResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace Json = C4::Json;
+
+// Parses only selected paths of documents and checks that the values at the paths and their ancestors are built and
+// nothing else, that the parse stops once every path is resolved, that the documents work with FindPointer and
+// DeserializeTo, and that syntax errors met before the parse stops are reported as Parse reports them.
+
+struct Header
+{
+    Terathon::int64 id = 0;
+};
+
+#define HEADER_PROTO "id", object.id
+DEFINE_JSON4C4_FUNCTIONS( Header, HEADER_PROTO )
+
+struct Body
+{
+    Terathon::Array<Terathon::String<>> items;
+};
+
+#define BODY_PROTO "items", object.items
+DEFINE_JSON4C4_FUNCTIONS( Body, BODY_PROTO )
+
+struct Event
+{
+    Header header;
+    Body   body;
+};
+
+#define EVENT_PROTO "header", object.header, "body", object.body
+DEFINE_JSON4C4_FUNCTIONS( Event, EVENT_PROTO )
+
+static const char* const eventText =
+    "{ \"header\" : { \"kind\" : \"sample\", \"id\" : 42, \"trace\" : [ \"a\\\"]}\", { \"depth\" : [ [] ] } ] },\n"
+    "  \"payload\" : { \"blob\" : \"\\\\\\\\\\\"{[\", \"body\" : { \"items\" : [ \"wrong\" ] } },\n"
+    "  \"body\" : { \"note\" : null, \"items\" : [ \"first\", \"caf\\u00e9\" ], \"count\" : 2 }, \"trailer\" : [ 1, 2, 3 ] }";
+
+// Writes the document parsed from paths, and the document that is expected, compactly for comparison.
+static bool SameDocument( Json::StructuredData& jSd, const char* expected )
+{
+    Terathon::Array<char> expectedText;
+    MakeText( expectedText, expected );
+
+    Json::StructuredData expectedJSd;
+    std::string          written;
+    std::string          expectedWritten;
+
+    return expectedJSd.Parse( expectedText ).status == Json::Status::kOk && jSd.WriteToBuffer( written, 0 ) == Json::Status::kOk &&
+           expectedJSd.WriteToBuffer( expectedWritten, 0 ) == Json::Status::kOk && written == expectedWritten;
+}
+
+int main()
+{
+    Terathon::Array<char> text;
+    MakeText( text, eventText );
+
+    Json::StructuredData jSd;
+
+    for ( int pass = 0; pass != 2; pass++ )
+    {
+        jSd.SetTrustedSkipping( pass != 0 );
+
+        Event event;
+
+        if ( jSd.ParsePaths( text, { "/header/id", "/body/items" } ).status != Json::Status::kOk ||
+             !SameDocument( jSd, "{ \"header\" : { \"id\" : 42 }, \"body\" : { \"items\" : [ \"first\", \"caf\\u00e9\" ] } }" ) ||
+             !jSd.FindPointer( "/body/items/1" ) || jSd.FindPointer( "/payload" ) || jSd.DeserializeTo( event ) != Json::Status::kOk ||
+             event.header.id != 42 || event.body.items.GetArrayElementCount() != 2 || strcmp( event.body.items[ 1 ], "caf\xC3\xA9" ) != 0 )
+        {
+            fprintf( stderr, "Unexpected event in pass %d\n", pass );
+            return 1;
+        }
+    }
+
+    jSd.SetTrustedSkipping( false );
+
+    struct PathCase
+    {
+        const char*        text;
+        const char* const* paths;
+        int                pathCount;
+        const char*        expected;
+    };
+
+    static const char* const indexPaths[]     = { "/list/2/name" };
+    static const char* const missingPaths[]   = { "/header/missing", "/header/id/x", "/list/x", "/nothing/0" };
+    static const char* const nestedPaths[]    = { "/body/items/0", "/body" };
+    static const char* const duplicatePaths[] = { "/a" };
+    static const char* const wholePaths[]     = { "/a", "" };
+    static const char* const stopPaths[]      = { "/a/b", "/c" };
+
+    static const PathCase pathCases[] = {
+        // The elements before a selected element are kept as nulls.
+        { "{ \"list\" : [ { \"name\" : \"a\" }, { \"name\" : \"b\" }, { \"x\" : 1, \"name\" : \"c\" }, { \"name\" : \"d\" } ] }", indexPaths, 1,
+          "{ \"list\" : [ null, null, { \"name\" : \"c\" } ] }" },
+
+        // Paths that refer to no value are not an error.
+        { "{ \"header\" : { \"id\" : 42, \"kind\" : \"x\" }, \"list\" : [ 1 ], \"other\" : true }", missingPaths, 4, "{ \"header\" : {}, \"list\" : [] }" },
+
+        // A path inside a selected value does not narrow it.
+        { "{ \"body\" : { \"items\" : [ 1, 2 ], \"count\" : 2 } }", nestedPaths, 2, "{ \"body\" : { \"items\" : [ 1, 2 ], \"count\" : 2 } }" },
+
+        // The first of duplicate members is selected, and the parse stops there.
+        { "{ \"a\" : 1, \"a\" : 2, \"b\" : [ tru ] }", duplicatePaths, 1, "{ \"a\" : 1 }" },
+
+        // The empty path selects the whole document.
+        { "{ \"a\" : 1, \"b\" : [ 2 ] }", wholePaths, 2, "{ \"a\" : 1, \"b\" : [ 2 ] }" },
+
+        // The text after the last resolved path is not read.
+        { "{ \"a\" : { \"x\" : 0, \"b\" : { \"c\" : [] } }, \"c\" : \"s\", \"d\" : [ 1, 2, , ] } trailing", stopPaths, 2,
+          "{ \"a\" : { \"b\" : { \"c\" : [] } }, \"c\" : \"s\" }" },
+    };
+
+    for ( const PathCase& pathCase : pathCases )
+    {
+        MakeText( text, pathCase.text );
+
+        if ( jSd.ParsePaths( text, pathCase.paths, pathCase.pathCount ).status != Json::Status::kOk || !SameDocument( jSd, pathCase.expected ) )
+        {
+            fprintf( stderr, "Unexpected document for %s\n", pathCase.text );
+            return 1;
+        }
+    }
+
+    // Compiled paths select the same values, and a path that failed to compile is reported.
+    Json::CompiledPointer paths[ 2 ];
+    MakeText( text, "{ \"list\" : [ { \"name\" : \"a\" }, { \"name\" : \"b\" }, { \"x\" : 1, \"name\" : \"c\" }, { \"name\" : \"d\" } ] }" );
+
+    if ( paths[ 0 ].Compile( "/list/2/name" ) != Json::Status::kOk || jSd.ParsePaths( text, paths, 1 ).status != Json::Status::kOk ||
+         !jSd.FindPointer( paths[ 0 ] ) || jSd.ParsePaths( text, paths, 2 ).status != Json::Status::kInvalidPointer ||
+         jSd.ParsePaths( text, { "list" } ).status != Json::Status::kInvalidPointer )
+    {
+        fprintf( stderr, "Unexpected parse of compiled paths\n" );
+        return 1;
+    }
+
+    // An index into an empty array selects nothing, also in a document that has not parsed an array before.
+    static const char* const emptyArrayTexts[] = { "[]", "{ \"a\" : [] }" };
+    static const char* const emptyArrayPaths[] = { "/0", "/a/0" };
+
+    for ( int index = 0; index != 2; index++ )
+    {
+        MakeText( text, emptyArrayTexts[ index ] );
+
+        Json::StructuredData emptyArrayJSd;
+        if ( emptyArrayJSd.ParsePaths( text, &emptyArrayPaths[ index ], 1 ).status != Json::Status::kOk ||
+             !SameDocument( emptyArrayJSd, emptyArrayTexts[ index ] ) )
+        {
+            fprintf( stderr, "Unexpected document for %s\n", emptyArrayTexts[ index ] );
+            return 1;
+        }
+    }
+
+    // Syntax errors met before the parse stops are reported as Parse reports them.
+    static const char* const malformedTexts[] = {
+        "{ \"skipped\" : [ 1, 2, ], \"body\" : { \"items\" : [] } }",
+        "{ \"body\" : { \"items\" : [ 1,\n  2, ] } }",
+        "{ \"body\" : { \"note\" 1 } }",
+        "{ \"body\" : { \"note\" : 1, }",
+        "{ \"body\" : { \"skipped\" : [ tru ], \"items\" : [] } }",
+        "{ \"other\" : [ 1 ] } x",
+        "{ \"a\" : [ 1, 2 ",
+        "",
+    };
+
+    for ( const char* malformedText : malformedTexts )
+    {
+        MakeText( text, malformedText );
+
+        Json::StructuredData parsedJSd;
+        Json::ParseResult    parseResult      = parsedJSd.Parse( text );
+        Json::ParseResult    pathsParseResult = jSd.ParsePaths( text, { "/body/items" } );
+
+        if ( parseResult.status == Json::Status::kOk || pathsParseResult.status != parseResult.status || pathsParseResult.errorLine != parseResult.errorLine ||
+             pathsParseResult.errorColumn != parseResult.errorColumn )
+        {
+            fprintf( stderr, "Unexpected syntax error report for %s\n", malformedText );
+            return 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <Json4C4/C4Json.h>
+
+#include "TestText.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Json = C4::Json;
+
+// Deserializes one message after another into the same arrays of objects, from a StructuredData, a
+// CompactStructuredData, and a Reader, and checks that optional members left out of a message take their default
+// values instead of keeping the values of an earlier message.
+
+struct Part
+{
+    Terathon::int64    id    = 0;
+    Terathon::int32    extra = -1;
+    Terathon::String<> note;
+};
+
+#define PART_PROTO "id", object.id, Json::optional, "extra", object.extra, Json::optional, "note", object.note
+DEFINE_JSON4C4_FUNCTIONS( Part, PART_PROTO )
+
+// A type with only required fields is overwritten entirely, so its elements keep their storage, and a type with a
+// field of a type that keeps old values keeps them too.
+struct Label
+{
+    Terathon::String<> text;
+};
+
+#define LABEL_PROTO "text", object.text
+DEFINE_JSON4C4_FUNCTIONS( Label, LABEL_PROTO )
+
+struct Assembly
+{
+    Part part;
+
+#define ASSEMBLY_PROTO "part", part
+    DEFINE_JSON4C4_MEMBER_FUNCTIONS( ASSEMBLY_PROTO )
+};
+
+static_assert( Json::Detail::KeepsStaleValue<Part>::Value && Json::Detail::KeepsStaleValue<Assembly>::Value, "Part and Assembly keep old values" );
+static_assert( !Json::Detail::KeepsStaleValue<Label>::Value && !Json::Detail::KeepsStaleValue<Terathon::Array<Part>>::Value, "Label is overwritten" );
+
+struct Batch
+{
+    Terathon::Array<Part> parts;
+    std::vector<Part>     partList;
+};
+
+#define BATCH_PROTO "parts", object.parts, "partList", object.partList
+DEFINE_JSON4C4_FUNCTIONS( Batch, BATCH_PROTO )
+
+#ifdef __cpp_exceptions
+
+// Counts the live instances, and fails to construct while constructionFails is set.
+static int  guardCount        = 0;
+static bool constructionFails = false;
+
+struct Guard
+{
+    Guard()
+    {
+        if ( constructionFails )
+        {
+            throw 1;
+        }
+
+        guardCount++;
+    }
+
+    Guard( const Guard& ) noexcept
+    {
+        guardCount++;
+    }
+
+    ~Guard()
+    {
+        guardCount--;
+    }
+
+    Guard& operator=( const Guard& ) noexcept = default;
+};
+
+struct GuardedPart
+{
+    Terathon::int64 id = 0;
+    Guard           guard;
+};
+
+#define GUARDED_PART_PROTO Json::optional, "id", object.id
+DEFINE_JSON4C4_FUNCTIONS( GuardedPart, GUARDED_PART_PROTO )
+
+#endif
+
+static const char* const firstText =
+    "{ \"parts\" : [ { \"id\" : 1, \"extra\" : 5, \"note\" : \"a note that does not fit in place\" }, { \"id\" : 3, \"extra\" : 6 } ],\n"
+    "  \"partList\" : [ { \"id\" : 1, \"extra\" : 5, \"note\" : \"a note that does not fit in place\" }, { \"id\" : 3, \"extra\" : 6 } ] }";
+
+static const char* const secondText = "{ \"parts\" : [ { \"id\" : 2 } ], \"partList\" : [ { \"id\" : 2 } ] }";
+
+static bool IsSecondPart( const Part& part )
+{
+    return part.id == 2 && part.extra == -1 && part.note.GetStringLength() == 0;
+}
+
+static bool IsSecondBatch( const Batch& batch )
+{
+    return batch.parts.GetArrayElementCount() == 1 && IsSecondPart( batch.parts[ 0 ] ) && batch.partList.size() == 1 && IsSecondPart( batch.partList[ 0 ] );
+}
+
+int main()
+{
+    Terathon::Array<char> first;
+    Terathon::Array<char> second;
+    MakeText( first, firstText );
+    MakeText( second, secondText );
+
+    Json::StructuredData        jSd;
+    Json::CompactStructuredData jCsd;
+
+    Batch batch;
+
+    if ( jSd.Parse( first ).status != Json::Status::kOk || jSd.DeserializeTo( batch ) != Json::Status::kOk || jSd.Parse( second ).status != Json::Status::kOk ||
+         jSd.DeserializeTo( batch ) != Json::Status::kOk || !IsSecondBatch( batch ) )
+    {
+        fprintf( stderr, "Old values were kept by a StructuredData\n" );
+        return 1;
+    }
+
+    Batch compactBatch;
+
+    if ( jCsd.Parse( first ).status != Json::Status::kOk || jCsd.DeserializeTo( compactBatch ) != Json::Status::kOk ||
+         jCsd.Parse( second ).status != Json::Status::kOk || jCsd.DeserializeTo( compactBatch ) != Json::Status::kOk || !IsSecondBatch( compactBatch ) )
+    {
+        fprintf( stderr, "Old values were kept by a CompactStructuredData\n" );
+        return 1;
+    }
+
+    Batch parsedBatch;
+
+    if ( Json::ParseInto( first, parsedBatch ).status != Json::Status::kOk || Json::ParseInto( second, parsedBatch ).status != Json::Status::kOk ||
+         !IsSecondBatch( parsedBatch ) )
+    {
+        fprintf( stderr, "Old values were kept by ParseInto\n" );
+        return 1;
+    }
+
+#ifdef __cpp_exceptions
+
+    // A reused element whose replacement cannot be constructed is kept, and destroyed once.
+    {
+        Terathon::Array<GuardedPart> guardedParts;
+
+        MakeText( first, "[ { \"id\" : 1 }, { \"id\" : 2 } ]" );
+
+        if ( jSd.Parse( first ).status != Json::Status::kOk || jSd.DeserializeTo( guardedParts ) != Json::Status::kOk )
+        {
+            fprintf( stderr, "Failed to deserialize the guarded parts\n" );
+            return 1;
+        }
+
+        constructionFails = true;
+        Json::Status status = jSd.DeserializeTo( guardedParts );
+        constructionFails   = false;
+
+        if ( status != Json::Status::kException || guardCount != 2 )
+        {
+            fprintf( stderr, "Unexpected status or instance count after a failed reset\n" );
+            return 1;
+        }
+    }
+
+    if ( guardCount != 0 )
+    {
+        fprintf( stderr, "%d instances left after the guarded parts were destroyed\n", guardCount );
+        return 1;
+    }
+
+#endif
+
+    return 0;
+}